@@ -55,6 +55,11 @@ endif()
 # - with "dirprot" swig will attemp to wrap all the public and protected methods at once.
 list(APPEND CMAKE_SWIG_FLAGS "-dirvtable")
 
+# -threads : thread support, directors take the GIL before calling python.
+# The GIL is kept by default in wrappers (see %nothreadallow in start.i),
+# it is released only for long computations (time loop, numerics drivers).
+list(APPEND CMAKE_SWIG_FLAGS "-threads")
+
 list(REMOVE_DUPLICATES CMAKE_SWIG_FLAGS)
 set(CMAKE_SWIG_FLAGS "${CMAKE_SWIG_FLAGS}" CACHE INTERNAL "Swig flags")
 
@@ -135,6 +135,7 @@ SICONOS_IO_REGISTER_WITH_BASES(NewtonImpactFrictionNSL,(NonSmoothLaw),
 SICONOS_IO_REGISTER_WITH_BASES(MixedComplementarityConditionNSL,(NonSmoothLaw),
   (_equalitySize))
 SICONOS_IO_REGISTER(PluggedObject,
+  (_batchPluginName)
   (_pluginName))
 SICONOS_IO_REGISTER_WITH_BASES(NewtonEuler3DR,(NewtonEuler1DR),
 )
@@ -298,6 +299,8 @@ SICONOS_IO_REGISTER(DynamicalSystem,
   (_z))
 SICONOS_IO_REGISTER_WITH_BASES(LagrangianScleronomousR,(LagrangianR),
   (_dotjacqhXqdot)
+  (_hBatchComputed)
+  (_jachqBatchComputed)
   (_plugindotjacqh))
 SICONOS_IO_REGISTER_WITH_BASES(LagrangianLinearTIDS,(LagrangianDS),
   (_C)
@@ -305,8 +308,10 @@ SICONOS_IO_REGISTER_WITH_BASES(LagrangianLinearTIDS,(LagrangianDS),
 SICONOS_IO_REGISTER_WITH_BASES(LagrangianDS,(DynamicalSystem),
   (_boundaryConditions)
   (_fExt)
+  (_fExtBatchComputed)
   (_fGyr)
   (_fInt)
+  (_fIntBatchComputed)
   (_forces)
   (_forcesMemory)
   (_hasConstantFExt)
@@ -357,6 +362,7 @@ SICONOS_IO_REGISTER_WITH_BASES(NewtonEulerDS,(DynamicalSystem),
   (_hasConstantMExt)
   (_inverseMass)
   (_isMextExpressedInInertialFrame)
+  (_isSleeping)
   (_jacobianFIntq)
   (_jacobianFInttwist)
   (_jacobianMExtq)
@@ -385,6 +391,7 @@ SICONOS_IO_REGISTER_WITH_BASES(NewtonEulerDS,(DynamicalSystem),
   (_qDim)
   (_qMemory)
   (_reactionToBoundaryConditions)
+  (_restingSteps)
   (_rhsMatrices)
   (_scalarMass)
   (_twist)
@@ -396,6 +403,7 @@ SICONOS_IO_REGISTER(ExtraAdditionalTerms,
 SICONOS_IO_REGISTER_WITH_BASES(MoreauJeanBilbaoOSI,(OneStepIntegrator),
 )
 SICONOS_IO_REGISTER(InteractionManager,
+  (_interactionPoolSize)
   (_nslaws))
 SICONOS_IO_REGISTER_WITH_BASES(TimeDiscretisationEvent,(Event),
 )
@@ -536,6 +544,12 @@ SICONOS_IO_REGISTER_WITH_BASES(MoreauJeanDirectProjectionOSI,(MoreauJeanOSI),
   (_deactivateYPosThreshold)
   (_deactivateYVelThreshold))
 SICONOS_IO_REGISTER_WITH_BASES(TimeStepping,(Simulation),
+  (_adaptiveHMatrices)
+  (_adaptiveHMax)
+  (_adaptiveHMin)
+  (_adaptiveNbRejectedSteps)
+  (_adaptiveTolerance)
+  (_adaptiveViolationTolerance)
   (_computeResiduR)
   (_computeResiduY)
   (_displayNewtonConvergence)
@@ -635,6 +649,8 @@ SICONOS_IO_REGISTER_WITH_BASES(MoreauJeanGOSI,(OneStepIntegrator),
   (_useGamma)
   (_useGammaForRelation))
 SICONOS_IO_REGISTER_WITH_BASES(MoreauJeanOSI,(OneStepIntegrator),
+  (_deactivationSteps)
+  (_deactivationVelocity)
   (_explicitNewtonEulerDSOperators)
   (_gamma)
   (_theta)
@@ -884,6 +900,32 @@ SICONOS_IO_REGISTER_WITH_BASES(DiskMovingPlanR,(LagrangianRheonomousR),
   (_r)
   (_sqrA2pB2)
   (_time))
+SICONOS_IO_REGISTER(FlatBroadphase,
+  (_order_work)
+  (_previous_number)
+  (bodies)
+  (ci)
+  (cj)
+  (ck)
+  (has_external)
+  (imax)
+  (imin)
+  (jmax)
+  (jmin)
+  (key)
+  (kmax)
+  (kmin)
+  (number)
+  (order)
+  (pairs)
+  (planar)
+  (radius)
+  (rmax)
+  (sorted_key)
+  (type)
+  (x)
+  (y)
+  (z))
 SICONOS_IO_REGISTER(Hashed,
   (body)
   (i)
@@ -892,6 +934,8 @@ SICONOS_IO_REGISTER(Hashed,
 SICONOS_IO_REGISTER_WITH_BASES(SpaceFilter,(InteractionManager),
   (_bboxfactor)
   (_cellsize)
+  (_broadphase)
+  (_flat_broadphase)
   (_hash_table)
   (_plans)
   (circlecircle_relations)
@@ -1189,6 +1233,7 @@ void siconos_io_register_generated_Mechanics(Archive& ar)
   ar.register_type(static_cast<PrismaticJointR*>(nullptr));
   ar.register_type(static_cast<SiconosContactor*>(nullptr));
   ar.register_type(static_cast<DiskMovingPlanR*>(nullptr));
+  ar.register_type(static_cast<FlatBroadphase*>(nullptr));
   ar.register_type(static_cast<Hashed*>(nullptr));
   ar.register_type(static_cast<SpaceFilter*>(nullptr));
   ar.register_type(static_cast<SiconosContactorSet*>(nullptr));
@@ -112,6 +112,7 @@ SICONOS_IO_REGISTER_WITH_BASES(NewtonImpactFrictionNSL,(NonSmoothLaw),
 SICONOS_IO_REGISTER_WITH_BASES(MixedComplementarityConditionNSL,(NonSmoothLaw),
   (_equalitySize))
 SICONOS_IO_REGISTER(PluggedObject,
+  (_batchPluginName)
   (_pluginName))
 SICONOS_IO_REGISTER_WITH_BASES(NewtonEuler3DR,(NewtonEuler1DR),
 )
@@ -275,6 +276,8 @@ SICONOS_IO_REGISTER(DynamicalSystem,
   (_z))
 SICONOS_IO_REGISTER_WITH_BASES(LagrangianScleronomousR,(LagrangianR),
   (_dotjacqhXqdot)
+  (_hBatchComputed)
+  (_jachqBatchComputed)
   (_plugindotjacqh))
 SICONOS_IO_REGISTER_WITH_BASES(LagrangianLinearTIDS,(LagrangianDS),
   (_C)
@@ -282,8 +285,10 @@ SICONOS_IO_REGISTER_WITH_BASES(LagrangianLinearTIDS,(LagrangianDS),
 SICONOS_IO_REGISTER_WITH_BASES(LagrangianDS,(DynamicalSystem),
   (_boundaryConditions)
   (_fExt)
+  (_fExtBatchComputed)
   (_fGyr)
   (_fInt)
+  (_fIntBatchComputed)
   (_forces)
   (_forcesMemory)
   (_hasConstantFExt)
@@ -334,6 +339,7 @@ SICONOS_IO_REGISTER_WITH_BASES(NewtonEulerDS,(DynamicalSystem),
   (_hasConstantMExt)
   (_inverseMass)
   (_isMextExpressedInInertialFrame)
+  (_isSleeping)
   (_jacobianFIntq)
   (_jacobianFInttwist)
   (_jacobianMExtq)
@@ -362,6 +368,7 @@ SICONOS_IO_REGISTER_WITH_BASES(NewtonEulerDS,(DynamicalSystem),
   (_qDim)
   (_qMemory)
   (_reactionToBoundaryConditions)
+  (_restingSteps)
   (_rhsMatrices)
   (_scalarMass)
   (_twist)
@@ -373,6 +380,7 @@ SICONOS_IO_REGISTER(ExtraAdditionalTerms,
 SICONOS_IO_REGISTER_WITH_BASES(MoreauJeanBilbaoOSI,(OneStepIntegrator),
 )
 SICONOS_IO_REGISTER(InteractionManager,
+  (_interactionPoolSize)
   (_nslaws))
 SICONOS_IO_REGISTER_WITH_BASES(TimeDiscretisationEvent,(Event),
 )
@@ -513,6 +521,12 @@ SICONOS_IO_REGISTER_WITH_BASES(MoreauJeanDirectProjectionOSI,(MoreauJeanOSI),
   (_deactivateYPosThreshold)
   (_deactivateYVelThreshold))
 SICONOS_IO_REGISTER_WITH_BASES(TimeStepping,(Simulation),
+  (_adaptiveHMatrices)
+  (_adaptiveHMax)
+  (_adaptiveHMin)
+  (_adaptiveNbRejectedSteps)
+  (_adaptiveTolerance)
+  (_adaptiveViolationTolerance)
   (_computeResiduR)
   (_computeResiduY)
   (_displayNewtonConvergence)
@@ -612,6 +626,8 @@ SICONOS_IO_REGISTER_WITH_BASES(MoreauJeanGOSI,(OneStepIntegrator),
   (_useGamma)
   (_useGammaForRelation))
 SICONOS_IO_REGISTER_WITH_BASES(MoreauJeanOSI,(OneStepIntegrator),
+  (_deactivationSteps)
+  (_deactivationVelocity)
   (_explicitNewtonEulerDSOperators)
   (_gamma)
   (_theta)
@@ -0,0 +1,35 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#include "MechanicsRunner.hpp"
+#include <TimeStepping.hpp>
+
+unsigned int MechanicsRunner::run(unsigned int nsteps, double until)
+{
+  unsigned int k = 0;
+  while (k < nsteps && _simulation->hasNextEvent()
+         && _simulation->nextTime() < until)
+  {
+    _simulation->computeOneStep();
+    _simulation->clearNSDSChangeLog();
+    _simulation->nextStep();
+    ++k;
+  }
+  _numberOfSteps += k;
+  return k;
+}
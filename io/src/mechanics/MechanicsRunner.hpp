@@ -0,0 +1,87 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/*! \file MechanicsRunner.hpp
+  \brief native time loop for mechanics simulations
+*/
+
+#ifndef MechanicsRunner_hpp
+#define MechanicsRunner_hpp
+
+#include <SiconosPointers.hpp>
+#include <SiconosFwd.hpp>
+#include <limits>
+
+/** Run the steps of a mechanics simulation without going back to python.
+
+    The python runner (mechanics_run.py) drives the time loop step by
+    step: births, deaths, outputs, hooks, logs. Most of the steps do
+    nothing of this and the python overhead per step may be larger than
+    the physics for small scenes. The steps with no python work are
+    delegated to this class which performs, for each of them, the same
+    sequence as the python loop:
+
+    - simulation->computeOneStep()
+    - simulation->clearNSDSChangeLog()
+    - simulation->nextStep()
+
+    This is opt-in: the python runner uses it only if the run option
+    'native_loop' is set.
+*/
+class MechanicsRunner
+{
+protected:
+
+  /** the simulation to run */
+  SP::TimeStepping _simulation;
+
+  /** total number of steps run by this object */
+  unsigned long _numberOfSteps = 0;
+
+public:
+
+  /** constructor
+   * \param sim the time-stepping simulation to drive
+   */
+  MechanicsRunner(SP::TimeStepping sim) : _simulation(sim) {};
+
+  virtual ~MechanicsRunner() {};
+
+  /** run at most nsteps steps of the simulation
+   * \param nsteps maximum number of steps
+   * \param until the steps are run while nextTime() of the simulation is
+   *   strictly lower than this value (e.g. next scheduled birth or death)
+   * \return the number of steps actually performed
+   */
+  unsigned int run(unsigned int nsteps,
+                   double until = std::numeric_limits<double>::infinity());
+
+  /** \return the total number of steps run by this object */
+  unsigned long numberOfSteps() const
+  {
+    return _numberOfSteps;
+  };
+
+  /** \return the simulation */
+  SP::TimeStepping simulation() const
+  {
+    return _simulation;
+  };
+};
+
+#endif
@@ -30,4 +30,9 @@
 %{
 #include <MechanicsIO.hpp>
 %}
+%feature("nothreadallow", "0") MechanicsRunner::run;
+%include <MechanicsRunner.hpp>
+%{
+#include <MechanicsRunner.hpp>
+%}
 #endif
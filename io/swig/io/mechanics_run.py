@@ -40,7 +40,7 @@ from siconos.kernel import \
 # Siconos Mechanics imports
 from siconos.mechanics.collision.tools import Contactor, Shape
 from siconos.mechanics import joints
-from siconos.io.io_base import MechanicsIO
+from siconos.io.io_base import MechanicsIO, MechanicsRunner
 from siconos.io.FrictionContactTrace import GlobalFrictionContactTrace as GFCTrace
 from siconos.io.FrictionContactTrace import FrictionContactTrace as FCTrace
 from siconos.io.FrictionContactTrace import GlobalRollingFrictionContactTrace as GRFCTrace
@@ -828,6 +828,7 @@ class MechanicsHdf5Runner_run_options(dict):
         d['output_contact_forces']=True,
         d['output_contact_info']=True,
         d['output_contact_work']=True,
+        d['native_loop']=False
 
 
         super(self.__class__, self).__init__(d)
@@ -926,6 +927,7 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
         self._scheduled_deaths = []
         self._births = dict()
         self._deaths = dict()
+        self._pending_bodies = None
         self._initializing = True
         self._output_contact_index_set = 1
         self._start_run_iteration_hook = None
@@ -1086,7 +1088,7 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
                               list(translation)+list(orientation), velocity)
 
             self._set_external_forces(body)
-            self._nsds.insertDynamicalSystem(body)
+            self._insert_body(body)
             if birth and self._verbose:
                 self.print_verbose('birth of body named {0}, translation {1}, orientation {2}'.format(name, translation, orientation))
             flag = 'dynamic'
@@ -1191,8 +1193,7 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
 
             # add the dynamical system to the non smooth
             # dynamical system
-            self._nsds.insertDynamicalSystem(body)
-            self._nsds.setName(body, str(name))
+            self._insert_body(body, name)
 
             if birth and self._verbose:
                 self.print_verbose('birth of body named {0}, translation {1}, orientation {2}'.format(name, translation, orientation))
@@ -1307,11 +1308,38 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
 
                 # add the dynamical system to the non smooth
                 # dynamical system
-                self._nsds.insertDynamicalSystem(body)
-                self._nsds.setName(body, str(name))
+                self._insert_body(body, name)
 
             return body, 'dynamic'
 
+    def _insert_body(self, body, name=None):
+        """Insert a body into the NSDS, or queue it while a scene is
+        being imported (see import_scene).
+        """
+        if self._pending_bodies is not None:
+            self._pending_bodies[0].append(body)
+            self._pending_bodies[1].append(name)
+        else:
+            self._nsds.insertDynamicalSystem(body)
+            if name is not None:
+                self._nsds.setName(body, str(name))
+
+    def _flush_pending_bodies(self):
+        """Insert the queued bodies into the NSDS in a single call."""
+        bodies, names = self._pending_bodies
+        self._pending_bodies = None
+        if len(bodies) == 0:
+            return
+        if None in names:
+            # unnamed bodies (native backend)
+            self._nsds.insertDynamicalSystems(bodies)
+            for body, name in zip(bodies, names):
+                if name is not None:
+                    self._nsds.setName(body, str(name))
+        else:
+            self._nsds.insertDynamicalSystems(bodies,
+                                              [str(n) for n in names])
+
     def make_coupler_jointr(self, ds1_name, ds2_name, coupled, references):
         topo = self._nsds.topology()
         dof1, dof2, ratio = coupled[0, :]
@@ -1520,7 +1548,7 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
                         link(cpl_inter, ds1, ds2)
                     nsds.setName(cpl_inter, '%s_coupler%d' % (str(name), n))
 
-    def import_boundary_conditions(self, name):
+    def import_boundary_conditions(self, name, ds1=None):
         if self._interman is not None:
             topo = self._nsds.\
                 topology()
@@ -1528,8 +1556,9 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
             bc_type = self.boundary_conditions()[name].attrs['type']
             bc_class = getattr(sk, bc_type)
 
-            ds1_name = self.boundary_conditions()[name].attrs['object1']
-            ds1 = topo.getDynamicalSystem(ds1_name)
+            if ds1 is None:
+                ds1_name = self.boundary_conditions()[name].attrs['object1']
+                ds1 = topo.getDynamicalSystem(ds1_name)
 
             if bc_type == 'HarmonicBC':
                 bc = bc_class(
@@ -1656,21 +1685,23 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
         possibly overriding initial position and velocity.
         """
         obj = self._input[name]
+        attrs = obj.attrs
+        number = attrs['id']
         self.print_verbose ('Import object name:', name)
-        self.print_verbose ('              number (id): {0} '.format(obj.attrs['id']))
+        self.print_verbose ('              number (id): {0} '.format(number))
 
         if translation is None:
-            translation = obj.attrs['translation']
+            translation = attrs['translation']
         if orientation is None:
-            orientation = obj.attrs['orientation']
+            orientation = attrs['orientation']
         if velocity is None:
-            velocity = obj.attrs['velocity']
+            velocity = attrs['velocity']
 
         # bodyframe center of mass
-        center_of_mass = floatv(obj.attrs.get('center_of_mass', [0, 0, 0]))
+        center_of_mass = floatv(attrs.get('center_of_mass', [0, 0, 0]))
 
-        mass = obj.attrs.get('mass', None)
-        inertia = obj.attrs.get('inertia', None)
+        mass = attrs.get('mass', None)
+        inertia = attrs.get('inertia', None)
 
         if mass is None:
             self.print_verbose ('              static object')
@@ -1733,28 +1764,28 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
                 floatv(velocity), contactors, mass,
                 inertia, body_class, shape_class, face_class,
                 edge_class, birth=birth,
-                number=self.instances()[name].attrs['id'])
+                number=number)
         elif backend == 'native':
             body, flag = self.import_native_object(
                 name, floatv(translation), floatv(orientation),
                 floatv(velocity), contactors, mass,
                 inertia, body_class, shape_class, birth=birth,
-                number=self.instances()[name].attrs['id'])
+                number=number)
         else:
             # Bullet object
             body, flag = self.import_bullet_object(
                 name, floatv(translation), floatv(orientation),
                 floatv(velocity), contactors, mass,
                 inertia, body_class, shape_class, birth=birth,
-                number=self.instances()[name].attrs['id'])
+                number=number)
 
         # import boundary conditions
         bc_name = self._ds_boundary_conditions.get(name, None)
         if bc_name is not None:
-            self.import_boundary_conditions(bc_name)
+            self.import_boundary_conditions(bc_name, body)
 
         # schedule its death immediately
-        time_of_death = obj.attrs.get('time_of_death', None)
+        time_of_death = attrs.get('time_of_death', None)
 
         if time_of_death is not None :
             bisect.insort_left(self._scheduled_deaths, time_of_death)
@@ -1828,61 +1859,68 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
                 max_time = None
                 id_last = None
             self.print_verbose('import dynamical systems ...')
-            for (name, obj) in sorted(self._input.items(),
-                                      key=lambda x: x[0]):
-
-                mass = obj.attrs.get('mass', None)
-                time_of_birth = obj.attrs.get('time_of_birth', -1)
-                time_of_death = obj.attrs.get('time_of_death', float('inf'))
-
-                if time_of_birth >= time:
-                    #
-                    # in the future
-                    #
-                    bisect.insort_left(self._scheduled_births, time_of_birth)
-                    if time_of_birth in self._births:
-                        self._births[time_of_birth].append((name, obj))
+            # bodies created below are queued and inserted into the
+            # NSDS at once, which is much faster for large scenes
+            self._pending_bodies = ([], [])
+            try:
+                for (name, obj) in sorted(self._input.items(),
+                                          key=lambda x: x[0]):
+
+                    mass = obj.attrs.get('mass', None)
+                    time_of_birth = obj.attrs.get('time_of_birth', -1)
+                    time_of_death = obj.attrs.get('time_of_death', float('inf'))
+
+                    if time_of_birth >= time:
+                        #
+                        # in the future
+                        #
+                        bisect.insort_left(self._scheduled_births, time_of_birth)
+                        if time_of_birth in self._births:
+                            self._births[time_of_birth].append((name, obj))
+                        else:
+                            self._births[time_of_birth] = [(name, obj)]
+                    elif time_of_death <= time:
+                        # object already dead do not import
+                        self.print_verbose('object', name, 'already dead do not import')
+                        #input()
+                        #pass
                     else:
-                        self._births[time_of_birth] = [(name, obj)]
-                elif time_of_death <= time:
-                    # object already dead do not import
-                    self.print_verbose('object', name, 'already dead do not import')
-                    #input()
-                    #pass
-                else:
-                    #
-                    # this is for now
-                    #
-                    # cold restart if output previously done
-
-                    if mass is not None and dpos_data is not None and\
-                       len(dpos_data) > 0:
-                        xpos = xdpos_data[obj.attrs['id']]
-                        translation = (xpos[2], xpos[3], xpos[4])
-                        orientation = (xpos[5], xpos[6], xpos[7], xpos[8])
-                        xvel = xvelocities[obj.attrs['id']]
-                        velocity = (xvel[2], xvel[3], xvel[4],
-                                    xvel[5], xvel[6], xvel[7])
-                        if self._dimension ==2:
-                            angle=2.0*acos(translation[2])
-                            orientation= (angle,)
-                            translation = (translation[0],translation[1])
-                            velocity =  (velocity[0],velocity[1],velocity[5])
+                        #
+                        # this is for now
+                        #
+                        # cold restart if output previously done
+
+                        if mass is not None and dpos_data is not None and\
+                           len(dpos_data) > 0:
+                            xpos = xdpos_data[obj.attrs['id']]
+                            translation = (xpos[2], xpos[3], xpos[4])
+                            orientation = (xpos[5], xpos[6], xpos[7], xpos[8])
+                            xvel = xvelocities[obj.attrs['id']]
+                            velocity = (xvel[2], xvel[3], xvel[4],
+                                        xvel[5], xvel[6], xvel[7])
+                            if self._dimension ==2:
+                                angle=2.0*acos(translation[2])
+                                orientation= (angle,)
+                                translation = (translation[0],translation[1])
+                                velocity =  (velocity[0],velocity[1],velocity[5])
 
-                    else:
-                        # start from initial conditions
-                        translation = obj.attrs['translation']
-                        orientation = obj.attrs['orientation']
-                        velocity = obj.attrs['velocity']
-
-                    self.import_object(name=name, body_class=body_class,
-                                       shape_class=shape_class,
-                                       face_class=face_class,
-                                       edge_class=edge_class,
-                                       translation=translation,
-                                       orientation=orientation,
-                                       velocity=velocity,
-                                       birth=False)
+                        else:
+                            # start from initial conditions
+                            translation = obj.attrs['translation']
+                            orientation = obj.attrs['orientation']
+                            velocity = obj.attrs['velocity']
+
+                        self.import_object(name=name, body_class=body_class,
+                                           shape_class=shape_class,
+                                           face_class=face_class,
+                                           edge_class=edge_class,
+                                           translation=translation,
+                                           orientation=orientation,
+                                           velocity=velocity,
+                                           birth=False)
+            finally:
+                # the queue is emptied even if an object fails to import
+                self._flush_pending_bodies()
 
             # import nslaws
             # note: no time of birth for nslaws and joints
@@ -2690,6 +2728,11 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
         end_run_iteration_hook: boolean, optional
             if true, launch logging process at the end of each time step.
             Default = False.
+        native_loop: boolean, optional (run_options only)
+            if true, the steps with no output, birth or death are run by
+            the compiled MechanicsRunner when no per-step python work
+            (hooks, controller, verbose, timers ...) is requested.
+            Default = False.
         """
 
         if run_options is None:
@@ -3107,6 +3150,41 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
         self.print_verbose('start simulation ...')
         self._initializing = False
 
+    def native_loop_allowed(self):
+        """True if the steps with no output nor birth/death may be run by
+        the compiled MechanicsRunner, i.e. no python work has been
+        registered for each step.
+        """
+        opts = self._run_options
+        if not opts.get('native_loop'):
+            return False
+        for key in ['with_timer', 'verbose', 'verbose_progress',
+                    'violation_verbose', 'explode_Newton_solve',
+                    'output_backup']:
+            if opts.get(key):
+                return False
+        for key in ['controller', 'friction_contact_trace_params',
+                    'exit_tolerance']:
+            if opts.get(key) is not None:
+                return False
+        return (self._start_run_iteration_hook is None and
+                self._before_next_step_iteration_hook is None and
+                self._end_run_iteration_hook is None)
+
+    def native_steps(self):
+        """Number of steps, starting from the current one, with no output."""
+        if self._k == 1:
+            return 0
+        if not self._output_frequency:
+            return 1 << 30
+        return (self._output_frequency -
+                self._k % self._output_frequency) % self._output_frequency
+
+    def next_scheduled_event(self):
+        """Time of the next birth or death, inf if none."""
+        times = self._scheduled_births[:1] + self._scheduled_deaths[:1]
+        return min(times) if times else float('inf')
+
     def run_loop(self):
         verbose = self._run_options.get('verbose')
         self._verbose=verbose
@@ -3121,8 +3199,19 @@ class MechanicsHdf5Runner(siconos.io.mechanics_hdf5.MechanicsHdf5):
         t0 = self._run_options.get('t0')
         T = self._run_options.get('T')
         h = self._run_options.get('h')
+        runner = None
+        if self.native_loop_allowed():
+            runner = MechanicsRunner(self._simulation)
         while self._simulation.hasNextEvent():
 
+            if runner is not None:
+                n = self.native_steps()
+                if n > 0:
+                    done = runner.run(n, self.next_scheduled_event())
+                    self._k += done
+                    if done > 0:
+                        continue
+
             if self._run_options.get('verbose_progress'):
                 self.print_verbose('step', self._k, 'of', self._k0 + int((T - t0) / h) - 1)
 
@@ -0,0 +1,88 @@
+#!/usr/bin/env python
+
+#
+# Two disks falling on the ground, run with and without the native loop
+# (MechanicsRunner): the outputs must be the same.
+#
+
+from siconos.mechanics.collision.tools import Contactor
+from siconos.io.mechanics_run import MechanicsHdf5Runner, \
+    MechanicsHdf5Runner_run_options
+
+import siconos.numerics as sn
+import siconos.kernel as sk
+
+import siconos
+
+import numpy
+
+siconos.io.mechanics_run.set_backend('native')
+
+disk_radius = 1
+
+
+def make_input(filename):
+
+    with MechanicsHdf5Runner(io_filename=filename) as io:
+
+        io.add_primitive_shape('DiskR', 'Disk', [disk_radius])
+        io.add_primitive_shape('Ground', 'Line', (0, 30, 0))
+        io.add_Newton_impact_friction_nsl('contact', mu=0.3, e=0.5)
+
+        io.add_object('disk0', [Contactor('DiskR')],
+                      translation=[-2, 2 * disk_radius],
+                      orientation=[0], velocity=[1, 0, 0], mass=1)
+        io.add_object('disk1', [Contactor('DiskR')],
+                      translation=[2, 3 * disk_radius],
+                      orientation=[0], velocity=[0, -1, 1], mass=2)
+
+        io.add_object('ground', [Contactor('Ground')],
+                      translation=[0, 0])
+
+
+def run(filename, native_loop):
+
+    options = sk.solver_options_create(sn.SICONOS_FRICTION_2D_NSGS)
+    options.iparam[sn.SICONOS_IPARAM_MAX_ITER] = 1000
+    options.dparam[sn.SICONOS_DPARAM_TOL] = 1e-12
+
+    run_options = MechanicsHdf5Runner_run_options()
+    run_options['t0'] = 0
+    run_options['T'] = 1
+    run_options['h'] = 0.005
+    run_options['theta'] = 0.50001
+    run_options['Newton_max_iter'] = 1
+    run_options['solver_options'] = options
+    run_options['verbose'] = False
+    run_options['verbose_progress'] = False
+    run_options['output_frequency'] = 10
+    run_options['native_loop'] = native_loop
+
+    with MechanicsHdf5Runner(io_filename=filename, mode='r+') as io:
+        io.run(run_options)
+
+
+def outputs(filename):
+
+    with MechanicsHdf5Runner(io_filename=filename, mode='r') as io:
+        return (numpy.array(io.dynamic_data()),
+                numpy.array(io.velocities_data()),
+                numpy.array(io.contact_forces_data()))
+
+
+def test_native_loop():
+    results = []
+    for native_loop in [False, True]:
+        filename = 'native_loop_{0}.hdf5'.format(native_loop)
+        make_input(filename)
+        run(filename, native_loop)
+        results.append(outputs(filename))
+
+    python_loop, native_loop = results
+
+    # several outputs, with contacts, skipped steps in between
+    assert len(numpy.unique(python_loop[0][:, 0])) > 2
+    assert python_loop[2].shape[0] > 0
+    for ref, data in zip(python_loop, native_loop):
+        assert ref.shape == data.shape
+        assert numpy.array_equal(ref, data)
@@ -319,6 +319,9 @@ void Interaction::initializeLinkToDsVariables(DynamicalSystem& ds1,
                                               DynamicalSystem& ds2)
 {
   VectorOfBlockVectors& DSlink = _linkToDSVariables;
+  // an interaction linked again (moved or recycled) starts from empty
+  // blocks: the optional ones (acceleration, z, p ...) are only appended to
+  DSlink.clear();
 
   // The dynamical systems linked to the interaction (2 at most, ds2 may be equal to ds1).
   RELATION::TYPES relationType = _relation->getType();
@@ -393,6 +396,19 @@ void Interaction::resetAllLambda()
 
 }
 
+void Interaction::recycle()
+{
+  _number = __count++;
+  for(unsigned int i = _lowerLevelForOutput ;
+      i < _upperLevelForOutput + 1 ;
+      i++)
+  {
+    if(_y[i])
+      _y[i]->zero();
+  }
+  resetAllLambda();
+}
+
 
 void Interaction::resetLambda(unsigned int level)
 {
@@ -238,6 +238,14 @@ public:
   /** set all lambda to zero */
   void resetAllLambda() ;
 
+  /** prepare an interaction removed from the simulation to be linked
+   *  again for a new contact (see InteractionManager::recycleInteraction):
+   *  it gets a new number and its outputs and inputs are set to zero.
+   *  The relation and the allocated vectors are kept, the links to the
+   *  variables of the dynamical systems are rebuilt when it is linked.
+   */
+  void recycle();
+
   /** set lambda to zero for a given level
    *
    *  \param level
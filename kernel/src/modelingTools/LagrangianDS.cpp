@@ -24,6 +24,8 @@
 // #define DEBUG_MESSAGES
 #include "siconos_debug.h"
 #include <iostream>
+#include <map>
+#include <tuple>
 
 void LagrangianDS::_init(SP::SiconosVector position, SP::SiconosVector velocity)
 {
@@ -343,24 +345,137 @@ void LagrangianDS::computeMass(SP::SiconosVector position)
 
 void LagrangianDS::computeFInt(double time)
 {
-  if(_fInt && _pluginFInt->fPtr)
+  // the value computed by computeFIntBatch at the current state is kept
+  bool batchComputed = _fIntBatchComputed;
+  _fIntBatchComputed = false;
+  if(!_fInt || batchComputed)
+    return;
+  if(_pluginFInt->fPtr)
     ((FPtr6)_pluginFInt->fPtr)(time, _ndof, &(*_q[0])(0), &(*_q[1])(0), &(*_fInt)(0), _z->size(), &(*_z)(0));
+  else if(_pluginFInt->fBatchPtr)
+    // with one object, the storage component by component is the usual one
+    ((FPtr6Batch)_pluginFInt->fBatchPtr)(time, 1, _ndof, &(*_q[0])(0), &(*_q[1])(0), &(*_fInt)(0), _z->size(), &(*_z)(0));
 }
 void LagrangianDS::computeFInt(double time, SP::SiconosVector position, SP::SiconosVector velocity)
 {
-  if(_fInt && _pluginFInt->fPtr)
+  // the value computed by computeFIntBatch at the current state is kept
+  bool batchComputed = _fIntBatchComputed && position == _q[0] && velocity == _q[1];
+  _fIntBatchComputed = false;
+  if(!_fInt || batchComputed)
+    return;
+  if(_pluginFInt->fPtr)
     ((FPtr6)_pluginFInt->fPtr)(time, _ndof, &(*position)(0), &(*velocity)(0), &(*_fInt)(0), _z->size(), &(*_z)(0));
+  else if(_pluginFInt->fBatchPtr)
+    // with one object, the storage component by component is the usual one
+    ((FPtr6Batch)_pluginFInt->fBatchPtr)(time, 1, _ndof, &(*position)(0), &(*velocity)(0), &(*_fInt)(0), _z->size(), &(*_z)(0));
+}
+
+void LagrangianDS::computeFIntBatch(double time, const std::vector<LagrangianDS*>& dss)
+{
+  // group the systems by batched function and sizes
+  typedef std::tuple<void*, unsigned int, unsigned int> BatchKey;
+  std::map<BatchKey, std::vector<LagrangianDS*>> groups;
+  for(LagrangianDS* ds : dss)
+  {
+    if(ds->hasFIntBatchFunction())
+      groups[BatchKey(ds->_pluginFInt->fBatchPtr, ds->_ndof, ds->_z->size())].push_back(ds);
+  }
+
+  std::vector<double> q, v, f, z;
+  for(auto& group : groups)
+  {
+    const std::vector<LagrangianDS*>& members = group.second;
+    unsigned int nb = members.size();
+    unsigned int ndof = std::get<1>(group.first);
+    unsigned int sizeZ = std::get<2>(group.first);
+    q.resize(nb * ndof);
+    v.resize(nb * ndof);
+    f.resize(nb * ndof);
+    z.resize(nb * sizeZ);
+
+    for(unsigned int k = 0; k < nb; ++k)
+    {
+      const LagrangianDS& ds = *members[k];
+      for(unsigned int i = 0; i < ndof; ++i)
+      {
+        q[i * nb + k] = (*ds._q[0])(i);
+        v[i * nb + k] = (*ds._q[1])(i);
+      }
+      for(unsigned int i = 0; i < sizeZ; ++i)
+        z[i * nb + k] = (*ds._z)(i);
+    }
+
+    ((FPtr6Batch)std::get<0>(group.first))(time, nb, ndof, q.data(), v.data(), f.data(), sizeZ, z.data());
+
+    for(unsigned int k = 0; k < nb; ++k)
+    {
+      LagrangianDS& ds = *members[k];
+      for(unsigned int i = 0; i < ndof; ++i)
+        (*ds._fInt)(i) = f[i * nb + k];
+      for(unsigned int i = 0; i < sizeZ; ++i)
+        (*ds._z)(i) = z[i * nb + k];
+      ds._fIntBatchComputed = true;
+    }
+  }
 }
 
 void LagrangianDS::computeFExt(double time)
 {
-  if(!_hasConstantFExt)
+  // the value computed by computeFExtBatch is kept
+  bool batchComputed = _fExtBatchComputed;
+  _fExtBatchComputed = false;
+  if(!_hasConstantFExt && !batchComputed)
   {
     if(_fExt && _pluginFExt->fPtr)
       ((VectorFunctionOfTime)_pluginFExt->fPtr)(time, _ndof, &(*_fExt)(0), _z->size(), &(*_z)(0));
+    else if(_fExt && _pluginFExt->fBatchPtr)
+      // with one object, the storage component by component is the usual one
+      ((VectorFunctionOfTimeBatch)_pluginFExt->fBatchPtr)(time, 1, _ndof, &(*_fExt)(0), _z->size(), &(*_z)(0));
   }
 
 }
+
+void LagrangianDS::computeFExtBatch(double time, const std::vector<LagrangianDS*>& dss)
+{
+  // group the systems by batched function and sizes
+  typedef std::tuple<void*, unsigned int, unsigned int> BatchKey;
+  std::map<BatchKey, std::vector<LagrangianDS*>> groups;
+  for(LagrangianDS* ds : dss)
+  {
+    if(ds->hasFExtBatchFunction())
+      groups[BatchKey(ds->_pluginFExt->fBatchPtr, ds->_ndof, ds->_z->size())].push_back(ds);
+  }
+
+  std::vector<double> f, z;
+  for(auto& group : groups)
+  {
+    const std::vector<LagrangianDS*>& members = group.second;
+    unsigned int nb = members.size();
+    unsigned int ndof = std::get<1>(group.first);
+    unsigned int sizeZ = std::get<2>(group.first);
+    f.resize(nb * ndof);
+    z.resize(nb * sizeZ);
+
+    for(unsigned int k = 0; k < nb; ++k)
+    {
+      const LagrangianDS& ds = *members[k];
+      for(unsigned int i = 0; i < sizeZ; ++i)
+        z[i * nb + k] = (*ds._z)(i);
+    }
+
+    ((VectorFunctionOfTimeBatch)std::get<0>(group.first))(time, nb, ndof, f.data(), sizeZ, z.data());
+
+    for(unsigned int k = 0; k < nb; ++k)
+    {
+      LagrangianDS& ds = *members[k];
+      for(unsigned int i = 0; i < ndof; ++i)
+        (*ds._fExt)(i) = f[i * nb + k];
+      for(unsigned int i = 0; i < sizeZ; ++i)
+        (*ds._z)(i) = z[i * nb + k];
+      ds._fExtBatchComputed = true;
+    }
+  }
+}
 void LagrangianDS::computeFGyr()
 {
   if(_fGyr && _pluginFGyr->fPtr)
@@ -731,6 +846,35 @@ void LagrangianDS::setComputeFIntFunction(FPtr6 fct)
   //    computeFIntPtr = fct;
 }
 
+void LagrangianDS::setComputeFIntBatchFunction(const std::string& plugin)
+{
+  _pluginFInt->setComputeBatchFunction(plugin);
+  allocateFInt();
+}
+
+void LagrangianDS::setComputeFIntBatchFunction(FPtr6Batch fct)
+{
+  _pluginFInt->setComputeBatchFunction((void*)fct);
+  allocateFInt();
+}
+
+void LagrangianDS::setComputeFExtBatchFunction(const std::string& plugin)
+{
+  _pluginFExt->setComputeBatchFunction(plugin);
+  if(!_fExt)
+    _fExt.reset(new SiconosVector(_ndof));
+  _hasConstantFExt = false;
+}
+
+void LagrangianDS::setComputeFExtBatchFunction(VectorFunctionOfTimeBatch fct)
+{
+  _pluginFExt->setComputeBatchFunction((void*)fct);
+  if(!_fExt)
+    _fExt.reset(new SiconosVector(_ndof));
+  _hasConstantFExt = false;
+}
+
+
 
 
 
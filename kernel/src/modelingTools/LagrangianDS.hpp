@@ -159,6 +159,14 @@ protected:
   //                              Jacobian_Force_wrt_q,
   //                              Jacobian_Forces_wrt_qDot, numberOfJacobians};
 
+  /** true if _fInt has been computed by computeFIntBatch for the
+   *  current state, the next call to computeFInt keeps this value */
+  bool _fIntBatchComputed = false;
+
+  /** true if _fExt has been computed by computeFExtBatch, the next call
+   *  to computeFExt keeps this value */
+  bool _fExtBatchComputed = false;
+
   /** jacobian_q FInt*/
   SP::SiconosMatrix _jacobianFIntq;
 
@@ -727,6 +735,40 @@ public:
    */
   void setComputeFIntFunction(FPtr6 fct);
 
+  /** allow to set a batched function to compute fInt, that computes the
+   *  internal forces of all the systems that share it in one call (see
+   *  computeFIntBatch). It is used only if no (non batched) function is
+   *  set for fInt.
+   *
+   *  \param plugin a std::string of the form "fileName:functionName"
+   */
+  void setComputeFIntBatchFunction(const std::string &plugin);
+
+  /** set a batched function to compute fInt
+   *
+   *  \param fct a pointer on the plugin function
+   */
+  void setComputeFIntBatchFunction(FPtr6Batch fct);
+
+  /** \return true if fInt is computed by a batched plugin */
+  inline bool hasFIntBatchFunction() const
+  {
+    return _fInt && !_pluginFInt->fPtr && _pluginFInt->fBatchPtr;
+  }
+
+  /** compute the internal forces of a set of systems, at their current
+   *  state, with one call of the batched plugin for each group of
+   *  systems that share the same function and the same sizes. The state
+   *  of the systems of a group is gathered in arrays stored component by
+   *  component before the call. The following call to computeFInt of
+   *  each system keeps the computed value.
+   *
+   *  \param time the current time
+   *  \param dss the systems, those without a batched plugin for fInt
+   *  are skipped
+   */
+  static void computeFIntBatch(double time, const std::vector<LagrangianDS*>& dss);
+
   /** allow to set a specified function to compute Fext
    *
    *  \param pluginPath std::string : the complete path to the plugin
@@ -755,6 +797,38 @@ public:
     _hasConstantFExt = false;
   }
 
+  /** allow to set a batched function to compute fExt, that computes the
+   *  external forces of all the systems that share it in one call (see
+   *  computeFExtBatch). It is used only if no (non batched) function is
+   *  set for fExt.
+   *
+   *  \param plugin a std::string of the form "fileName:functionName"
+   */
+  void setComputeFExtBatchFunction(const std::string &plugin);
+
+  /** set a batched function to compute fExt
+   *
+   *  \param fct a pointer on the plugin function
+   */
+  void setComputeFExtBatchFunction(VectorFunctionOfTimeBatch fct);
+
+  /** \return true if fExt is computed by a batched plugin */
+  inline bool hasFExtBatchFunction() const
+  {
+    return _fExt && !_hasConstantFExt && !_pluginFExt->fPtr && _pluginFExt->fBatchPtr;
+  }
+
+  /** compute the external forces of a set of systems with one call of the
+   *  batched plugin for each group of systems that share the same
+   *  function and the same sizes, as computeFIntBatch. The following call
+   *  to computeFExt of each system keeps the computed value.
+   *
+   *  \param time the current time
+   *  \param dss the systems, those without a batched plugin for fExt
+   *  are skipped
+   */
+  static void computeFExtBatch(double time, const std::vector<LagrangianDS*>& dss);
+
   /** allow to set a specified function to compute the inertia
    *
    *  \param pluginPath std::string : the complete path to the plugin
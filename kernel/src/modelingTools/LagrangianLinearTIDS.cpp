@@ -55,8 +55,15 @@ void LagrangianLinearTIDS::initRhs(double time)
   if(_K)
   {
     //  bloc10 of jacobianX is solution of Mass*Bloc10 = K
-    if(!_rhsMatrices[jacobianXBloc10])
+    // initRhs may be called more than once (simulation and osi): the
+    // blocs are always rebuilt from K and C before the solve
+    if(!_rhsMatrices[jacobianXBloc10] || _rhsMatrices[jacobianXBloc10] == _rhsMatrices[zeroMatrix])
       _rhsMatrices[jacobianXBloc10].reset(new SimpleMatrix(-1 * *_K));
+    else
+    {
+      *_rhsMatrices[jacobianXBloc10] = *_K;
+      *_rhsMatrices[jacobianXBloc10] *= -1.;
+    }
     _inverseMass->Solve(*_rhsMatrices[jacobianXBloc10]);
   }
   else
@@ -65,8 +72,13 @@ void LagrangianLinearTIDS::initRhs(double time)
   if(_C)
   {
     //  bloc11 of jacobianX is solution of Mass*Bloc11 = C
-    if(!_rhsMatrices[jacobianXBloc11])
+    if(!_rhsMatrices[jacobianXBloc11] || _rhsMatrices[jacobianXBloc11] == _rhsMatrices[zeroMatrix])
       _rhsMatrices[jacobianXBloc11].reset(new SimpleMatrix(-1 * *_C));
+    else
+    {
+      *_rhsMatrices[jacobianXBloc11] = *_C;
+      *_rhsMatrices[jacobianXBloc11] *= -1.;
+    }
     _inverseMass->Solve(*_rhsMatrices[jacobianXBloc11]);
   }
   else
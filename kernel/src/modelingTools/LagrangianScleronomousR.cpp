@@ -25,6 +25,8 @@
 
 #include "BlockVector.hpp"
 #include "SimulationGraphs.hpp"
+#include <map>
+#include <tuple>
 // #define DEBUG_MESSAGES
 // #define DEBUG_STDOUT
 // #define DEBUG_NOCOLOR
@@ -85,9 +87,48 @@ void LagrangianScleronomousR::checkSize(Interaction& inter)
 
 }
 
+void LagrangianScleronomousR::setComputehBatchFunction(const std::string& plugin)
+{
+  _pluginh->setComputeBatchFunction(plugin);
+  _pluginh->fPtr = nullptr;
+}
+
+void LagrangianScleronomousR::setComputehBatchFunction(FPtr3Batch fct)
+{
+  _pluginh->setComputeBatchFunction((void*)fct);
+  _pluginh->fPtr = nullptr;
+}
+
+void LagrangianScleronomousR::setComputeJachqBatchFunction(const std::string& plugin)
+{
+  _pluginJachq->setComputeBatchFunction(plugin);
+  _pluginJachq->fPtr = nullptr;
+}
+
+void LagrangianScleronomousR::setComputeJachqBatchFunction(FPtr3Batch fct)
+{
+  _pluginJachq->setComputeBatchFunction((void*)fct);
+  _pluginJachq->fPtr = nullptr;
+}
+
+bool LagrangianScleronomousR::hasHBatchFunction() const
+{
+  return _pluginh && !_pluginh->fPtr && _pluginh->fBatchPtr;
+}
+
+bool LagrangianScleronomousR::hasJachqBatchFunction() const
+{
+  return _pluginJachq && !_pluginJachq->fPtr && _pluginJachq->fBatchPtr;
+}
+
 void LagrangianScleronomousR::computeh(const BlockVector& q, BlockVector& z, SiconosVector& y)
 {
   DEBUG_PRINT(" LagrangianScleronomousR::computeh(Interaction& inter, SP::BlockVector q, SP::BlockVector z)\n");
+  // the value computed by computehBatch is kept
+  bool batchComputed = _hBatchComputed;
+  _hBatchComputed = false;
+  if(batchComputed)
+    return;
   if(_pluginh && _pluginh->fPtr)
   {
     auto qp = q.prepareVectorForPlugin();
@@ -97,12 +138,25 @@ void LagrangianScleronomousR::computeh(const BlockVector& q, BlockVector& z, Sic
     DEBUG_EXPR(y.display());
 
   }
+  else if(_pluginh && _pluginh->fBatchPtr)
+  {
+    auto qp = q.prepareVectorForPlugin();
+    auto zp = z.prepareVectorForPlugin();
+    // with one object, the storage component by component is the usual one
+    ((FPtr3Batch)(_pluginh->fBatchPtr))(1, qp->size(), &(*qp)(0), y.size(), &(y(0)), zp->size(), &(*zp)(0));
+    z = *zp;
+  }
   // else nothing
 }
 
 void LagrangianScleronomousR::computeJachq(const BlockVector& q, BlockVector& z)
 {
-  if(_jachq && _pluginJachq->fPtr)
+  // the value computed by computeJachqBatch is kept
+  bool batchComputed = _jachqBatchComputed;
+  _jachqBatchComputed = false;
+  if(!_jachq || batchComputed)
+    return;
+  if(_pluginJachq->fPtr)
   {
     auto qp = q.prepareVectorForPlugin();
     auto zp = z.prepareVectorForPlugin();
@@ -110,6 +164,140 @@ void LagrangianScleronomousR::computeJachq(const BlockVector& q, BlockVector& z)
     ((FPtr3)(_pluginJachq->fPtr))(qp->size(), &(*qp)(0), _jachq->size(0), &(*_jachq)(0, 0), zp->size(), &(*zp)(0));
     z = *zp;
   }
+  else if(_pluginJachq->fBatchPtr)
+  {
+    auto qp = q.prepareVectorForPlugin();
+    auto zp = z.prepareVectorForPlugin();
+    // with one object, the storage component by component is the usual one
+    ((FPtr3Batch)(_pluginJachq->fBatchPtr))(1, qp->size(), &(*qp)(0), _jachq->size(0), &(*_jachq)(0, 0), zp->size(), &(*zp)(0));
+    z = *zp;
+  }
+}
+
+/* The interactions of a batch with a scleronomous relation that has a
+ * batched plugin given by getPlugin, grouped by plugin and sizes (of q, y
+ * and z). A relation shared by several interactions of the set keeps a
+ * single value of its members and is left out. */
+typedef std::tuple<void*, unsigned int, unsigned int, unsigned int> RelationBatchKey;
+typedef std::map<RelationBatchKey, std::vector<Interaction*>> RelationBatchGroups;
+
+static RelationBatchGroups groupRelationBatch(const std::vector<Interaction*>& inters,
+                                              SP::PluggedObject(*getPlugin)(LagrangianScleronomousR&))
+{
+  std::map<Relation*, unsigned int> count;
+  for(Interaction* inter : inters)
+    count[inter->relation().get()]++;
+
+  RelationBatchGroups groups;
+  for(Interaction* inter : inters)
+  {
+    Relation& rel = *inter->relation();
+    if(rel.getType() != Lagrangian || rel.getSubType() != ScleronomousR
+       || count[&rel] > 1)
+      continue;
+    SP::PluggedObject plugin = getPlugin(static_cast<LagrangianScleronomousR&>(rel));
+    if(!plugin || plugin->fPtr || !plugin->fBatchPtr)
+      continue;
+    VectorOfBlockVectors& DSlink = inter->linkToDSVariables();
+    groups[RelationBatchKey(plugin->fBatchPtr, DSlink[LagrangianR::q0]->size(),
+                            inter->dimension(), DSlink[LagrangianR::z]->size())].push_back(inter);
+  }
+  return groups;
+}
+
+/* gather q and z of the interactions of a group, stored component by component */
+static void gatherRelationBatch(const std::vector<Interaction*>& members,
+                                unsigned int sizeQ, unsigned int sizeZ,
+                                std::vector<double>& q, std::vector<double>& z)
+{
+  unsigned int nb = members.size();
+  q.resize(nb * sizeQ);
+  z.resize(nb * sizeZ);
+  for(unsigned int k = 0; k < nb; ++k)
+  {
+    VectorOfBlockVectors& DSlink = members[k]->linkToDSVariables();
+    const BlockVector& qk = *DSlink[LagrangianR::q0];
+    const BlockVector& zk = *DSlink[LagrangianR::z];
+    for(unsigned int i = 0; i < sizeQ; ++i)
+      q[i * nb + k] = qk(i);
+    for(unsigned int i = 0; i < sizeZ; ++i)
+      z[i * nb + k] = zk(i);
+  }
+}
+
+/* scatter z, that the plugin may have modified, back to the interactions */
+static void scatterRelationBatchZ(const std::vector<Interaction*>& members,
+                                  unsigned int sizeZ, const std::vector<double>& z)
+{
+  unsigned int nb = members.size();
+  for(unsigned int k = 0; k < nb; ++k)
+  {
+    BlockVector& zk = *members[k]->linkToDSVariables()[LagrangianR::z];
+    for(unsigned int i = 0; i < sizeZ; ++i)
+      zk.setValue(i, z[i * nb + k]);
+  }
+}
+
+void LagrangianScleronomousR::computehBatch(double time, const std::vector<Interaction*>& inters)
+{
+  RelationBatchGroups groups = groupRelationBatch(inters,
+                               [](LagrangianScleronomousR& r) { return r._pluginh; });
+
+  std::vector<double> q, y, z;
+  for(auto& group : groups)
+  {
+    const std::vector<Interaction*>& members = group.second;
+    unsigned int nb = members.size();
+    unsigned int sizeQ = std::get<1>(group.first);
+    unsigned int sizeY = std::get<2>(group.first);
+    unsigned int sizeZ = std::get<3>(group.first);
+    gatherRelationBatch(members, sizeQ, sizeZ, q, z);
+    y.resize(nb * sizeY);
+
+    ((FPtr3Batch)std::get<0>(group.first))(nb, sizeQ, q.data(), sizeY, y.data(), sizeZ, z.data());
+
+    scatterRelationBatchZ(members, sizeZ, z);
+    for(unsigned int k = 0; k < nb; ++k)
+    {
+      SiconosVector& yk = *members[k]->y(0);
+      for(unsigned int i = 0; i < sizeY; ++i)
+        yk(i) = y[i * nb + k];
+      static_cast<LagrangianScleronomousR&>(*members[k]->relation())._hBatchComputed = true;
+    }
+  }
+}
+
+void LagrangianScleronomousR::computeJachqBatch(double time, const std::vector<Interaction*>& inters)
+{
+  RelationBatchGroups groups = groupRelationBatch(inters,
+                               [](LagrangianScleronomousR& r) { return r._pluginJachq; });
+
+  std::vector<double> q, jac, z;
+  for(auto& group : groups)
+  {
+    const std::vector<Interaction*>& members = group.second;
+    unsigned int nb = members.size();
+    unsigned int sizeQ = std::get<1>(group.first);
+    unsigned int sizeY = std::get<2>(group.first);
+    unsigned int sizeZ = std::get<3>(group.first);
+    gatherRelationBatch(members, sizeQ, sizeZ, q, z);
+    jac.resize(nb * sizeY * sizeQ);
+
+    ((FPtr3Batch)std::get<0>(group.first))(nb, sizeQ, q.data(), sizeY, jac.data(), sizeZ, z.data());
+
+    scatterRelationBatchZ(members, sizeZ, z);
+    for(unsigned int k = 0; k < nb; ++k)
+    {
+      LagrangianScleronomousR& rel = static_cast<LagrangianScleronomousR&>(*members[k]->relation());
+      if(!rel._jachq)
+        continue;
+      SimpleMatrix& jachq = *rel._jachq;
+      for(unsigned int j = 0; j < sizeQ; ++j)
+        for(unsigned int i = 0; i < sizeY; ++i)
+          jachq(i, j) = jac[(i + j * sizeY) * nb + k];
+      rel._jachqBatchComputed = true;
+    }
+  }
 }
 
 void LagrangianScleronomousR::computeDotJachq(const BlockVector& q, BlockVector& z, const BlockVector& qDot)
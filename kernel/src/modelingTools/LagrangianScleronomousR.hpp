@@ -132,6 +132,14 @@ protected:
   /** Product of the time--derivative of Jacobian with the velocity qdot */
   SP::SiconosVector _dotjacqhXqdot{nullptr};
 
+  /** true if y = h(q,z) has been computed by computehBatch, the next call
+   *  to computeh keeps this value */
+  bool _hBatchComputed = false;
+
+  /** true if _jachq has been computed by computeJachqBatch, the next call
+   *  to computeJachq keeps this value */
+  bool _jachqBatchComputed = false;
+
   /** reset all plugins */
   void _zeroPlugin() override;
 
@@ -188,6 +196,67 @@ public:
    */
   void checkSize(Interaction &inter) override;
 
+  /** allow to set a batched function to compute h, that computes the
+   *  outputs of all the interactions that share it in one call (see
+   *  computehBatch). It replaces the (non batched) function given to the
+   *  constructor.
+   *
+   *  \param plugin a std::string of the form "fileName:functionName"
+   */
+  void setComputehBatchFunction(const std::string &plugin);
+
+  /** set a batched function to compute h
+   *
+   *  \param fct a pointer on the plugin function
+   */
+  void setComputehBatchFunction(FPtr3Batch fct);
+
+  /** allow to set a batched function to compute the jacobian of h according
+   *  to q (see computeJachqBatch). It replaces the (non batched) function
+   *  given to the constructor.
+   *
+   *  \param plugin a std::string of the form "fileName:functionName"
+   */
+  void setComputeJachqBatchFunction(const std::string &plugin);
+
+  /** set a batched function to compute the jacobian of h according to q
+   *
+   *  \param fct a pointer on the plugin function
+   */
+  void setComputeJachqBatchFunction(FPtr3Batch fct);
+
+  /** \return true if h is computed by a batched plugin */
+  bool hasHBatchFunction() const;
+
+  /** \return true if the jacobian of h is computed by a batched plugin */
+  bool hasJachqBatchFunction() const;
+
+  /** compute y = h(q,z) for a set of interactions with one call of the
+   *  batched plugin for each group of relations that share the same
+   *  function and the same sizes (of q, y and z). The q and z of the
+   *  interactions of a group are gathered in arrays stored component by
+   *  component before the call, the results are written in y[0] of each
+   *  interaction, and the following call to computeh of each relation
+   *  keeps this value.
+   *
+   *  \param time the current time
+   *  \param inters the interactions, those without a scleronomous
+   *  relation with a batched plugin for h, or with a relation shared with
+   *  another interaction of the set, are skipped
+   */
+  static void computehBatch(double time, const std::vector<Interaction*>& inters);
+
+  /** compute the jacobian of h according to q for a set of interactions,
+   *  as computehBatch. The jacobian of each relation (sizeY X sizeQ, by
+   *  columns) is stored component by component in the array given to the
+   *  plugin, and the following call to computeJachq of each relation keeps
+   *  the value.
+   *
+   *  \param time the current time
+   *  \param inters the interactions, skipped as in computehBatch
+   */
+  static void computeJachqBatch(double time, const std::vector<Interaction*>& inters);
+
   /** \return the product of  the time--derivative of Jacobian with the velocity
    * qdot */
   inline SP::SiconosVector dotjacqhXqdot() { return _dotjacqhXqdot; };
@@ -217,6 +217,14 @@ protected:
   /** value of the step in finite difference */
   double _epsilonFD;
 
+  /** if true, the body is at rest and frozen by its integrator
+   *  (see MoreauJeanOSI::setDeactivation) */
+  bool _isSleeping = false;
+
+  /** number of consecutive steps with a velocity below the deactivation
+   *  threshold of the integrator */
+  unsigned int _restingSteps = 0;
+
   /** Plugin to compute strength of external forces */
   SP::PluggedObject _pluginFExt;
 
@@ -668,6 +676,27 @@ public:
 
   inline void setNullifyMGyr(bool value) { _nullifyMGyr = value; }
 
+  /** \return true if the body is frozen by its integrator */
+  inline bool isSleeping() const { return _isSleeping; }
+
+  /** freeze or wake up the body, the resting steps counter is reset
+   *  when the body is woken up
+   *
+   *  \param value true to freeze the body
+   */
+  inline void setSleeping(bool value)
+  {
+    _isSleeping = value;
+    if (!value)
+      _restingSteps = 0;
+  }
+
+  /** \return the number of consecutive steps spent at rest */
+  inline unsigned int restingSteps() const { return _restingSteps; }
+
+  /** \param value the number of consecutive steps spent at rest */
+  inline void setRestingSteps(unsigned int value) { _restingSteps = value; }
+
   virtual void normalizeq();
 
   /** 
@@ -126,6 +126,41 @@ void  NonSmoothDynamicalSystem::insertDynamicalSystem(SP::DynamicalSystem ds)
   }
 }
 
+void NonSmoothDynamicalSystem::insertDynamicalSystems(const std::vector<SP::DynamicalSystem>& dss,
+                                                      const std::vector<std::string>& names)
+{
+  if(!names.empty() && names.size() != dss.size())
+  {
+    THROW_EXCEPTION("NonSmoothDynamicalSystem::insertDynamicalSystems :: sizes of dss and names differ");
+  }
+
+  // add_vertex gives the descriptor of ds, new or not: one lookup in the
+  // graph per system instead of one for the check, one for the insertion
+  // and one for the name.
+  DynamicalSystemsGraph& DSG = *_topology->dSG(0);
+  bool inserted = false;
+  for(size_t i = 0; i < dss.size(); ++i)
+  {
+    const SP::DynamicalSystem& ds = dss[i];
+    if(!ds)
+    {
+      THROW_EXCEPTION("NonSmoothDynamicalSystem::insertDynamicalSystems :: DS is nul");
+    }
+    size_t size = DSG.size();
+    DynamicalSystemsGraph::VDescriptor dsgv = DSG.add_vertex(ds);
+    if(DSG.size() > size)
+    {
+      _changeLog.push_back(Change(addDynamicalSystem,ds));
+      _mIsLinear = ((ds)->isLinear() && _mIsLinear);
+      inserted = true;
+    }
+    if(!names.empty())
+      DSG.name.insert(dsgv, names[i]);
+  }
+  if(inserted)
+    _topology->setHasChanged(true);
+}
+
 void  NonSmoothDynamicalSystem::removeDynamicalSystem(SP::DynamicalSystem ds)
 {
   _topology->removeDynamicalSystem(ds);
@@ -137,6 +172,13 @@ void  NonSmoothDynamicalSystem::removeInteraction(SP::Interaction inter)
   _changeLog.push_back(Change(rmInteraction,inter));
 }
 
+void  NonSmoothDynamicalSystem::removeInteractions(const std::vector<SP::Interaction>& inters)
+{
+  _topology->removeInteractions(inters);
+  for(const SP::Interaction& inter : inters)
+    _changeLog.push_back(Change(rmInteraction,inter));
+}
+
 void NonSmoothDynamicalSystem::link(SP::Interaction inter, SP::DynamicalSystem ds1, SP::DynamicalSystem ds2)
 {
   _mIsLinear = (inter->relation()->isLinear() && _mIsLinear);
@@ -144,6 +186,16 @@ void NonSmoothDynamicalSystem::link(SP::Interaction inter, SP::DynamicalSystem d
   _changeLog.push_back(Change(addInteraction,inter));
 };
 
+void NonSmoothDynamicalSystem::link(const InteractionLinks& links)
+{
+  _topology->link(links);
+  for(const InteractionLink& l : links)
+  {
+    _mIsLinear = (std::get<0>(l)->relation()->isLinear() && _mIsLinear);
+    _changeLog.push_back(Change(addInteraction, std::get<0>(l)));
+  }
+}
+
 
 void NonSmoothDynamicalSystem::clear()
 {
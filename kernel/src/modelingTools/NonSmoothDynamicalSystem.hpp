@@ -357,6 +357,18 @@ public:
    */
   void insertDynamicalSystem(SP::DynamicalSystem ds);
 
+  /** add a set of dynamical systems into the DS graph, in one call.
+   *  Same as insertDynamicalSystem (followed by setName when names are
+   *  given) for each system, but each system is looked up once in the
+   *  graph and the topology is marked as changed once. Meant for the
+   *  import of large scenes.
+   *
+   *  \param dss the systems to add
+   *  \param names their names, either empty or of the same size as dss
+   */
+  void insertDynamicalSystems(const std::vector<SP::DynamicalSystem>& dss,
+                              const std::vector<std::string>& names = std::vector<std::string>());
+
   /** get Dynamical system number I
    *
    *  \param nb the identifier of the DynamicalSystem to get
@@ -405,6 +417,13 @@ public:
    */
   void removeInteraction(SP::Interaction inter);
 
+  /** remove several interactions from the system, with a single
+   *  update of the topology
+   *
+   *  \param inters the interactions to remove
+   */
+  void removeInteractions(const std::vector<SP::Interaction>& inters);
+
   /** get Interaction number I
    *
    *  \param nb the identifier of the Interaction to get
@@ -441,6 +460,13 @@ public:
    */
   void link(SP::Interaction inter, SP::DynamicalSystem ds1, SP::DynamicalSystem ds2 = SP::DynamicalSystem());
 
+  /** link several interactions to their dynamical systems, with a
+   *  single update of the topology
+   *
+   *  \param links the interactions and their dynamical systems
+   */
+  void link(const InteractionLinks& links);
+
   /** set the name for this Dynamical System
    *
    *  \param ds a pointer to the system
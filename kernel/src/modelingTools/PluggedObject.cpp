@@ -20,29 +20,36 @@
 #include "SSLH.hpp"
 #include "PluggedObject.hpp"
 #include <assert.h>
-PluggedObject::PluggedObject(): _pluginName("unplugged")
+PluggedObject::PluggedObject(): _pluginName("unplugged"), _batchPluginName("unplugged")
 {
   fPtr = nullptr;
+  fBatchPtr = nullptr;
 }
 
-PluggedObject::PluggedObject(const std::string& name): _pluginName(name)
+PluggedObject::PluggedObject(const std::string& name): _pluginName(name), _batchPluginName("unplugged")
 {
   fPtr = nullptr;
+  fBatchPtr = nullptr;
   setComputeFunction();
 }
 
-PluggedObject::PluggedObject(const PluggedObject & PO):  _pluginName(PO.pluginName())
+PluggedObject::PluggedObject(const PluggedObject & PO):  _pluginName(PO.pluginName()), _batchPluginName(PO._batchPluginName)
 {
   // we don't copy the fPtr since we need to increment the number of times we opened the plugin file in the openedPlugins multimap
   fPtr = nullptr;
+  fBatchPtr = nullptr;
   if((_pluginName.compare("unplugged") != 0) && (_pluginName.compare("Unknown") != 0))
     setComputeFunction();
+  if((_batchPluginName.compare("unplugged") != 0) && (_batchPluginName.compare("Unknown") != 0))
+    setComputeBatchFunction(_batchPluginName);
 }
 
 PluggedObject::~PluggedObject()
 {
   if((_pluginName.compare("unplugged") != 0) && (_pluginName.compare("Unknown") != 0))
     SSLH::closePlugin(_pluginName);
+  if((_batchPluginName.compare("unplugged") != 0) && (_batchPluginName.compare("Unknown") != 0))
+    SSLH::closePlugin(_batchPluginName);
 }
 
 void PluggedObject::setComputeFunction(const std::string& pluginPath, const std::string& functionName)
@@ -71,3 +78,9 @@ void PluggedObject::setComputeFunction(void)
   assert(_pluginName != "unplugged" && "PluggedObject::setComputeFunction error, try to plug an unnamed function.");
   SSLH::setFunction(&fPtr, SSLH::getPluginName(_pluginName), SSLH::getPluginFunctionName(_pluginName));
 }
+
+void PluggedObject::setComputeBatchFunction(const std::string& plugin)
+{
+  SSLH::setFunction(&fBatchPtr, SSLH::getPluginName(plugin), SSLH::getPluginFunctionName(plugin));
+  _batchPluginName = plugin;
+}
@@ -46,11 +46,18 @@ protected:
   /** Plugin name, should be of the form "fileName:functionName" */
   std::string _pluginName;
 
+  /** name of the batched plugin, of the form "fileName:functionName" */
+  std::string _batchPluginName;
+
 public:
 
   /** plug-in */
   void * fPtr;
 
+  /** batched plug-in, that computes the same function for a set of
+   *  objects in one call (see FPtr6Batch in PluginTypes.hpp) */
+  void * fBatchPtr;
+
   /** Default Constructor
    */
   PluggedObject();
@@ -102,6 +109,28 @@ public:
     _pluginName = "Unknown";
   };
 
+  /** Connect a batched function to fBatchPtr
+   *  \param plugin a std::string of the form "fileName:functionName", without an extension for pluginFile
+   */
+  void setComputeBatchFunction(const std::string& plugin);
+
+  /** Connect input batched function to fBatchPtr
+      \param functionPtr a pointer to a C function
+   */
+  inline void setComputeBatchFunction(void* functionPtr)
+  {
+    fBatchPtr = functionPtr;
+    _batchPluginName = "Unknown";
+  };
+
+  /** bool to checked if a batched function is connected to the current object
+   * \return a boolean, true if fBatchPtr is set
+   */
+  inline bool isBatchPlugged() const
+  {
+    return (fBatchPtr != nullptr);
+  };
+
   /** Return the name of the plugin used to compute fPtr
    * \return _pluginName (a std::string)
    */
@@ -205,3 +205,74 @@ void LagrangianDSTest::testBuildLagrangianDS5()
 
   std::cout << "--> Constructor 5 test ended with success." <<std::endl;
 }
+
+// internal forces of several systems computed with a batched plugin
+void LagrangianDSTest::testComputeFIntBatch()
+{
+  std::cout << "--> Test: computeFIntBatch." <<std::endl;
+  std::vector<SP::LagrangianDS> dss;
+  std::vector<LagrangianDS*> batch;
+  for(unsigned int k = 0; k < 4; ++k)
+  {
+    SP::SiconosVector q(new SiconosVector(*q0));
+    *q *= k + 1.;
+    SP::LagrangianDS ds(new LagrangianDS(q, velocity0, mass));
+    ds->setComputeFIntBatchFunction("TestPlugin:computeFIntBatch");
+    dss.push_back(ds);
+    batch.push_back(ds.get());
+  }
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeFIntBatch : ", dss[0]->hasFIntBatchFunction(), true);
+
+  double time = 1.;
+  LagrangianDS::computeFIntBatch(time, batch);
+  for(unsigned int k = 0; k < 4; ++k)
+  {
+    SiconosVector fInt(3);
+    for(unsigned int i = 0; i < 3; ++i)
+      fInt(i) = i * (k + 1.) * (*q0)(i) + (*velocity0)(i);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeFIntBatch : ", *dss[k]->fInt() == fInt, true);
+    // the value computed by the batch is kept
+    dss[k]->fInt()->zero();
+    dss[k]->computeFInt(time);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeFIntBatch : ", dss[k]->fInt()->norm2() == 0., true);
+    // then computed for one system by the same plugin
+    dss[k]->computeFInt(time);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeFIntBatch : ", *dss[k]->fInt() == fInt, true);
+  }
+  std::cout << "--> computeFIntBatch test ended with success." <<std::endl;
+}
+
+// external forces of several systems computed with a batched plugin
+void LagrangianDSTest::testComputeFExtBatch()
+{
+  std::cout << "--> Test: computeFExtBatch." <<std::endl;
+  std::vector<SP::LagrangianDS> dss;
+  std::vector<LagrangianDS*> batch;
+  for(unsigned int k = 0; k < 4; ++k)
+  {
+    SP::LagrangianDS ds(new LagrangianDS(q0, velocity0, mass));
+    ds->setzPtr(SP::SiconosVector(new SiconosVector(1, k)));
+    ds->setComputeFExtBatchFunction("TestPlugin:computeFExtBatch");
+    dss.push_back(ds);
+    batch.push_back(ds.get());
+  }
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeFExtBatch : ", dss[0]->hasFExtBatchFunction(), true);
+
+  double time = 2.;
+  LagrangianDS::computeFExtBatch(time, batch);
+  for(unsigned int k = 0; k < 4; ++k)
+  {
+    SiconosVector fExt(3);
+    for(unsigned int i = 0; i < 3; ++i)
+      fExt(i) = i * time + k;
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeFExtBatch : ", *dss[k]->fExt() == fExt, true);
+    // the value computed by the batch is kept
+    dss[k]->fExt()->zero();
+    dss[k]->computeFExt(time);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeFExtBatch : ", dss[k]->fExt()->norm2() == 0., true);
+    // then computed for one system by the same plugin
+    dss[k]->computeFExt(time);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeFExtBatch : ", *dss[k]->fExt() == fExt, true);
+  }
+  std::cout << "--> computeFExtBatch test ended with success." <<std::endl;
+}
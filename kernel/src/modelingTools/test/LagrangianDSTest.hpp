@@ -38,6 +38,8 @@ private:
   CPPUNIT_TEST(testBuildLagrangianDS1);
   CPPUNIT_TEST(testBuildLagrangianDS4);
   CPPUNIT_TEST(testBuildLagrangianDS5);
+  CPPUNIT_TEST(testComputeFIntBatch);
+  CPPUNIT_TEST(testComputeFExtBatch);
   CPPUNIT_TEST_SUITE_END();
 
   // \todo exception test
@@ -45,6 +47,8 @@ private:
   void testBuildLagrangianDS1();
   void testBuildLagrangianDS4();
   void testBuildLagrangianDS5();
+  void testComputeFIntBatch();
+  void testComputeFExtBatch();
   //void testcomputeDS();
 
   // Members
@@ -16,6 +16,8 @@
  * limitations under the License.
 */
 #include "LagrangianScleronomousRTest.hpp"
+#include "LagrangianDS.hpp"
+#include "NewtonImpactNSL.hpp"
 
 
 #define CPPUNIT_ASSERT_NOT_EQUAL(message, alpha, omega)      \
@@ -41,3 +43,77 @@ void LagrangianScleronomousRTest::testBuildLagrangianScleronomousR2()
   std::cout << " data Constructor LagrangianScleronomousR ok" <<std::endl;
 }
 
+// h and its jacobian computed for several interactions with batched plugins
+void LagrangianScleronomousRTest::testComputeBatch()
+{
+  std::cout << "--> Test: computeBatch." <<std::endl;
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0., 1.));
+  SP::NonSmoothLaw nslaw(new NewtonImpactNSL(0.));
+  std::vector<SP::LagrangianDS> dss;
+  std::vector<SP::Interaction> inters;
+  std::vector<Interaction*> batch;
+  for(unsigned int k = 0; k < 6; ++k)
+  {
+    SP::SiconosVector q(new SiconosVector(3));
+    for(unsigned int j = 0; j < 3; ++j)
+      (*q)(j) = (k + 1.) * (j + 1.);
+    SP::SiconosVector v(new SiconosVector(3));
+    SP::LagrangianDS ds(new LagrangianDS(q, v));
+    // the last two interactions share their relation
+    SP::LagrangianScleronomousR R;
+    if(k < 5)
+    {
+      R.reset(new LagrangianScleronomousR("TestPlugin:hSclero", "TestPlugin:G0Sclero"));
+      R->setComputehBatchFunction("TestPlugin:hScleroBatch");
+      R->setComputeJachqBatchFunction("TestPlugin:G0ScleroBatch");
+    }
+    else
+      R = std::static_pointer_cast<LagrangianScleronomousR>(inters[4]->relation());
+    SP::Interaction inter(new Interaction(nslaw, R));
+    nsds->insertDynamicalSystem(ds);
+    nsds->link(inter, ds);
+    inter->initializeLinkToDsVariables(*ds, *ds);
+    dss.push_back(ds);
+    inters.push_back(inter);
+    batch.push_back(inter.get());
+  }
+  SP::LagrangianScleronomousR R0 = std::static_pointer_cast<LagrangianScleronomousR>(inters[0]->relation());
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeBatch : ", R0->hasHBatchFunction(), true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeBatch : ", R0->hasJachqBatchFunction(), true);
+
+  double time = 0.;
+  LagrangianScleronomousR::computehBatch(time, batch);
+  LagrangianScleronomousR::computeJachqBatch(time, batch);
+  for(unsigned int k = 0; k < 6; ++k)
+  {
+    LagrangianScleronomousR& R = static_cast<LagrangianScleronomousR&>(*inters[k]->relation());
+    SiconosVector& y = *inters[k]->y(0);
+    double h = 14. * (k + 1.);
+    SimpleMatrix G0(1, 3);
+    for(unsigned int j = 0; j < 3; ++j)
+      G0(0, j) = (k + 1.) * (j + 1.) * (j + 1.);
+    if(k < 4)
+    {
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeBatch : ", y(0) == h, true);
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeBatch : ", *R.jachq() == G0, true);
+      // the values computed by the batch are kept
+      y.zero();
+      R.jachq()->zero();
+      inters[k]->computeOutput(time, 0);
+      R.computeJach(time, *inters[k]);
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeBatch : ", y(0) == 0., true);
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeBatch : ", R.jachq()->normInf() == 0., true);
+    }
+    else
+    {
+      // a relation shared by two interactions is not computed by the batch
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeBatch : ", y(0) == 0., true);
+    }
+    // then computed for one interaction by the same plugins
+    inters[k]->computeOutput(time, 0);
+    R.computeJach(time, *inters[k]);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeBatch : ", y(0) == h, true);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testComputeBatch : ", *R.jachq() == G0, true);
+  }
+  std::cout << "--> computeBatch test ended with success." <<std::endl;
+}
@@ -36,12 +36,14 @@ private:
   // tests to be done ...
 
   CPPUNIT_TEST(testBuildLagrangianScleronomousR2);
+  CPPUNIT_TEST(testComputeBatch);
   CPPUNIT_TEST_SUITE_END();
 
   // \todo exception test
 
   void testBuildLagrangianScleronomousR0();
   void testBuildLagrangianScleronomousR2();
+  void testComputeBatch();
 
 public:
   void setUp();
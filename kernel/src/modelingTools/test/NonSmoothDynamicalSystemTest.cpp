@@ -74,6 +74,41 @@ void NonSmoothDynamicalSystemTest::testinsertDynamicalSystem()
   std::cout << "------- test insertDynamicalSystem ok -------" <<std::endl;
 }
 
+// insertDynamicalSystems
+void NonSmoothDynamicalSystemTest::testinsertDynamicalSystems()
+{
+  SP::NonSmoothDynamicalSystem  nsds(new NonSmoothDynamicalSystem(0., 10.));
+
+  std::vector<SP::DynamicalSystem> dss;
+  std::vector<std::string> names;
+  for(unsigned int i = 0; i < 3; ++i)
+  {
+    SP::DynamicalSystem ds(new LagrangianDS(std::make_shared<SiconosVector>(3),
+                                            std::make_shared<SiconosVector>(3)));
+    ds->setNumber(10 + i);
+    dss.push_back(ds);
+    names.push_back("ds" + std::to_string(i));
+  }
+  // duplicates must be ignored
+  nsds->insertDynamicalSystem(dss[0]);
+  nsds->insertDynamicalSystems(dss, names);
+
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testinsertDynamicalSystemsA: ", nsds->getNumberOfDS() == 3, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testinsertDynamicalSystemsB: ", nsds->dynamicalSystem(12) == dss[2], true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testinsertDynamicalSystemsC: ", nsds->topology()->getDynamicalSystem("ds1") == dss[1], true);
+  // one change per system actually inserted
+  unsigned int added = 0;
+  for(const NonSmoothDynamicalSystem::Change& change : nsds->changeLog())
+    if(change.typeOfChange == NonSmoothDynamicalSystem::addDynamicalSystem)
+      added++;
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testinsertDynamicalSystemsD: ", added, 3u);
+
+  names.pop_back();
+  CPPUNIT_ASSERT_THROW(nsds->insertDynamicalSystems(dss, names), Siconos::exception);
+
+  std::cout << "------- test insertDynamicalSystems ok -------" <<std::endl;
+}
+
 // insertInteraction
 void NonSmoothDynamicalSystemTest::testinsertInteraction()
 {
@@ -181,3 +216,73 @@ void NonSmoothDynamicalSystemTest::testremoveInteraction()
 
   std::cout << "------- test removeInteraction ok -------" <<std::endl;
 }
+
+void NonSmoothDynamicalSystemTest::testlinkInteractions()
+{
+  SP::NonSmoothDynamicalSystem  nsds(new NonSmoothDynamicalSystem(0., 10.));
+
+  std::vector<SP::DynamicalSystem> ds(3);
+  for(unsigned int i = 0; i < 3; ++i)
+  {
+    ds[i].reset(new LagrangianDS(std::make_shared<SiconosVector>(3),
+                                 std::make_shared<SiconosVector>(3)));
+    nsds->insertDynamicalSystem(ds[i]);
+  }
+
+  SP::NonSmoothLaw nsl(new NewtonImpactNSL(0.0));
+  std::vector<SP::Interaction> inter(4);
+  for(unsigned int i = 0; i < 3; ++i)
+    inter[i].reset(new Interaction(nsl, std::make_shared<LagrangianLinearTIR>(std::make_shared<SimpleMatrix>(1,6))));
+  inter[3].reset(new Interaction(nsl, std::make_shared<LagrangianLinearTIR>(std::make_shared<SimpleMatrix>(1,3))));
+
+  InteractionLinks links;
+  links.emplace_back(inter[0], ds[0], ds[1]);
+  links.emplace_back(inter[1], ds[1], ds[2]);
+  links.emplace_back(inter[2], ds[0], ds[1]);
+  links.emplace_back(inter[3], ds[2], SP::DynamicalSystem());
+  nsds->topology()->setHasChanged(false);
+  nsds->link(links);
+
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsA: ", nsds->getNumberOfInteractions() == 4, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsB: ", nsds->topology()->hasChanged(), true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsC: ", nsds->dynamicalSystems()->edges_number() == 4, true);
+  // inter[0] and inter[2] share ds[0] and ds[1], inter[1] shares ds[1]
+  // with both of them and ds[2] with inter[3]
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsD: ", nsds->interactions()->edges_number() == 5, true);
+
+  std::vector<SP::Interaction> removed = { inter[0], inter[3], inter[2] };
+  nsds->topology()->setHasChanged(false);
+  nsds->removeInteractions(removed);
+
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsE: ", nsds->getNumberOfInteractions() == 1, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsF: ", nsds->topology()->hasChanged(), true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsG: ", nsds->interactions()->is_vertex(inter[1]), true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsH: ", nsds->dynamicalSystems()->edges_number() == 1, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsI: ", nsds->interactions()->edges_number() == 0, true);
+
+  // inter[1] is already linked: it is moved to ds[0] and ds[2]
+  InteractionLinks relinks;
+  relinks.emplace_back(inter[1], ds[0], ds[2]);
+  relinks.emplace_back(inter[0], ds[0], SP::DynamicalSystem());
+  nsds->link(relinks);
+
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsJ: ", nsds->getNumberOfInteractions() == 2, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsK: ", nsds->dynamicalSystems()->edges_number() == 2, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsL: ", nsds->interactions()->edges_number() == 1, true);
+  SP::InteractionsGraph IG = nsds->interactions();
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsM: ", IG->properties(IG->descriptor(inter[1])).source == ds[0], true);
+
+  // inter[2] given twice: it is linked once, with its last dynamical systems
+  InteractionLinks duplicates;
+  duplicates.emplace_back(inter[2], ds[1], ds[2]);
+  duplicates.emplace_back(inter[1], ds[0], ds[2]);
+  duplicates.emplace_back(inter[2], ds[2], SP::DynamicalSystem());
+  nsds->link(duplicates);
+
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsN: ", nsds->getNumberOfInteractions() == 3, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsO: ", nsds->dynamicalSystems()->edges_number() == 3, true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsP: ", IG->properties(IG->descriptor(inter[2])).source == ds[2], true);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE(" testlinkInteractionsQ: ", inter[2]->getSizeOfDS() == 3, true);
+
+  std::cout << "------- test linkInteractions ok -------" <<std::endl;
+}
@@ -37,17 +37,21 @@ private:
 
   //CPPUNIT_TEST(testBuildNonSmoothDynamicalSystem);
   CPPUNIT_TEST(testinsertDynamicalSystem);
+  CPPUNIT_TEST(testinsertDynamicalSystems);
   CPPUNIT_TEST(testinsertInteraction);
   CPPUNIT_TEST(testremoveDynamicalSystem);
   CPPUNIT_TEST(testremoveInteraction);
+  CPPUNIT_TEST(testlinkInteractions);
   CPPUNIT_TEST_SUITE_END();
 
   // \todo exception test
 
   void testinsertDynamicalSystem();
+  void testinsertDynamicalSystems();
   void testinsertInteraction();
   void testremoveDynamicalSystem();
   void testremoveInteraction();
+  void testlinkInteractions();
 
 public:
   void setUp();
@@ -29,6 +29,11 @@ typedef void (*MatrixFunctionOfTime)(double, unsigned int, unsigned int, double*
 /** Pointer to function used for plug-in for vector-type operators that depends only on time */
 typedef void (*VectorFunctionOfTime)(double, unsigned int, double*, unsigned int, double*);
 
+/** batched version of VectorFunctionOfTime, for a number of objects with
+ *  the same sizes (time, number of objects, size, output, size of z, z),
+ *  the arrays are stored component by component as for FPtr6Batch. */
+typedef void (*VectorFunctionOfTimeBatch)(double, unsigned int, unsigned int, double*, unsigned int, double*);
+
 /** */
 typedef void (*FPtr1)(double, unsigned int, double*, double*, unsigned int, double*);
 
@@ -38,6 +43,11 @@ typedef void (*FPtr2)(unsigned int, double*, unsigned int, double*, double*, uns
 /** */
 typedef void (*FPtr3)(unsigned int, double*, unsigned int, double*, unsigned int, double*);
 
+/** batched version of FPtr3, for a number of objects with the same sizes
+ *  (number of objects, size of q, q, size of y, output, size of z, z),
+ *  the arrays are stored component by component as for FPtr6Batch. */
+typedef void (*FPtr3Batch)(unsigned int, unsigned int, double*, unsigned int, double*, unsigned int, double*);
+
 typedef void (*FPtr4bis)(unsigned int, double*, unsigned int, double*, unsigned int, double*, unsigned int, double*);
 
 /** */
@@ -51,6 +61,12 @@ typedef void (*FPtr5bis)(unsigned int, double*, unsigned int, double*, unsigned
 /** */
 typedef void (*FPtr6)(double, unsigned int, double*, double*, double*, unsigned int, double*);
 
+/** batched version of FPtr6, for a number of objects with the same sizes
+ *  (time, number of objects, size, q, velocity, output, size of z, z).
+ *  The arrays are stored component by component: q[i * nbObjects + k] is
+ *  the component i of the object k. */
+typedef void (*FPtr6Batch)(double, unsigned int, unsigned int, double*, double*, double*, unsigned int, double*);
+
 /** */
 typedef void (*FPtr7)(unsigned int, double*, double*, unsigned int, double*);
 
@@ -69,6 +69,14 @@ extern "C" DLLEXPORT void computeFInt(double time, unsigned int sizeOfq, double
     fInt[i] = i * q[i];
 }
 
+extern "C" DLLEXPORT void computeFIntBatch(double time, unsigned int nbObjects, unsigned int sizeOfq, double *q, double *velocity, double *fInt, unsigned int sizeZ, double * z);
+extern "C" DLLEXPORT void computeFIntBatch(double time, unsigned int nbObjects, unsigned int sizeOfq, double *q, double *velocity, double *fInt, unsigned int sizeZ, double * z)
+{
+  for(unsigned int i = 0; i < sizeOfq; ++i)
+    for(unsigned int k = 0; k < nbObjects; ++k)
+      fInt[i * nbObjects + k] = i * q[i * nbObjects + k] + velocity[i * nbObjects + k];
+}
+
 extern "C" DLLEXPORT void computeFExt(double time, unsigned int sizeOfq, double *fExt, unsigned int sizeOfZ, double *z);
 extern "C" DLLEXPORT void computeFExt(double time, unsigned int sizeOfq, double *fExt, unsigned int sizeOfZ, double *z)
 {
@@ -76,6 +84,14 @@ extern "C" DLLEXPORT void computeFExt(double time, unsigned int sizeOfq, double
     fExt[i] = i * time;
 }
 
+extern "C" DLLEXPORT void computeFExtBatch(double time, unsigned int nbObjects, unsigned int sizeOfq, double *fExt, unsigned int sizeOfZ, double *z);
+extern "C" DLLEXPORT void computeFExtBatch(double time, unsigned int nbObjects, unsigned int sizeOfq, double *fExt, unsigned int sizeOfZ, double *z)
+{
+  for(unsigned int i = 0; i < sizeOfq; ++i)
+    for(unsigned int k = 0; k < nbObjects; ++k)
+      fExt[i * nbObjects + k] = i * time + z[k];
+}
+
 extern "C" DLLEXPORT void computeFGyr(unsigned int sizeOfq, double *q, double *velocity, double *FGyr, unsigned int sizeOfZ, double *z);
 extern "C" DLLEXPORT void computeFGyr(unsigned int sizeOfq, double *q, double *velocity, double *FGyr, unsigned int sizeOfZ, double *z)
 {
@@ -144,6 +160,25 @@ extern "C" DLLEXPORT void G0Sclero(unsigned int sizeDS, double* q, unsigned int
   printf("Call of the function 'G0' of the test plugin.\n");
 }
 
+extern "C" DLLEXPORT void hScleroBatch(unsigned int nbObjects, unsigned int sizeDS, double* q, unsigned int sizeY, double* y, unsigned int sizeZ, double* z);
+extern "C" DLLEXPORT void hScleroBatch(unsigned int nbObjects, unsigned int sizeDS, double* q, unsigned int sizeY, double* y, unsigned int sizeZ, double* z)
+{
+  for(unsigned int k = 0; k < nbObjects; ++k)
+  {
+    y[k] = 0.;
+    for(unsigned int j = 0; j < sizeDS; ++j)
+      y[k] += (j + 1) * q[j * nbObjects + k];
+  }
+}
+
+extern "C" DLLEXPORT void G0ScleroBatch(unsigned int nbObjects, unsigned int sizeDS, double* q, unsigned int sizeY, double* G0, unsigned int sizeZ, double* z);
+extern "C" DLLEXPORT void G0ScleroBatch(unsigned int nbObjects, unsigned int sizeDS, double* q, unsigned int sizeY, double* G0, unsigned int sizeZ, double* z)
+{
+  for(unsigned int j = 0; j < sizeDS; ++j)
+    for(unsigned int k = 0; k < nbObjects; ++k)
+      G0[j * sizeY * nbObjects + k] = (j + 1) * q[j * nbObjects + k];
+}
+
 //==================  LagrangianRheonomousR ==================
 
 extern "C" DLLEXPORT void hRheo(unsigned int, double*, double, unsigned int, double*, unsigned int, double*);
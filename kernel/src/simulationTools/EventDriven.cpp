@@ -418,19 +418,21 @@ void EventDriven::computef(OneStepIntegrator& osi, integer * sizeOfX, doublereal
   lsodar.fillXWork(sizeOfX, x);
 
   double t = *time;
-  // Update Jacobian matrices at all interactions
-  InteractionsGraph::VIterator ui, uiend;
-  for(std::tie(ui, uiend) = _indexSet0->vertices(); ui != uiend; ++ui)
-  {
-    Interaction& inter = *_indexSet0->bundle(*ui);
-    inter.relation()->computeJach(t, inter);
-  }
 
   // solve a LCP at "acceleration" level if required
   if(!_allNSProblems->empty())
   {
     if(((*_allNSProblems)[SICONOS_OSNSP_ED_SMOOTH_ACC]->hasInteractions()))
     {
+      // Update Jacobian matrices at all interactions. They are only
+      // needed by the LCP and the input, i.e. when some contacts are
+      // active: most of the calls to this function are done in free flight.
+      InteractionsGraph::VIterator ui, uiend;
+      for(std::tie(ui, uiend) = _indexSet0->vertices(); ui != uiend; ++ui)
+      {
+        Interaction& inter = *_indexSet0->bundle(*ui);
+        inter.relation()->computeJach(t, inter);
+      }
       // Update the state of the DS
       (*_allNSProblems)[SICONOS_OSNSP_ED_SMOOTH_ACC]->compute(t);
       _nsds->updateInput(t,2); // Necessary to compute DS state below
@@ -445,31 +447,7 @@ void EventDriven::computef(OneStepIntegrator& osi, integer * sizeOfX, doublereal
   // Update Index sets? No !!
 
   // Get the required value, ie xdot for output.
-  unsigned pos = 0;
-
-  DynamicalSystemsGraph::VIterator dsi, dsend;
-  SP::DynamicalSystemsGraph osiDSGraph = lsodar.dynamicalSystemsGraph();
-  for(std::tie(dsi, dsend) = osiDSGraph->vertices(); dsi != dsend; ++dsi)
-  {
-    if(!(lsodar.checkOSI(dsi))) continue;
-
-    DynamicalSystem& ds = *(osiDSGraph->bundle(*dsi));
-    Type::Siconos dsType = Type::value(ds);
-    if(dsType == Type::LagrangianDS || dsType == Type::LagrangianLinearTIDS)
-    {
-      LagrangianDS& LDS = static_cast<LagrangianDS&>(ds);
-      SiconosVector& qDotTmp = *LDS.velocity();
-      SiconosVector& qDotDotTmp = *LDS.acceleration();
-      pos += qDotTmp.copyData(&xdot[pos]);
-      pos += qDotDotTmp.copyData(&xdot[pos]);
-    }
-    else
-    {
-      SiconosVector& xtmp2 = ds.getRhs(); // Pointer link !
-      //DEBUG_EXPR(xtmp2.display(););
-      pos += xtmp2.copyData(&xdot[pos]);
-    }
-  }
+  lsodar.fillXdot(sizeOfX, xdot);
   DEBUG_END("EventDriven::computef(OneStepIntegrator& osi, integer * sizeOfX, doublereal * time, doublereal * x, doublereal * xdot)\n");
 
 }
@@ -478,7 +456,8 @@ void EventDriven::computeJacobianfx(OneStepIntegrator& osi,
                                     integer *sizeOfX,
                                     doublereal *time,
                                     doublereal *x,
-                                    doublereal *jacob)
+                                    doublereal *jacob,
+                                    integer *nrowpd)
 {
   assert(osi.getType() == OSI::LSODAROSI);
 
@@ -499,10 +478,17 @@ void EventDriven::computeJacobianfx(OneStepIntegrator& osi,
   lsodar.computeJacobianRhs(t, *_DSG0);
 
   // Save jacobianX values from dynamical system into current jacob
-  // (in-out parameter)
-
-  unsigned int i = 0;
-  unsigned pos = 0;
+  // (in-out parameter). The ds are not coupled in the rhs: the jacobian
+  // is block diagonal, each block starts at the position of the state
+  // of its ds in x. Lsodar zeroes jacob before the call.
+  // In full storage, the element (i, j) of the jacobian is in the row i
+  // of the column j, in band storage (jt = 4) it is in the row
+  // i - j + mu of the column j.
+  integer ld = *nrowpd;
+  bool banded = lsodar.bandedJacobian();
+  integer mu = banded ? lsodar.getIwork()[1] : 0;
+
+  unsigned int pos = 0;
   DynamicalSystemsGraph::VIterator dsi, dsend;
   SP::DynamicalSystemsGraph osiDSGraph = lsodar.dynamicalSystemsGraph();
   for(std::tie(dsi, dsend) = osiDSGraph->vertices(); dsi != dsend; ++dsi)
@@ -511,26 +497,36 @@ void EventDriven::computeJacobianfx(OneStepIntegrator& osi,
 
     DynamicalSystem& ds = *(osiDSGraph->bundle(*dsi));
     Type::Siconos dsType = Type::value(ds);
+    unsigned int size;
     if(dsType == Type::LagrangianDS || dsType == Type::LagrangianLinearTIDS)
     {
       LagrangianDS& lds = static_cast<LagrangianDS&>(ds);
       BlockMatrix& jacotmp = static_cast<BlockMatrix&>(*lds.jacobianRhsx());
-      for(unsigned int j = 0; j < lds.n(); ++j)
-      {
-        for(unsigned int k = 0; k < lds.dimension(); ++k)
-          jacob[i++] = jacotmp(k, j);
-      }
+      size = 2 * lds.dimension();
+      for(unsigned int j = 0; j < size; ++j)
+        for(unsigned int k = 0; k < size; ++k)
+        {
+          integer row = banded ? (integer)k - (integer)j + mu : (integer)(pos + k);
+          jacob[row + (pos + j) * ld] = jacotmp(k, j);
+        }
     }
     else if(dsType == Type::FirstOrderNonLinearDS || dsType == Type::FirstOrderLinearDS
             || dsType == Type::FirstOrderLinearTIDS)
     {
       SimpleMatrix& jacotmp = static_cast<SimpleMatrix&>(*(ds.jacobianRhsx())); // Pointer link !
-      pos += jacotmp.copyData(&jacob[pos]);
+      size = ds.dimension();
+      for(unsigned int j = 0; j < size; ++j)
+        for(unsigned int k = 0; k < size; ++k)
+        {
+          integer row = banded ? (integer)k - (integer)j + mu : (integer)(pos + k);
+          jacob[row + (pos + j) * ld] = jacotmp(k, j);
+        }
     }
     else
     {
       THROW_EXCEPTION("EventDriven::computeJacobianfx, type of DynamicalSystem not yet supported.");
     }
+    pos += size;
   }
 }
 
@@ -569,21 +565,24 @@ void EventDriven::computeg(SP::OneStepIntegrator osi,
      computef(osi, sizeOfX,time,x,xdottmp);
      free(xdottmp);
      */
-  // Update the output from level 0 to level 1
-  _nsds->updateOutput(t,0);
-  _nsds->updateOutput(t,1);
-  _nsds->updateOutput(t,2);
-  //
+  // g is evaluated many times by the root finding of the integrator: the
+  // outputs are computed in a single pass through indexSet0, and only at
+  // the levels read below. y[0] is always needed, y[1] only for an open
+  // contact with y[0] <= _TOL_ED, y[2] only for a closed contact.
+  // The outputs of all levels are updated after the integration, in
+  // advanceToEvent.
   for(std::tie(ui, uiend) = _indexSet0->vertices(); ui != uiend; ++ui)
   {
     SP::Interaction inter = _indexSet0->bundle(*ui);
     nsLawSize = inter->nonSmoothLaw()->size();
+    inter->computeOutput(t, 0);
     y = inter->y(0);   // output y at this Interaction
     ydot = inter->y(1); // output of level 1 at this Interaction
     yddot = inter->y(2);
     lambda = inter->lambda(2); // input of level 2 at this Interaction
     if(!(indexSet2->is_vertex(inter)))  // if Interaction is not in the indexSet[2]
     {
+      bool ydotUpdated = false;
       for(unsigned int i = 0; i < nsLawSize; ++i)
       {
         if((*y)(i) > _TOL_ED)
@@ -592,6 +591,11 @@ void EventDriven::computeg(SP::OneStepIntegrator osi,
         }
         else
         {
+          if(!ydotUpdated)
+          {
+            inter->computeOutput(t, 1);
+            ydotUpdated = true;
+          }
           if((*ydot)(i) > -_TOL_ED)
           {
             gOut[k] = 100 * _TOL_ED;
@@ -606,6 +610,7 @@ void EventDriven::computeg(SP::OneStepIntegrator osi,
     }
     else // If Interaction is in the indexSet[2]
     {
+      inter->computeOutput(t, 2);
       for(unsigned int i = 0; i < nsLawSize; ++i)
       {
         if((*lambda)(i) > _TOL_ED)
@@ -239,10 +239,13 @@ public:
    *  \param sizeOfX size of vector x
    *  \param time current time given by the integrator
    *  \param x state vector
-   *  \param jacob jacobian of f according to x
+   *  \param jacob jacobian of f according to x, full (column major) or
+   *  band storage, see LsodarOSI::setBandedJacobian
+   *  \param nrowpd leading dimension of jacob
    */
   void computeJacobianfx(OneStepIntegrator &osi, integer *sizeOfX,
-                         doublereal *time, doublereal *x, doublereal *jacob);
+                         doublereal *time, doublereal *x, doublereal *jacob,
+                         integer *nrowpd);
 
   /** compute the size of constraint function g(x,t,...) for osi
    *
@@ -239,6 +239,47 @@ void EventsManager::update(Simulation& sim)
     _k++;
 }
 
+void EventsManager::setCurrentTimeStep(double h)
+{
+  changeTimeStep(_k, h);
+}
+
+void EventsManager::setNextTimeStep(double h)
+{
+  changeTimeStep(_k + 1, h);
+}
+
+void EventsManager::changeTimeStep(unsigned int k, double h)
+{
+  _td->setCurrentTimeStep(k, h);
+
+  // the current event will be rescheduled with the new time step
+  if(_events[0]->getType() == TD_EVENT && _events[0]->getTimeDiscretisation() == _td)
+    _events[0]->setTimeDiscretisation(_td);
+
+  // remove the pending events of the time discretisation ...
+  EventsContainer moved;
+  for(EventsContainer::iterator it = _events.begin() + 1; it != _events.end();)
+  {
+    if((*it)->getType() == TD_EVENT && (*it)->getTimeDiscretisation() == _td)
+    {
+      moved.push_back(*it);
+      it = _events.erase(it);
+    }
+    else
+      ++it;
+  }
+
+  // ... and insert them back at their new time instant
+  for(EventsContainer::iterator it = moved.begin(); it != moved.end(); ++it)
+  {
+    Event& ev = **it;
+    ev.setTimeDiscretisation(_td);
+    ev.setTime(_td->getTk(ev.getK()));
+    insertEv(*it);
+  }
+}
+
 unsigned int EventsManager::insertEv(SP::Event e)
 {
   mpz_t *t1 = const_cast<mpz_t*>(e->getTimeOfEvent());
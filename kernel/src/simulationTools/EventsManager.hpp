@@ -102,6 +102,14 @@ protected:
    */
   unsigned int insertEv(SP::Event e);
 
+  /** Change the time step of the TimeDiscretisation from the instant t_k
+   *  and move the pending TD events to the new instants.
+   *
+   *  \param k the index of the first instant kept
+   *  \param h the new time step
+   */
+  void changeTimeStep(unsigned int k, double h);
+
   /** Update the set of events
    *
    *  \param sim the Simulation using this EventsManager
@@ -309,6 +317,20 @@ public:
     return _td->currentTimeStep(_k);
   }
 
+  /** Change the time step of the TimeDiscretisation from the current
+   *  instant t_k: the pending TD events are moved to the new instants.
+   *
+   *  \param h the new time step
+   */
+  void setCurrentTimeStep(double h);
+
+  /** Change the time step of the TimeDiscretisation from the next
+   *  instant t_{k+1}, which is kept.
+   *
+   *  \param h the new time step
+   */
+  void setNextTimeStep(double h);
+
   /** get TimeDiscretisation
    *
    *  \return the TimeDiscretisation in use for the time integration
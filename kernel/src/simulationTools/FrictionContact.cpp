@@ -22,8 +22,11 @@
 #include "NewtonImpactFrictionNSL.hpp"
 #include "OSNSMatrix.hpp"
 #include "NonSmoothDrivers.h" // from numerics, for fcX_driver
+#include "SparseBlockMatrix.h" // from numerics, for SparseBlockStructuredMatrix
+#include "SolverOptions.h" // from numerics, for solver_options_copy
 #include <fc2d_Solvers.h>
 #include <fc3d_Solvers.h>
+#include <cstdlib>
 
 using namespace RELATION;
 
@@ -135,6 +138,10 @@ int FrictionContact::solve(SP::FrictionContactProblem problem)
 {
   if(!problem)
   {
+    NM_types storage = _M->numericsMatrix()->storageType;
+    if(_islands.size() > 1 &&
+        (storage == NM_DENSE || storage == NM_SPARSE_BLOCK))
+      return solveIslands();
     problem = frictionContactProblem();
   }
 
@@ -146,6 +153,134 @@ int FrictionContact::solve(SP::FrictionContactProblem problem)
 
 
 
+int FrictionContact::solveIslands()
+{
+  InteractionsGraph& indexSet = *simulation()->indexSet(indexSetLevel());
+  NumericsMatrix& M = *_M->numericsMatrix();
+  SolverOptions& options = *_numerics_solver_options;
+  int dim = _contactProblemDim;
+  int nbIslands = _islands.size();
+  std::vector<int> islandInfo(nbIslands), islandIter(nbIslands);
+  std::vector<double> islandResidu(nbIslands);
+
+  // position of each interaction in its island, for the sparse block
+  // storage (the islands are disjoint, each one uses its own entries)
+  std::vector<int> localIndex(indexSet.size(), -1);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic, 1)
+#endif
+  for(int c = 0; c < nbIslands; ++c)
+  {
+    const std::vector<InteractionsGraph::VDescriptor>& island = _islands[c];
+    unsigned int nc = island.size();
+    unsigned int n = nc * dim;
+    std::vector<unsigned int> positions(nc);
+    std::vector<double> q(n), z(n), w(n), mu(nc);
+    for(unsigned int k = 0; k < nc; ++k)
+    {
+      positions[k] = indexSet.properties(island[k]).absolute_position;
+      localIndex[indexSet.index(island[k])] = k;
+      mu[k] = (*_mu)[positions[k] / dim];
+      for(int i = 0; i < dim; ++i)
+      {
+        q[k * dim + i] = _q->getValue(positions[k] + i);
+        z[k * dim + i] = _z->getValue(positions[k] + i);
+      }
+    }
+
+    // the matrix of the island: a copy of the dense blocks, or a view on
+    // the blocks of the sparse block matrix
+    SP::NumericsMatrix islandM;
+    SparseBlockStructuredMatrix view;
+    std::vector<unsigned int> blocksize(nc);
+    std::vector<size_t> index1(nc + 1);
+    std::vector<size_t> index2;
+    std::vector<double*> blocks;
+    if(M.storageType == NM_DENSE)
+    {
+      islandM.reset(NM_create(NM_DENSE, n, n), NM_free);
+      for(unsigned int kc = 0; kc < nc; ++kc)
+        for(int j = 0; j < dim; ++j)
+          for(unsigned int kr = 0; kr < nc; ++kr)
+            for(int i = 0; i < dim; ++i)
+              islandM->matrix0[kr * dim + i + (kc * dim + j) * n] =
+                M.matrix0[positions[kr] + i + (positions[kc] + j) * M.size0];
+    }
+    else
+    {
+      SparseBlockStructuredMatrix& sbm = *M.matrix1;
+      for(unsigned int k = 0; k < nc; ++k)
+      {
+        size_t row = indexSet.index(island[k]);
+        blocksize[k] = (k + 1) * dim;
+        index1[k] = index2.size();
+        for(size_t b = sbm.index1_data[row]; b < sbm.index1_data[row + 1]; ++b)
+        {
+          assert(localIndex[sbm.index2_data[b]] >= 0);
+          index2.push_back(localIndex[sbm.index2_data[b]]);
+          blocks.push_back(sbm.block[b]);
+        }
+      }
+      index1[nc] = index2.size();
+      SBM_null(&view);
+      view.nbblocks = blocks.size();
+      view.block = blocks.data();
+      view.blocknumber0 = view.blocknumber1 = nc;
+      view.blocksize0 = view.blocksize1 = blocksize.data();
+      view.filled1 = nc + 1;
+      view.filled2 = index2.size();
+      view.index1_data = index1.data();
+      view.index2_data = index2.data();
+      islandM.reset(NM_new(), NM_free_not_SBM);
+      islandM->storageType = NM_SPARSE_BLOCK;
+      islandM->size0 = islandM->size1 = n;
+      islandM->matrix1 = &view;
+    }
+
+    FrictionContactProblem problem;
+    problem.dimension = dim;
+    problem.numberOfContacts = nc;
+    problem.M = islandM.get();
+    problem.q = q.data();
+    problem.mu = mu.data();
+
+    // each island has its own options, the solvers keep their working
+    // memory and their results in them
+    SolverOptions* islandOptions = solver_options_copy(&options);
+    islandInfo[c] = (*_frictionContact_driver)(&problem, z.data(), w.data(), islandOptions);
+    islandIter[c] = islandOptions->iparam[SICONOS_IPARAM_ITER_DONE];
+    islandResidu[c] = islandOptions->dparam[SICONOS_DPARAM_RESIDU];
+    solver_options_delete(islandOptions);
+    free(islandOptions);
+
+    for(unsigned int k = 0; k < nc; ++k)
+    {
+      localIndex[indexSet.index(island[k])] = -1;
+      for(int i = 0; i < dim; ++i)
+      {
+        _z->setValue(positions[k] + i, z[k * dim + i]);
+        _w->setValue(positions[k] + i, w[k * dim + i]);
+      }
+    }
+    if(M.storageType == NM_SPARSE_BLOCK)
+      free(view.diagonal_blocks);
+  }
+
+  int info = 0;
+  int iter = 0;
+  double residu = 0.;
+  for(int c = 0; c < nbIslands; ++c)
+  {
+    iter = std::max(iter, islandIter[c]);
+    residu = std::max(residu, islandResidu[c]);
+    if(!info)
+      info = islandInfo[c];
+  }
+  options.iparam[SICONOS_IPARAM_ITER_DONE] = iter;
+  options.dparam[SICONOS_DPARAM_RESIDU] = residu;
+  return info;
+}
 
 bool FrictionContact::checkCompatibleNSLaw(NonSmoothLaw& nslaw)
 {
@@ -64,6 +64,11 @@ TYPEDEF_SPTR(FrictionContactProblem)
 
    pre- and post-pro are common to all LinearOSNS and defined in this class.
 
+   With setComputeIslands(true) and a dense or sparse block storage for M,
+   each island of the index set (interactions coupled through shared
+   dynamical systems) is solved as a separate problem, with its own
+   convergence criterion.
+
    For details regarding the available options, see Nonsmooth problems formulations and available solvers in users' guide.
 
  */
@@ -169,6 +174,12 @@ public:
    */
   int solve(SP::FrictionContactProblem problem = SP::FrictionContactProblem());
 
+  /** solve separately the friction contact problem of each island
+   *
+   *  \return info solver information result, the first non zero one
+   */
+  int solveIslands();
+
   /** Compute the unknown reaction and velocity and update the Interaction (y
    *  and lambda )
    *
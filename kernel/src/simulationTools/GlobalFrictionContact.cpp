@@ -36,6 +36,7 @@
 #include "NonSmoothDrivers.h"
 #include "gfc3d_Solvers.h"
 #include "NumericsSparseMatrix.h"
+#include "NM_MPI.h"
 // #define DEBUG_NOCOLOR
 // #define DEBUG_STDOUT
 // #define DEBUG_MESSAGES
@@ -129,6 +130,7 @@ SP::GlobalFrictionContactProblem GlobalFrictionContact::globalFrictionContactPro
   {
     numerics_problem->M_inverse = &*_W_inverse->numericsMatrix();
   }
+  setNumericsMPIComm();
   return numerics_problem;
 }
 
@@ -146,10 +148,26 @@ GlobalFrictionContactProblem *GlobalFrictionContact::globalFrictionContactProble
   {
     numerics_problem->M_inverse = &*_W_inverse->numericsMatrix();
   }
+  setNumericsMPIComm();
   return numerics_problem;
 }
 
 
+void GlobalFrictionContact::setNumericsMPIComm()
+{
+#ifdef SICONOS_HAS_MPI
+  // W and H numerics matrices are rebuilt when the index set changes:
+  // the communicator must be set again each time the problem is formed.
+  if (_mpiComm != MPI_COMM_NULL)
+  {
+    NM_MPI_set_comm(&*_W->numericsMatrix(), _mpiComm);
+    NM_MPI_set_comm(&*_H->numericsMatrix(), _mpiComm);
+    if (_assemblyType == GLOBAL_REDUCED)
+      NM_MPI_set_comm(&*_W_inverse->numericsMatrix(), _mpiComm);
+  }
+#endif
+}
+
 bool GlobalFrictionContact::checkCompatibleNSLaw(NonSmoothLaw& nslaw)
 {
 
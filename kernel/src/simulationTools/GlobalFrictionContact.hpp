@@ -21,6 +21,8 @@
 #ifndef GlobalFrictionContact_H
 #define GlobalFrictionContact_H
 
+#include "SiconosConfig.h" // for SICONOS_HAS_MPI // IWYU pragma: keep
+#include "NM_MPI.h"        // for MPI_Comm
 #include "LinearOSNS.hpp"
 #include "SiconosVector.hpp"
 #include "SimpleMatrix.hpp"
@@ -102,6 +104,16 @@ protected:
   GFC3D_Driver _gfc_driver;
 
   GlobalFrictionContactProblem _numerics_problem;
+
+#ifdef SICONOS_HAS_MPI
+  /** MPI communicator given to the numerics matrices M and H,
+   *  MPI_COMM_NULL (default) to let numerics use MPI_COMM_WORLD */
+  MPI_Comm _mpiComm = MPI_COMM_NULL;
+#endif
+
+  /** attach the MPI communicator (if any) to the numerics matrices */
+  void setNumericsMPIComm();
+
 public:
 
   /** constructor (solver id and dimension)
@@ -180,6 +192,29 @@ public:
     return (*_mu)[i];
   }
 
+#ifdef SICONOS_HAS_MPI
+  /** set the MPI communicator used by the distributed linear solvers
+   *  (MUMPS) called by the numerics driver. All the processes of comm
+   *  must run the simulation: process 0 drives the solve while the
+   *  others wait for the factorization/solve jobs.
+   *
+   *  \param comm the MPI communicator
+   */
+  inline void setMPIComm(MPI_Comm comm)
+  {
+    _mpiComm = comm;
+  }
+
+  /** get the MPI communicator used by the numerics solvers
+   *
+   *  \return the communicator, MPI_COMM_NULL if none has been set
+   */
+  inline MPI_Comm mpiComm() const
+  {
+    return _mpiComm;
+  }
+#endif
+
   // --- Others functions ---
 
 
@@ -2,6 +2,7 @@
 #include "InteractionManager.hpp"
 #include "NonSmoothDynamicalSystem.hpp"
 #include "Simulation.hpp"
+#include "Relation.hpp"
 
 #include "siconos_debug.h"
 
@@ -26,3 +27,67 @@ SP::NonSmoothLaw InteractionManager::nonSmoothLaw(long unsigned int group1,
   else
     return SP::NonSmoothLaw();
 }
+
+void InteractionManager::recycleInteraction(SP::Interaction inter)
+{
+  if(!inter || _interactionPoolSize == 0)
+    return;
+  std::vector<SP::Interaction>& pool =
+    _interactionPool[std::type_index(typeid(*inter->relation()))];
+  if(pool.size() < _interactionPoolSize)
+    pool.push_back(inter);
+}
+
+void InteractionManager::releaseReservedInteractions()
+{
+  for(auto& reserved : _reservedInteractions)
+  {
+    SP::Interaction inter = reserved.second;
+    std::vector<SP::Interaction>& pool =
+      _interactionPool[std::type_index(typeid(*inter->relation()))];
+    // the relation is only referenced by the interaction (plus the copy
+    // returned by relation()): the interaction can be reused
+    if(inter->relation().use_count() == 2 && pool.size() < _interactionPoolSize)
+      pool.push_back(inter);
+  }
+  _reservedInteractions.clear();
+}
+
+SP::Relation InteractionManager::recycledRelation(const std::type_info& type)
+{
+  auto it = _interactionPool.find(std::type_index(type));
+  if(it == _interactionPool.end())
+    return SP::Relation();
+
+  // an interaction still referenced elsewhere (index sets, changelog of
+  // the nsds, user code ...) is not available yet
+  std::vector<SP::Interaction>& pool = it->second;
+  for(auto inter = pool.rbegin(); inter != pool.rend(); ++inter)
+  {
+    if(inter->use_count() == 1)
+    {
+      SP::Relation rel = (*inter)->relation();
+      _reservedInteractions[rel.get()] = *inter;
+      pool.erase(std::next(inter).base());
+      return rel;
+    }
+  }
+  return SP::Relation();
+}
+
+SP::Interaction InteractionManager::makeInteraction(SP::NonSmoothLaw nslaw,
+                                                    SP::Relation rel)
+{
+  auto it = _reservedInteractions.find(rel.get());
+  if(it != _reservedInteractions.end())
+  {
+    SP::Interaction inter = it->second;
+    _reservedInteractions.erase(it);
+    if(inter->nonSmoothLaw() == nslaw)
+    {
+      inter->recycle();
+      return inter;
+    }
+  }
+  return std::make_shared<Interaction>(nslaw, rel);
+}
@@ -28,6 +28,11 @@
 #include "SiconosVisitor.hpp"
 #include "NSLawMatrix.hpp"
 
+#include <map>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
 class InteractionManager
 {
 public:
@@ -56,11 +61,84 @@ public:
   virtual SP::NonSmoothLaw nonSmoothLaw(unsigned long int group1,
                                         unsigned long int group2);
 
+  /** set the maximum number of interactions kept for reuse for each
+   *  type of relation, 0 (the default) disables the recycling.
+   *  When it is enabled, Simulation::unlink gives the removed
+   *  interactions to the manager, that reuses them and their relation
+   *  for new contacts, see recycledRelation and makeInteraction.
+   *
+   *  \param size the maximum number of interactions in the pool
+   */
+  void setInteractionPoolSize(unsigned int size)
+  {
+    _interactionPoolSize = size;
+  };
+
+  /** \return the maximum number of interactions kept for reuse */
+  unsigned int interactionPoolSize() const
+  {
+    return _interactionPoolSize;
+  };
+
+  /** keep an interaction removed from the simulation for reuse, if the
+   *  pool of its type of relation is not full.
+   *
+   *  \param inter the interaction
+   */
+  void recycleInteraction(SP::Interaction inter);
+
 protected:
 
+  /** get the relation of a recycled interaction, that is not referenced
+   *  anywhere else, with a relation of type R. Its parameters must be
+   *  set again by the caller, and the interaction is then given by
+   *  makeInteraction with this relation.
+   *
+   *  \return the relation, or a null pointer if there is none
+   */
+  template<class R>
+  std::shared_ptr<R> recycledRelation()
+  {
+    return std::static_pointer_cast<R>(recycledRelation(typeid(R)));
+  };
+
+  /** non template version of recycledRelation
+   *
+   *  \param type the type of the relation
+   *  \return the relation, or a null pointer if there is none
+   */
+  SP::Relation recycledRelation(const std::type_info& type);
+
+  /** create an interaction, or reuse the recycled interaction of rel
+   *  if rel has been given by recycledRelation and the nonsmooth law is
+   *  the same.
+   *
+   *  \param nslaw the nonsmooth law
+   *  \param rel the relation
+   *  \return the interaction
+   */
+  SP::Interaction makeInteraction(SP::NonSmoothLaw nslaw, SP::Relation rel);
+
+  /** forget the interactions whose relation has been given by
+   *  recycledRelation but that have not been passed to makeInteraction.
+   *  They go back to the pool if their relation is not used elsewhere.
+   *  Called by the simulation after each updateInteractions, relations
+   *  may be taken and passed to makeInteraction in between.
+   */
+  void releaseReservedInteractions();
+
   /** nslaws */
   NSLawMatrix _nslaws;
 
+  /** maximum number of interactions in the pool of each type of relation */
+  unsigned int _interactionPoolSize = 0;
+
+  /** interactions removed from the simulation, for each type of relation */
+  std::map<std::type_index, std::vector<SP::Interaction>> _interactionPool;
+
+  /** interactions whose relation has been given by recycledRelation */
+  std::unordered_map<Relation*, SP::Interaction> _reservedInteractions;
+
   friend class Simulation;
   friend class TimeStepping;
   friend class EventDriven;
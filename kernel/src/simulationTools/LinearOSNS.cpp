@@ -44,6 +44,7 @@
 #include "OSNSMatrix.hpp"
 
 #include "Tools.hpp"
+#include <algorithm>
 #include <chrono>
 
 using namespace RELATION;
@@ -855,6 +856,45 @@ void LinearOSNS::computeM()
 
 }
 
+void LinearOSNS::computeIslands()
+{
+  InteractionsGraph& indexSet = *simulation()->indexSet(indexSetLevel());
+  _islands.clear();
+  std::vector<bool> visited(indexSet.size(), false);
+
+  // breadth-first search of the interactions connected to each vertex not
+  // yet visited. Two interactions are adjacent in the index set if they
+  // share a dynamical system.
+  InteractionsGraph::VIterator vi, viend;
+  for(std::tie(vi, viend) = indexSet.vertices(); vi != viend; ++vi)
+  {
+    if(visited[indexSet.index(*vi)])
+      continue;
+    _islands.emplace_back();
+    std::vector<InteractionsGraph::VDescriptor>& island = _islands.back();
+    visited[indexSet.index(*vi)] = true;
+    island.push_back(*vi);
+    for(size_t k = 0; k < island.size(); ++k)
+    {
+      InteractionsGraph::AVIterator avi, aviend;
+      for(std::tie(avi, aviend) = indexSet.adjacent_vertices(island[k]); avi != aviend; ++avi)
+      {
+        if(!visited[indexSet.index(*avi)])
+        {
+          visited[indexSet.index(*avi)] = true;
+          island.push_back(*avi);
+        }
+      }
+    }
+    std::sort(island.begin(), island.end(),
+              [&indexSet](const InteractionsGraph::VDescriptor& a, const InteractionsGraph::VDescriptor& b)
+    {
+      return indexSet.index(a) < indexSet.index(b);
+    });
+  }
+  DEBUG_PRINTF("LinearOSNS::computeIslands(): %zu islands\n", _islands.size());
+}
+
 bool LinearOSNS::preCompute(double time)
 {
   DEBUG_BEGIN("bool LinearOSNS::preCompute(double time)\n");
@@ -951,6 +991,8 @@ bool LinearOSNS::preCompute(double time)
       _w->zero();
       _z->zero();
     }
+    if(_computeIslands)
+      computeIslands();
   }
   // else
   // nothing to do (IsLinear and not changed)
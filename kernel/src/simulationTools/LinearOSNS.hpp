@@ -89,6 +89,14 @@ protected:
       size */
   bool _keepLambdaAndYState = true;
 
+  /** if true, the connected components (islands) of the index set are
+      computed in preCompute */
+  bool _computeIslands = false;
+
+  /** the islands of the index set, ie the sets of interactions coupled
+      through shared dynamical systems, sorted by interaction index */
+  std::vector<std::vector<InteractionsGraph::VDescriptor>> _islands;
+
   /** nslaw effects : visitors experimentation
    */
   struct _TimeSteppingNSLEffect;
@@ -236,6 +244,28 @@ public:
     _assemblyType = assemblyType;
   };
 
+  /** set whether the islands of the index set are computed in preCompute.
+   *  They are used by FrictionContact to solve each island separately.
+   *
+   *  \param b true to compute the islands
+   */
+  inline void setComputeIslands(bool b) { _computeIslands = b; };
+
+  /** get the islands of the index set, computed in preCompute
+   *
+   *  \return a vector of vectors of vertex descriptors
+   */
+  inline const std::vector<std::vector<InteractionsGraph::VDescriptor>> &
+  islands() const
+  {
+    return _islands;
+  };
+
+  /** compute the connected components of the index set, two interactions
+   *  being connected if they share a dynamical system
+   */
+  void computeIslands();
+
   /** Memory allocation or resizing for z,w,q */
   void initVectorsMemory();
 
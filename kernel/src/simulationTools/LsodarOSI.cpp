@@ -173,12 +173,65 @@ void LsodarOSI::updateData()
 
 }
 
+integer LsodarOSI::halfBandwidth()
+{
+  integer blockSize = 0;
+  DynamicalSystemsGraph::VIterator dsi, dsend;
+  for(std::tie(dsi, dsend) = _dynamicalSystemsGraph->vertices(); dsi != dsend; ++dsi)
+  {
+    if(!checkOSI(dsi)) continue;
+    DynamicalSystem& ds = *_dynamicalSystemsGraph->bundle(*dsi);
+    Type::Siconos dsType = Type::value(ds);
+    if(dsType == Type::LagrangianDS || dsType == Type::LagrangianLinearTIDS)
+      blockSize = std::max(blockSize, (integer)(2 * ds.dimension()));
+    else
+      blockSize = std::max(blockSize, (integer)ds.dimension());
+  }
+  return std::max(blockSize - 1, (integer)0);
+}
+
+void LsodarOSI::updateWorkSizes()
+{
+  // 1 - Neq; x vector size.
+  _intData[0] = _xWork->size();
+  // 5 - lrw, size of rwork, for the nonstiff method and the stiff one,
+  // with the matrix work space of a full or a band jacobian
+  integer ml = 0;
+  integer lmat = _intData[0] + 9;
+  if(_bandedJacobian)
+  {
+    ml = halfBandwidth();
+    lmat = 3 * ml + 10;
+  }
+  _intData[6] = 22 + _intData[0] * std::max((integer)16, lmat) + 3 * _intData[1];
+  // 6 - liw, size of iwork
+  _intData[7] = 20 + _intData[0];
+
+  // memory allocation for doublereal*, according to _intData values
+  updateData();
+
+  // lower and upper half bandwidths
+  if(_bandedJacobian)
+  {
+    iwork[0] = ml;
+    iwork[1] = ml;
+  }
+}
+
 void LsodarOSI::fillXWork(integer* sizeOfX, doublereal* x)
 {
   assert((unsigned int)(*sizeOfX) == _xWork->size() && "LsodarOSI::fillXWork xWork and sizeOfX have different sizes");
   (*_xWork) = x;
 }
 
+void LsodarOSI::fillXdot(integer* sizeOfX, doublereal* xdot)
+{
+  assert((unsigned int)(*sizeOfX) == _xdotWork->size() && "LsodarOSI::fillXdot xdotWork and sizeOfX have different sizes");
+  unsigned int pos = 0;
+  for(VectorOfVectors::const_iterator it = _xdotWork->begin(); it != _xdotWork->end(); ++it)
+    pos += (*it)->copyData(&xdot[pos]);
+}
+
 void LsodarOSI::computeRhs(double t)
 {
   DEBUG_BEGIN("LsodarOSI::computeRhs(double t, DynamicalSystemsGraph& DSG0)\n")
@@ -186,6 +239,8 @@ void LsodarOSI::computeRhs(double t)
   for(std::tie(dsi, dsend) = _dynamicalSystemsGraph->vertices(); dsi != dsend; ++dsi)
   {
     if(!checkOSI(dsi)) continue;
+    // during the initialization, the ds not yet initialized are skipped
+    if(!_dynamicalSystemsGraph->properties(*dsi).workVectors) continue;
     SP::DynamicalSystem ds = _dynamicalSystemsGraph->bundle(*dsi);
     // compute standard rhs stored in the dynamical system
     ds->computeRhs(t);
@@ -243,7 +298,7 @@ void LsodarOSI::g(integer* nEq, doublereal*  time, doublereal* x, integer* ng, d
 
 void LsodarOSI::jacobianfx(integer* sizeOfX, doublereal* time, doublereal* x, integer* ml, integer* mu,  doublereal* jacob, integer* nrowpd)
 {
-  std::static_pointer_cast<EventDriven>(_simulation)->computeJacobianfx(*this, sizeOfX, time, x, jacob);
+  std::static_pointer_cast<EventDriven>(_simulation)->computeJacobianfx(*this, sizeOfX, time, x, jacob, nrowpd);
 }
 
 
@@ -262,31 +317,31 @@ void LsodarOSI::initializeWorkVectorsForDS(double t, SP::DynamicalSystem ds)
     LagrangianDS& lds = *std::static_pointer_cast<LagrangianDS>(ds);
     // TODO FP: use buffer in graph for xWork?
     if(!_xWork)
+    {
       _xWork.reset(new BlockVector());
+      _xdotWork.reset(new BlockVector());
+    }
     _xWork->insertPtr(lds.q());
     _xWork->insertPtr(lds.velocity());
+    _xdotWork->insertPtr(lds.velocity());
+    _xdotWork->insertPtr(lds.acceleration());
     ds_work_vectors.resize(LsodarOSI::WORK_LENGTH);
     ds_work_vectors[LsodarOSI::FREE].reset(new SiconosVector(lds.dimension()));
   }
   else
   {
     if(!_xWork)
+    {
       _xWork.reset(new BlockVector());
+      _xdotWork.reset(new BlockVector());
+    }
     _xWork->insertPtr(ds->x());
+    _xdotWork->insertPtr(ds->rhs());
   }
   ds->swapInMemory();
 
   // Update necessary data
-
-  // 1 - Neq; x vector size.
-  _intData[0] = _xWork->size();
-  // 5 - lrw, size of rwork
-  _intData[6] = 22 + _intData[0] * std::max(16, (int)_intData[0] + 9) + 3 * _intData[1];
-  // 6 - liw, size of iwork
-  _intData[7] = 20 + _intData[0];
-
-  // memory allocation for doublereal*, according to _intData values
-  updateData();
+  updateWorkSizes();
 
   _xtmp.reset(new SiconosVector(_xWork->size()));
 
@@ -451,7 +506,7 @@ void LsodarOSI::initialize()
 
 
   // 7 - JT, Jacobian type indicator
-  _intData[8] = 2;   // jt, Jacobian type indicator.
+  _intData[8] = _bandedJacobian ? 4 : 2;   // jt, Jacobian type indicator.
   //           1 means a user-supplied full (NEQ by NEQ) Jacobian.
   //           2 means an internally generated (difference quotient) full Jacobian (using NEQ extra calls to f per df/dx value).
   //           4 means a user-supplied banded Jacobian.
@@ -460,6 +515,10 @@ void LsodarOSI::initialize()
   // set the optional input flags of LSODAROSI to 0
   // LSODAROSI will take the default values
 
+  // sizes of the work arrays with the number of constraints
+  if(_xWork)
+    updateWorkSizes();
+
 
   // === Error handling in LSODAROSI===
 
@@ -77,7 +77,15 @@ private:
   /** temporary vector to save x values */
   SP::BlockVector _xWork;
 
+  /** derivative of x, with the same layout as _xWork (pointer links to
+   *  the rhs of the dynamical systems) */
+  SP::BlockVector _xdotWork;
+
   SP::SiconosVector _xtmp;
+
+  /** true if the jacobian given to LSODAR is a band matrix */
+  bool _bandedJacobian = false;
+
   /** nslaw effects
    */
   struct _NSLEffectOnFreeOutput;
@@ -172,6 +180,28 @@ public:
    */
   inline void setJT(integer newJT) { _intData[8] = newJT; };
 
+  /** use a band jacobian in LSODAR (jt = 4) rather than a full one.
+   *  The dynamical systems are not coupled in the rhs, the jacobian is
+   *  block diagonal and its half bandwidth is the size of the largest
+   *  state minus one: for many small systems, the storage and the LU
+   *  factorization in the stiff method are linear in the size of x
+   *  instead of quadratic and cubic.
+   *  Must be set before the initialization of the simulation.
+   *
+   *  \param banded true to use a band jacobian
+   */
+  inline void setBandedJacobian(bool banded) { _bandedJacobian = banded; };
+
+  /** \return true if the jacobian is a band matrix */
+  inline bool bandedJacobian() const { return _bandedJacobian; };
+
+  /** get the half bandwidth of the jacobian of the rhs, ie the size of
+   *  the largest state of the dynamical systems minus one.
+   *
+   *  \return the half bandwidth
+   */
+  integer halfBandwidth();
+
   /** set itol, rtol and atol (tolerance parameters for lsodar)
    *
    *  \param newItol itol value
@@ -212,6 +242,11 @@ public:
    */
   void updateData();
 
+  /** update the sizes of the problem and of the work arrays in _intData,
+   *  when dynamical systems are added, and reallocate the work arrays.
+   */
+  void updateWorkSizes();
+
   /** fill xWork with a doublereal
    *
    *  \param size size of x array
@@ -219,6 +254,13 @@ public:
    */
   void fillXWork(integer *size, doublereal *array);
 
+  /** copy the rhs of all dynamical systems in the set into a doublereal array
+   *
+   *  \param size size of xdot array
+   *  \param array xdot array of double
+   */
+  void fillXdot(integer *size, doublereal *array);
+
   /** compute rhs(t) for all dynamical systems in the set
    *
    *  \param t current time of simulation
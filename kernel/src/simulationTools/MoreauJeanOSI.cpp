@@ -58,13 +58,23 @@ template <typename T> static std::shared_ptr<T> ptr(const T& a)
   return std::shared_ptr<SiconosVector>(&*(T*)&a, null_deleter);
 }
 
+/* true if ds is a NewtonEulerDS frozen by the deactivation */
+static bool isSleeping(const DynamicalSystem& ds)
+{
+  return Type::value(ds) == Type::NewtonEulerDS
+         && static_cast<const NewtonEulerDS&>(ds).isSleeping();
+}
+
 // --- constructor from a set of data ---
 MoreauJeanOSI::MoreauJeanOSI(double theta, double gamma):
   OneStepIntegrator(OSI::MOREAUJEANOSI),
   _constraintActivationThreshold(0.0),
   _useGammaForRelation(false),
   _explicitNewtonEulerDSOperators(false),
-  _isWSymmetricDefinitePositive(false)
+  _isWSymmetricDefinitePositive(false),
+  _deactivationVelocity(0.0),
+  _deactivationSteps(0),
+  _deactivationTime(-std::numeric_limits<double>::infinity())
 {
   _levelMinForOutput= 0;
   _levelMaxForOutput =1;
@@ -392,6 +402,27 @@ void MoreauJeanOSI::initializeIterationMatrixW(double time, SP::SecondOrderDS ds
 }
 
 
+void MoreauJeanOSI::updateIterationMatrices(double time)
+{
+  DEBUG_BEGIN("MoreauJeanOSI::updateIterationMatrices(double time)\n");
+  DynamicalSystemsGraph::VIterator dsi, dsend;
+  for(std::tie(dsi, dsend) = _dynamicalSystemsGraph->vertices(); dsi != dsend; ++dsi)
+  {
+    if(!checkOSI(dsi)) continue;
+    SP::DynamicalSystem ds = _dynamicalSystemsGraph->bundle(*dsi);
+    Type::Siconos dsType = Type::value(*ds);
+    // W of the other systems is computed at each step
+    if(dsType == Type::LagrangianLinearTIDS || dsType == Type::LagrangianLinearDiagonalDS)
+    {
+      _dynamicalSystemsGraph->properties(*dsi).W.reset();
+      _dynamicalSystemsGraph->properties(*dsi).Winverse.reset();
+      _dynamicalSystemsGraph->properties(*dsi).WBoundaryConditions.reset();
+      initializeIterationMatrixW(time, std::static_pointer_cast<SecondOrderDS>(ds));
+    }
+  }
+  DEBUG_END("MoreauJeanOSI::updateIterationMatrices(double time)\n");
+}
+
 void MoreauJeanOSI::_initializeIterationMatrixWBoundaryConditions(SecondOrderDS& ds, const DynamicalSystemsGraph::VDescriptor& dsv)
 {
   // This function:
@@ -628,6 +659,7 @@ void MoreauJeanOSI::computeInitialNewtonState()
   {
     if(!checkOSI(dsi)) continue;
     DynamicalSystem&  ds = *_dynamicalSystemsGraph->bundle(*dsi);
+    if(isSleeping(ds)) continue;
 
     if(_explicitNewtonEulerDSOperators)
     {
@@ -713,10 +745,31 @@ double MoreauJeanOSI::computeResidu()
   double normResidu = maxResidu;
 
   DynamicalSystemsGraph::VIterator dsi, dsend;
+
+  // internal and external forces given by a batched plugin: one call for
+  // all the systems that share it, before their residu is computed below
+  std::vector<LagrangianDS*> batchedDS;
+  for(std::tie(dsi, dsend) = _dynamicalSystemsGraph->vertices(); dsi != dsend; ++dsi)
+  {
+    if(!checkOSI(dsi)) continue;
+    DynamicalSystem& ds = *_dynamicalSystemsGraph->bundle(*dsi);
+    if(isSleeping(ds) || Type::value(ds) != Type::LagrangianDS) continue;
+    LagrangianDS& d = static_cast<LagrangianDS&>(ds);
+    if(d.hasFIntBatchFunction() || d.hasFExtBatchFunction())
+      batchedDS.push_back(&d);
+  }
+  if(!batchedDS.empty())
+  {
+    LagrangianDS::computeFIntBatch(t, batchedDS);
+    LagrangianDS::computeFExtBatch(t, batchedDS);
+  }
+
   for(std::tie(dsi, dsend) = _dynamicalSystemsGraph->vertices(); dsi != dsend; ++dsi)
   {
     if(!checkOSI(dsi)) continue;
     DynamicalSystem& ds = *_dynamicalSystemsGraph->bundle(*dsi);
+    // a frozen body keeps its free velocity, its residu is not needed
+    if(isSleeping(ds)) continue;
     VectorOfVectors& ds_work_vectors = *_dynamicalSystemsGraph->properties(*dsi).workVectors;
 
     dsType = Type::value(ds); // Its type
@@ -1079,11 +1132,35 @@ void MoreauJeanOSI::computeFreeState()
 
   DynamicalSystemsGraph::VIterator dsi, dsend;
 
+  // The resting steps are counted once per time step, not at each Newton iteration
+  bool countRestingSteps = _deactivationSteps > 0 && t > _deactivationTime;
+  if(countRestingSteps)
+    _deactivationTime = t;
+
   for(std::tie(dsi, dsend) = _dynamicalSystemsGraph->vertices(); dsi != dsend; ++dsi)
   {
     if(!checkOSI(dsi)) continue;
     DynamicalSystem & ds = *_dynamicalSystemsGraph->bundle(*dsi);
     dsType = Type::value(ds); // Its type
+
+    // a frozen body keeps the free velocity of its last active step
+    if(isSleeping(ds)) continue;
+
+    // a body put to sleep here computes its free velocity one last time
+    if(countRestingSteps && dsType == Type::NewtonEulerDS)
+    {
+      NewtonEulerDS& d = static_cast<NewtonEulerDS&>(ds);
+      // twist at the end of the previous step
+      if(d.twistMemory().getSiconosVector(0).normInf() < _deactivationVelocity)
+      {
+        d.setRestingSteps(d.restingSteps() + 1);
+        if(d.restingSteps() >= _deactivationSteps)
+          d.setSleeping(true);
+      }
+      else
+        d.setRestingSteps(0);
+    }
+
     SiconosMatrix& W = *_dynamicalSystemsGraph->properties(*dsi).W; // Its W MoreauJeanOSI matrix of iteration.
     VectorOfVectors& ds_work_vectors = *_dynamicalSystemsGraph->properties(*dsi).workVectors;
     // // 3 - Lagrangian Non Linear Systems
@@ -1290,6 +1367,7 @@ void MoreauJeanOSI::prepareNewtonIteration(double time)
   {
     if(!checkOSI(dsi)) continue;
     SecondOrderDS &sods = * (std::static_pointer_cast<SecondOrderDS> (_dynamicalSystemsGraph->bundle(*dsi)));
+    if(isSleeping(sods)) continue;
     computeW(time, sods, *_dynamicalSystemsGraph->properties(*dsi).W);
   }
 
@@ -1832,6 +1910,19 @@ void MoreauJeanOSI::updateState(const unsigned int)
       else
         v =  vfree;
 
+      if(d.isSleeping())
+      {
+        // the velocity given by the contact impulses wakes the body up,
+        // otherwise it stays frozen at its position
+        if(v.normInf() > _deactivationVelocity)
+          d.setSleeping(false);
+        else
+        {
+          v.zero();
+          continue;
+        }
+      }
+
       DEBUG_PRINT("MoreauJeanOSI::updatestate work free\n");
       DEBUG_EXPR(vfree.display());
       DEBUG_PRINT("MoreauJeanOSI::updatestate new v\n");
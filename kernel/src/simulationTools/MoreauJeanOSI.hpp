@@ -147,6 +147,19 @@ protected:
    */
   bool _isWSymmetricDefinitePositive;
 
+  /** velocity under which a NewtonEulerDS is considered at rest
+   */
+  double _deactivationVelocity;
+
+  /** number of consecutive steps at rest before a NewtonEulerDS is
+   *  frozen (0: no deactivation)
+   */
+  unsigned int _deactivationSteps;
+
+  /** time of the last update of the resting steps counters
+   */
+  double _deactivationTime;
+
   /**
       A set of work indices for the selected coordinates when
       we subprod in computeFreeOuput
@@ -349,6 +362,33 @@ public:
     _explicitNewtonEulerDSOperators = newExplicitNewtonEulerDSOperators;
   };
 
+  /** enable the deactivation of the NewtonEulerDS at rest.
+   *
+   *  A body whose twist stays below velocity (infinity norm) during steps
+   *  consecutive time steps is frozen: its free velocity is kept from the
+   *  last computed one, its twist is set to zero and its position is no
+   *  longer updated, so that the contacts it is involved in are solved with
+   *  the same data and give the same reactions. The velocity it would
+   *  receive from the contact impulses is still checked in updateState and
+   *  the body is woken up as soon as it exceeds the threshold, i.e. when a
+   *  contact of its island is created, lost or changed.
+   *
+   *  \param velocity the velocity threshold
+   *  \param steps the number of steps at rest before freezing a body,
+   *  0 disables the deactivation
+   */
+  inline void setDeactivation(double velocity, unsigned int steps)
+  {
+    _deactivationVelocity = velocity;
+    _deactivationSteps = steps;
+  }
+
+  /** get the velocity threshold of the deactivation */
+  inline double deactivationVelocity() const { return _deactivationVelocity; }
+
+  /** get the number of steps at rest before freezing a body */
+  inline unsigned int deactivationSteps() const { return _deactivationSteps; }
+
   // --- OTHER FUNCTIONS ---
 
   /**
@@ -395,6 +435,14 @@ public:
    */
   void initializeIterationMatrixW(double time, SP::SecondOrderDS ds);
 
+  /** recompute the iteration matrices W of the systems for which they are
+   *  built once at initialization (linear time invariant systems).
+   *  To be called when the time step of the simulation has changed.
+   *
+   *  \param time current time
+   */
+  void updateIterationMatrices(double time);
+
   /** compute W MoreauJeanOSI matrix at time t
    *
    *  \param time (double)
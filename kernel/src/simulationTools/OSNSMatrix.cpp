@@ -31,6 +31,8 @@
 #include "MoreauJeanOSI.hpp"
 #include "MoreauJeanGOSI.hpp"
 #include "SecondOrderDS.hpp"
+#include <algorithm>
+#include <cmath>
 // #define DEBUG_NOCOLOR
 // #define DEBUG_STDOUT
 // #define DEBUG_MESSAGES
@@ -347,29 +349,22 @@ void OSNSMatrix::fillW(DynamicalSystemsGraph & DSG, bool update)
   {
     if(update)
     {
-      size_t sizeM = _dimRow;
-      DEBUG_PRINTF("sizeM = %lu \n", sizeM);
+      DEBUG_PRINTF("sizeM = %u \n", _dimRow);
 
-      // We choose a triplet matrix format for inserting values.
-      // This simplifies the memory manipulation.
-      _numericsMatrix.reset(NM_create(NM_SPARSE, sizeM, sizeM),NM_free);
-
-      NumericsMatrix& M_NM = *numericsMatrix();
-      NM_triplet_alloc(&M_NM, _triplet_nzmax);
-      CSparseMatrix* Mtriplet = NM_triplet(&M_NM);
-
-      unsigned int pos =0;
+      std::vector<DenseBlock> blocks;
+      blocks.reserve(DSG.size());
       // Loop over the DS for filling M
       DynamicalSystemsGraph::VIterator dsi, dsend;
       for(std::tie(dsi, dsend) = DSG.vertices(); dsi != dsend; ++dsi)
       {
-        SP::DynamicalSystem ds = DSG.bundle(*dsi);
         SiconosMatrix* W = DSG.properties(*dsi).W.get();
-        pos = DSG.properties(*dsi).absolute_position;
-        W->fillTriplet(Mtriplet, pos, pos);
-        DEBUG_PRINTF("pos = %u \n", pos);
+        if(W->num() != Siconos::DENSE)
+          THROW_EXCEPTION("OSNSMatrix::fillW not implemented for the given matrix type");
+        size_t pos = DSG.properties(*dsi).absolute_position;
+        blocks.push_back({W->getArray(), W->size(0), W->size(1), W->size(0), pos, pos, false});
+        DEBUG_PRINTF("pos = %zu \n", pos);
       }
-      _triplet_nzmax =  NM_nnz(&M_NM);
+      assembleCSC(blocks);
     }
     break;
   }
@@ -402,18 +397,13 @@ void OSNSMatrix::fillWinverse(DynamicalSystemsGraph & DSG, bool update)
   {
     if(update)
     {
-      size_t sizeM = _dimRow;
-      DEBUG_PRINTF("sizeM = %lu \n", sizeM);
-
-      // We choose a triplet matrix format for inserting values.
-      // This simplifies the memory manipulation.
-      _numericsMatrix.reset(NM_create(NM_SPARSE, sizeM, sizeM),NM_free);
+      DEBUG_PRINTF("sizeM = %u \n", _dimRow);
 
-      NumericsMatrix& M_NM = *numericsMatrix();
-      NM_triplet_alloc(&M_NM, _triplet_nzmax);
-      CSparseMatrix* Mtriplet = NM_triplet(&M_NM);
-
-      unsigned int pos =0;
+      // the inverses are kept alive until the assembly is done
+      std::vector<SP::SimpleMatrix> Winverses;
+      Winverses.reserve(DSG.size());
+      std::vector<DenseBlock> blocks;
+      blocks.reserve(DSG.size());
       // Loop over the DS for filling M
       DynamicalSystemsGraph::VIterator dsi, dsend;
       for(std::tie(dsi, dsend) = DSG.vertices(); dsi != dsend; ++dsi)
@@ -435,20 +425,16 @@ void OSNSMatrix::fillWinverse(DynamicalSystemsGraph & DSG, bool update)
         else
           THROW_EXCEPTION("OSNSMatrix::fillWinverse not yet implemented for this type of OSI  ");
 
-        pos = DSG.properties(*dsi).absolute_position;
-        Winverse->fillTriplet(Mtriplet, pos, pos);
-        DEBUG_PRINTF("pos = %u \n", pos);
+        if(Winverse->num() != Siconos::DENSE)
+          THROW_EXCEPTION("OSNSMatrix::fillWinverse not implemented for the given matrix type");
+        size_t pos = DSG.properties(*dsi).absolute_position;
+        Winverses.push_back(Winverse);
+        blocks.push_back({Winverse->getArray(), Winverse->size(0), Winverse->size(1),
+                          Winverse->size(0), pos, pos, false});
+        DEBUG_PRINTF("pos = %zu \n", pos);
         //W->display();
       }
-
-      // // Ugly inversion
-      // for (unsigned int k =0 ; k < M_NM.size0; k++)
-      // {
-      //   Mtriplet->x[k] = 1.0/Mtriplet->x[k];
-      // }
-      //NM_display(numericsMatrix().get());
-      _triplet_nzmax =  NM_nnz(&M_NM);
-      //getchar();
+      assembleCSC(blocks);
     }
     break;
   }
@@ -469,12 +455,31 @@ void OSNSMatrix::fillH(DynamicalSystemsGraph & DSG, InteractionsGraph& indexSet,
 {
   DEBUG_BEGIN("void OSNSMatrix::fillH(SP::DynamicalSystemsGraph DSG, InteractionsGraph& indexSet, bool update)\n");
 
-  fillHtrans(DSG, indexSet, update);
+  if(update)
+  {
+    _dimRow = updateSizeAndPositions(DSG);
+    _dimColumn = updateSizeAndPositions(indexSet);
+  }
 
-  SP::NumericsMatrix Htrans = _numericsMatrix;
-  _numericsMatrix.reset(NM_transpose(Htrans.get()), NM_free);
-  _dimColumn = updateSizeAndPositions(indexSet);
-  _dimRow = updateSizeAndPositions(DSG);
+  switch(_storageType)
+  {
+  case NM_SPARSE:
+  {
+    if(update)
+    {
+      // H is assembled from the transposed blocks of Htrans, so that its
+      // pattern is kept from one call to the other
+      std::vector<DenseBlock> blocks;
+      HtransBlocks(DSG, indexSet, true, blocks);
+      assembleCSC(blocks);
+    }
+    break;
+  }
+  default:
+  {
+    THROW_EXCEPTION("OSNSMatrix::fillH unknown _storageType");
+  }
+  }
 
   DEBUG_END("void OSNSMatrix::fillH(SP::DynamicalSystemsGraph DSG, InteractionsGraph& indexSet, bool update)\n");
 }
@@ -496,90 +501,237 @@ void OSNSMatrix::fillHtrans(DynamicalSystemsGraph & DSG, InteractionsGraph& inde
   {
     if(update)
     {
-      // We choose a triplet matrix format for inserting values.
-      // This simplifies the memory manipulation.
-      _numericsMatrix.reset(NM_create(NM_SPARSE, _dimRow, _dimColumn),NM_free);
-      NumericsMatrix& H_NM = *numericsMatrix();
-      NM_triplet_alloc(&H_NM, _triplet_nzmax);
-      CSparseMatrix* Htriplet= NM_triplet(&H_NM);
+      std::vector<DenseBlock> blocks;
+      HtransBlocks(DSG, indexSet, false, blocks);
+      assembleCSC(blocks);
+    }
+    break;
+  }
+  default:
+  {
+    THROW_EXCEPTION("OSNSMatrix::fillHtrans unknown _storageType");
+  }
+  }
+  DEBUG_END("void OSNSMatrix::fillHtrans(SP::DynamicalSystemsGraph DSG, InteractionsGraph& indexSet, bool update)\n");
+}
 
-      unsigned int pos = 0, abs_pos_ds=0;
-      SP::SiconosMatrix leftInteractionBlock;
+void OSNSMatrix::HtransBlocks(DynamicalSystemsGraph& DSG, InteractionsGraph& indexSet,
+                              bool transpose, std::vector<DenseBlock>& blocks)
+{
+  blocks.clear();
+  blocks.reserve(2*indexSet.size());
 
+  unsigned int pos = 0, abs_pos_ds=0;
+  SP::SiconosMatrix leftInteractionBlock;
 
-      InteractionsGraph::VIterator ui, uiend;
-      for(std::tie(ui, uiend) = indexSet.vertices(); ui != uiend; ++ui)
-      {
-        Interaction& inter = *indexSet.bundle(*ui);
-        size_t sizeY = inter.dimension();
-        leftInteractionBlock = inter.getLeftInteractionBlock();
 
-        double * array = &*leftInteractionBlock->getArray();
-        //double * array_with_bc= nullptr;
+  InteractionsGraph::VIterator ui, uiend;
+  for(std::tie(ui, uiend) = indexSet.vertices(); ui != uiend; ++ui)
+  {
+    Interaction& inter = *indexSet.bundle(*ui);
+    size_t sizeY = inter.dimension();
+    leftInteractionBlock = inter.getLeftInteractionBlock();
 
-        SP::DynamicalSystem ds1 = indexSet.properties(*ui).source;
-        SP::DynamicalSystem ds2 = indexSet.properties(*ui).target;
+    double * array = &*leftInteractionBlock->getArray();
+    //double * array_with_bc= nullptr;
 
-        bool endl = false;
-        size_t posBlock = indexSet.properties(*ui).source_pos;
-        size_t pos_ds2 = indexSet.properties(*ui).target_pos;
+    SP::DynamicalSystem ds1 = indexSet.properties(*ui).source;
+    SP::DynamicalSystem ds2 = indexSet.properties(*ui).target;
+
+    bool endl = false;
+    size_t posBlock = indexSet.properties(*ui).source_pos;
+    size_t pos_ds2 = indexSet.properties(*ui).target_pos;
+
+    pos =  indexSet.properties(*ui).absolute_position;
+
+    for(SP::DynamicalSystem ds = ds1; !endl; ds = ds2, posBlock = pos_ds2)
+    {
+      endl = (ds == ds2);
+      size_t sizeDS = ds->dimension();
 
-        pos =  indexSet.properties(*ui).absolute_position;
+      SecondOrderDS* sods = dynamic_cast<SecondOrderDS*> (ds.get());
 
-        for(SP::DynamicalSystem ds = ds1; !endl; ds = ds2, posBlock = pos_ds2)
+      if (sods)
+      {
+        SP::BoundaryCondition bc;
+        if(sods->boundaryConditions())
         {
-          endl = (ds == ds2);
-          size_t sizeDS = ds->dimension();
+          // bc = sods->boundaryConditions();
+          // NM_dense_display(array,sizeY,sizeDS,sizeY);
+          // array_with_bc = (double *) calloc(sizeY*sizeDS,sizeof(double));
+          // memcpy(array_with_bc, array ,sizeY*sizeDS,sizeof(double));
+          // NM_dense_display(array_with_bc,sizeY,sizeDS,sizeY);
+          // for(std::vector<unsigned int>::iterator itindex = bc->velocityIndices()->begin() ;
+          //     itindex != bc->velocityIndices()->end();
+          //     ++itindex)
+          // {
+
+
+          //   for (unsigned int row; row < sizeY; row++  )
+          //   {
+          //     array_with_bc[row + (sizeY) * (posBlock + *itindex)] = 0.0
+          //   }
+          //     // (nslawSize,sizeDS));
+          //   //SP::SiconosVector coltmp(new SiconosVector(nslawSize));
+          //   //coltmp->zero();
+          //   std::cout <<  "bc indx "<< *itindex << std::endl;
+          // }
+
+
+          // //getchar();
+          THROW_EXCEPTION("OSNSMatrix::fillHtrans boundary conditions not yet implemented.");
+        }
+      }
+
+
+      abs_pos_ds =  DSG.properties(DSG.descriptor(ds)).absolute_position;
+      if(transpose)
+        blocks.push_back({array+posBlock*sizeY, sizeDS, sizeY, sizeY, abs_pos_ds, pos, true});
+      else
+        blocks.push_back({array+posBlock*sizeY, sizeY, sizeDS, sizeY, pos, abs_pos_ds, false});
+    }
+  }
+}
 
-          SecondOrderDS* sods = dynamic_cast<SecondOrderDS*> (ds.get());
+void OSNSMatrix::assembleCSC(const std::vector<DenseBlock>& blocks)
+{
+  DEBUG_BEGIN("void OSNSMatrix::assembleCSC(const std::vector<DenseBlock>& blocks)\n");
 
-          if (sods)
+  // same blocks as in the previous assembly ?
+  bool samePattern = (_cscColPtr.size() == (size_t)_dimColumn + 1
+                      && _cscBlocks.size() == 4 * blocks.size());
+  for(size_t k = 0; samePattern && k < blocks.size(); ++k)
+  {
+    const DenseBlock& b = blocks[k];
+    const size_t* sig = &_cscBlocks[4 * k];
+    samePattern = (sig[0] == b.row_off && sig[1] == b.col_off
+                   && sig[2] == b.nrow && sig[3] == b.ncol);
+  }
+
+  // the matrix of the previous assembly is refilled in place, so that
+  // the symbolic analysis kept in its internal data is reused by the
+  // next sparse factorization
+  NumericsMatrix* M = _numericsMatrix.get();
+  samePattern = samePattern && M && M->storageType == NM_SPARSE
+                && M->size0 == (int)_dimRow && M->size1 == (int)_dimColumn
+                && M->matrix2 && M->matrix2->origin == NSM_CSC && M->matrix2->csc
+                && M->matrix2->csc->nzmax >= (CS_INT)_cscRowIdx.size();
+
+  if(samePattern)
+  {
+    // values only: scatter each nonzero into the next slot of its column,
+    // checking that it is the row stored in the pattern
+    double* Mx = M->matrix2->csc->x;
+    std::vector<CS_INT> next(_cscColPtr.begin(), _cscColPtr.end() - 1);
+    for(size_t k = 0; samePattern && k < blocks.size(); ++k)
+    {
+      const DenseBlock& b = blocks[k];
+      // row and column strides of the block in its array
+      size_t rs = b.trans ? b.ld : 1, cs = b.trans ? 1 : b.ld;
+      for(size_t j = 0; samePattern && j < b.ncol; ++j)
+      {
+        size_t col = b.col_off + j;
+        CS_INT end = _cscColPtr[col + 1];
+        const double* column = b.array + j * cs;
+        for(size_t i = 0; i < b.nrow; ++i)
+        {
+          if(fabs(column[i * rs]) >= DBL_EPSILON)
           {
-            SP::BoundaryCondition bc;
-            if(sods->boundaryConditions())
+            CS_INT& p = next[col];
+            if(p >= end || _cscRowIdx[p] != (CS_INT)(b.row_off + i))
             {
-              // bc = sods->boundaryConditions();
-              // NM_dense_display(array,sizeY,sizeDS,sizeY);
-              // array_with_bc = (double *) calloc(sizeY*sizeDS,sizeof(double));
-              // memcpy(array_with_bc, array ,sizeY*sizeDS,sizeof(double));
-              // NM_dense_display(array_with_bc,sizeY,sizeDS,sizeY);
-              // for(std::vector<unsigned int>::iterator itindex = bc->velocityIndices()->begin() ;
-              //     itindex != bc->velocityIndices()->end();
-              //     ++itindex)
-              // {
-
-
-              //   for (unsigned int row; row < sizeY; row++  )
-              //   {
-              //     array_with_bc[row + (sizeY) * (posBlock + *itindex)] = 0.0
-              //   }
-              //     // (nslawSize,sizeDS));
-              //   //SP::SiconosVector coltmp(new SiconosVector(nslawSize));
-              //   //coltmp->zero();
-              //   std::cout <<  "bc indx "<< *itindex << std::endl;
-              // }
-
-
-              // //getchar();
-              THROW_EXCEPTION("OSNSMatrix::fillHtrans boundary conditions not yet implemented.");
+              samePattern = false;
+              break;
             }
+            Mx[p++] = column[i * rs];
           }
-
-
-          abs_pos_ds =  DSG.properties(DSG.descriptor(ds)).absolute_position;
-          CSparseMatrix_block_dense_zentry(Htriplet,  pos, abs_pos_ds, array+posBlock*sizeY, sizeY, sizeDS, DBL_EPSILON);
         }
       }
-      _triplet_nzmax =  NM_nnz(&H_NM);
     }
-    break;
+    for(size_t col = 0; samePattern && col < _dimColumn; ++col)
+      samePattern = (next[col] == _cscColPtr[col + 1]);
+
+    if(samePattern)
+    {
+      CSparseMatrix* csc = M->matrix2->csc;
+      std::copy(_cscColPtr.begin(), _cscColPtr.end(), csc->p);
+      std::copy(_cscRowIdx.begin(), _cscRowIdx.end(), csc->i);
+      // the numeric factors and the storages computed from the old values
+      // are dropped
+      if(M->matrix2->linearSolverParams)
+        M->matrix2->linearSolverParams = NSM_linearSolverParams_free(M->matrix2->linearSolverParams);
+      NM_clearTriplet(M);
+      NM_clearHalfTriplet(M);
+      NM_clearCSCTranspose(M);
+      NM_clearCSR(M);
+      NSM_inc_version(M->matrix2, NSM_CSC);
+      NM_unpreserve(M);
+      if(M->internalData)
+      {
+        NM_set_LU_factorized(M, false);
+        NM_set_Cholesky_factorized(M, false);
+        NM_set_LDLT_factorized(M, false);
+        M->internalData->isInversed = false;
+      }
+      DEBUG_END("void OSNSMatrix::assembleCSC(const std::vector<DenseBlock>& blocks)\n");
+      return;
+    }
+    DEBUG_PRINT("pattern has changed\n");
   }
-  default:
-  {
-    THROW_EXCEPTION("OSNSMatrix::fillHtrans unknown _storageType");
+
+  // new pattern: count the nonzeros of each column ...
+  _cscColPtr.assign(_dimColumn + 1, 0);
+  _cscBlocks.resize(4 * blocks.size());
+  for(size_t k = 0; k < blocks.size(); ++k)
+  {
+    const DenseBlock& b = blocks[k];
+    size_t* sig = &_cscBlocks[4 * k];
+    sig[0] = b.row_off;
+    sig[1] = b.col_off;
+    sig[2] = b.nrow;
+    sig[3] = b.ncol;
+    size_t rs = b.trans ? b.ld : 1, cs = b.trans ? 1 : b.ld;
+    for(size_t j = 0; j < b.ncol; ++j)
+    {
+      const double* column = b.array + j * cs;
+      for(size_t i = 0; i < b.nrow; ++i)
+        if(fabs(column[i * rs]) >= DBL_EPSILON)
+          _cscColPtr[b.col_off + j + 1]++;
+    }
   }
+  for(size_t col = 0; col < _dimColumn; ++col)
+    _cscColPtr[col + 1] += _cscColPtr[col];
+
+  // ... then fill rows and values
+  CS_INT nnz = _cscColPtr[_dimColumn];
+  _cscRowIdx.resize(nnz);
+  _numericsMatrix.reset(NM_create(NM_SPARSE, _dimRow, _dimColumn), NM_free);
+  NM_csc_alloc(_numericsMatrix.get(), nnz);
+  _numericsMatrix->matrix2->origin = NSM_CSC;
+  CSparseMatrix* csc = _numericsMatrix->matrix2->csc;
+  std::vector<CS_INT> next(_cscColPtr.begin(), _cscColPtr.end() - 1);
+  for(const DenseBlock& b : blocks)
+  {
+    size_t rs = b.trans ? b.ld : 1, cs = b.trans ? 1 : b.ld;
+    for(size_t j = 0; j < b.ncol; ++j)
+    {
+      CS_INT& p = next[b.col_off + j];
+      const double* column = b.array + j * cs;
+      for(size_t i = 0; i < b.nrow; ++i)
+      {
+        if(fabs(column[i * rs]) >= DBL_EPSILON)
+        {
+          _cscRowIdx[p] = b.row_off + i;
+          csc->x[p++] = column[i * rs];
+        }
+      }
+    }
   }
-  DEBUG_END("void OSNSMatrix::fillHtrans(SP::DynamicalSystemsGraph DSG, InteractionsGraph& indexSet, bool update)\n");
+  std::copy(_cscColPtr.begin(), _cscColPtr.end(), csc->p);
+  std::copy(_cscRowIdx.begin(), _cscRowIdx.end(), csc->i);
+  _triplet_nzmax = nnz;
+
+  DEBUG_END("void OSNSMatrix::assembleCSC(const std::vector<DenseBlock>& blocks)\n");
 }
 
 void OSNSMatrix::computeM(SP::NumericsMatrix Winverse, SP::NumericsMatrix Htrans)
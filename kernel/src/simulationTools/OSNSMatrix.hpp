@@ -26,6 +26,7 @@
 #include "SiconosSerialization.hpp" // for ACCEPT_SERIALIZATION
 #include "SimulationTypeDef.hpp"
 #include "NumericsMatrix.h" // for NM_types
+#include <vector>
 
 /**
    Interface to some specific storage types for matrices used in
@@ -117,6 +118,45 @@ protected:
       (_storageType = NM_SPARSE_BLOCK) */
   SP::BlockCSRMatrix _M2;
 
+  /** a dense column-major block of a sparse (NM_SPARSE) assembly. If
+      trans is true, the block is the transpose of the nrow x ncol
+      matrix stored in array (the leading dimension of array is ld). */
+  struct DenseBlock
+  {
+    const double* array;
+    size_t nrow, ncol, ld;
+    size_t row_off, col_off;
+    bool trans;
+  };
+
+  /** compressed column pattern of the last sparse assembly: column
+      pointers, row indices and, for each block, its position and size.
+      It is reused as long as the blocks and their nonzeros are unchanged. */
+  std::vector<CS_INT> _cscColPtr;
+  std::vector<CS_INT> _cscRowIdx;
+  std::vector<size_t> _cscBlocks;
+
+  /** build _numericsMatrix (NM_SPARSE, csc) of size _dimRow x _dimColumn
+   *  from a set of dense blocks, skipping entries below DBL_EPSILON.
+   *  If the pattern is the one of the previous call, the values are
+   *  scattered directly into the current matrix, which keeps its
+   *  internal data (symbolic analysis of its factorizations).
+   *
+   *  \param blocks the blocks, which must not overlap
+   */
+  void assembleCSC(const std::vector<DenseBlock>& blocks);
+
+  /** gather the blocks of Htrans (or of H if transpose is true), that is
+   *  the left interaction blocks of the interactions of indexSet
+   *
+   *  \param DSG the index set of the dynamicalSystems
+   *  \param indexSet the index set of the Interactions
+   *  \param transpose if true, the blocks of H are returned
+   *  \param blocks the output blocks
+   */
+  void HtransBlocks(DynamicalSystemsGraph& DSG, InteractionsGraph& indexSet,
+                    bool transpose, std::vector<DenseBlock>& blocks);
+
   /** For each Interaction in the graph, compute its absolute position
    * 
    *  \param indexSet the index set ot the concerned interactios.
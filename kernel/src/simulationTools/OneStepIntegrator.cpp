@@ -22,6 +22,7 @@
 #include "NonSmoothDynamicalSystem.hpp"
 #include "ExtraAdditionalTerms.hpp"
 #include "Relation.hpp"
+#include "LagrangianScleronomousR.hpp"
 #include "EventsManager.hpp"
 #include <SiconosConfig.h>
 #include <functional>
@@ -149,10 +150,38 @@ void OneStepIntegrator::resetNonSmoothPart(unsigned int level)
   }
 }
 
+/* The interactions of the integrator with a scleronomous relation whose h
+ * (level 0) or jacobian (higher levels) is given by a batched plugin are
+ * computed with one call of the plugin, before the loop on the interactions */
+static void computeScleronomousBatch(OneStepIntegrator& osi, InteractionsGraph& indexSet0,
+                                     double time, bool h)
+{
+  std::vector<Interaction*> batched;
+  InteractionsGraph::VIterator ui, uiend;
+  for(std::tie(ui, uiend) = indexSet0.vertices(); ui != uiend; ++ui)
+  {
+    if(!osi.checkInteractionOSI(indexSet0, ui)) continue;
+    Interaction & inter = *indexSet0.bundle(*ui);
+    Relation& rel = *inter.relation();
+    if(rel.getType() != RELATION::Lagrangian || rel.getSubType() != RELATION::ScleronomousR)
+      continue;
+    LagrangianScleronomousR& r = static_cast<LagrangianScleronomousR&>(rel);
+    if(h ? r.hasHBatchFunction() : r.hasJachqBatchFunction())
+      batched.push_back(&inter);
+  }
+  if(batched.empty())
+    return;
+  if(h)
+    LagrangianScleronomousR::computehBatch(time, batched);
+  else
+    LagrangianScleronomousR::computeJachqBatch(time, batched);
+}
+
 void OneStepIntegrator::updateOutput(double time, unsigned int level)
 {
   InteractionsGraph::VIterator ui, uiend;
   InteractionsGraph & indexSet0 = *_simulation->nonSmoothDynamicalSystem()->topology()->indexSet0();
+  computeScleronomousBatch(*this, indexSet0, time, level == 0);
   for(std::tie(ui, uiend) = indexSet0.vertices(); ui != uiend; ++ui)
   {
     if(!checkInteractionOSI(indexSet0, ui)) continue;
@@ -189,6 +218,7 @@ void OneStepIntegrator::updateInput(double time, unsigned int level)
   InteractionsGraph::VIterator ui, uiend;
   SP::Interaction inter;
   InteractionsGraph & indexSet0 = *_simulation->nonSmoothDynamicalSystem()->topology()->indexSet0();
+  computeScleronomousBatch(*this, indexSet0, time, false);
   for(std::tie(ui, uiend) = indexSet0.vertices(); ui != uiend; ++ui)
   {
     if(!checkInteractionOSI(indexSet0, ui)) continue;
@@ -636,6 +636,23 @@ void Simulation::link(SP::Interaction inter,
 void Simulation::unlink(SP::Interaction inter)
 {
   nonSmoothDynamicalSystem()->removeInteraction(inter);
+  if(_interman)
+    _interman->recycleInteraction(inter);
+}
+
+void Simulation::link(const InteractionLinks& links)
+{
+  DEBUG_PRINTF("link %zu interactions\n", links.size());
+
+  nonSmoothDynamicalSystem()->link(links);
+}
+
+void Simulation::unlink(const std::vector<SP::Interaction>& inters)
+{
+  nonSmoothDynamicalSystem()->removeInteractions(inters);
+  if(_interman)
+    for(const SP::Interaction& inter : inters)
+      _interman->recycleInteraction(inter);
 }
 
 void Simulation::updateInteractions()
@@ -643,7 +660,10 @@ void Simulation::updateInteractions()
   // Update interactions if a manager was provided.  Changes will be
   // detected by Simulation::initialize() changelog code.
   if(_interman)
+  {
     _interman->updateInteractions(shared_from_this());
+    _interman->releaseReservedInteractions();
+  }
 }
 
 void Simulation::computeResidu()
@@ -573,12 +573,29 @@ public:
             SP::DynamicalSystem ds1,
             SP::DynamicalSystem ds2 = SP::DynamicalSystem());
 
-  /** Remove an Interaction from the simulation.
+  /** Remove an Interaction from the simulation. It is given to the
+   *  InteractionManager for reuse, see
+   *  InteractionManager::setInteractionPoolSize.
    *
    *  \param inter the SP::Interaction to remove
    */
   void unlink(SP::Interaction inter);
 
+  /** Add several new Interactions at once, the topology is updated a
+   *  single time.
+   *
+   *  \param links the interactions, each one with its first and
+   *  (possibly null) second SP::DynamicalSystem
+   */
+  void link(const InteractionLinks& links);
+
+  /** Remove several Interactions at once from the simulation, see
+   *  unlink(SP::Interaction).
+   *
+   *  \param inters the interactions to remove
+   */
+  void unlink(const std::vector<SP::Interaction>& inters);
+
   /** Call the interaction manager one if is registered, otherwise do nothing. */
   void updateInteractions();
 
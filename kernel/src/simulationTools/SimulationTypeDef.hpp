@@ -25,6 +25,7 @@
 
 #include <vector>
 #include <set>
+#include <tuple>
 #include "SiconosPointers.hpp" // for TYPEDEF_SPTR
 #include "SiconosFwd.hpp" // for SP::OneStepIntegrator, ...
 
@@ -34,6 +35,15 @@
 typedef std::vector<unsigned int> IndexInt;
 TYPEDEF_SPTR(IndexInt)
 
+// ================== Objects to handle Interactions ==================
+
+/** an Interaction and the one or two DynamicalSystems it links (the
+    second one may be null) */
+typedef std::tuple<SP::Interaction, SP::DynamicalSystem, SP::DynamicalSystem> InteractionLink;
+
+/** list of InteractionLink, to link several interactions at once */
+typedef std::vector<InteractionLink> InteractionLinks;
+
 // ================== Objects to handle OSI ==================
 
 /** Vector of OneStepIntegrator */
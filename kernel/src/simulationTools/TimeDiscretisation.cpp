@@ -150,6 +150,30 @@ double TimeDiscretisation::currentTimeStep(const unsigned int k)
     return _tkV.at(k+1) - _tkV.at(k);
 }
 
+void TimeDiscretisation::setCurrentTimeStep(const unsigned int k, double h)
+{
+  if(!_tkV.empty())
+    THROW_EXCEPTION("TimeDiscretisation::setCurrentTimeStep must be called only when the TimeDiscretisation is with a constant h");
+  if(h <= 0.)
+    THROW_EXCEPTION("TimeDiscretisation::setCurrentTimeStep the time step must be positive");
+
+  // t0 is moved such that t_k = t0 + k*h is unchanged
+  if(_h > 0.)
+  {
+    _t0 += k * (_h - h);
+    _h = h;
+  }
+  else
+  {
+    mpf_mul_ui(_tk, _hgmp, k);
+    mpf_add(_tk, _tk, _t0gmp);
+    mpf_set_d(_hgmp, h);
+    mpf_mul_ui(_tkp1, _hgmp, k);
+    mpf_sub(_t0gmp, _tk, _tkp1);
+    _t0 = mpf_get_d(_t0gmp);
+  }
+}
+
 double TimeDiscretisation::getTk(const unsigned int indx)
 {
   if(_tkV.empty())
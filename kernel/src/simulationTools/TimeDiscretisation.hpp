@@ -158,6 +158,15 @@ public:
    */
   double currentTimeStep(const unsigned int k);
 
+  /** change the time step from step k: t_k is kept and t_{k+i} = t_k + i*h
+   *  for the next instants.
+   *  This is only possible for a constant time step (with or without GMP).
+   *
+   *  \param k the index of the current time step
+   *  \param h the new time step
+   */
+  void setCurrentTimeStep(const unsigned int k, double h);
+
   /** get the timestep in gmp format
    *
    *  \return a pointer to the timestep in mpf_t format
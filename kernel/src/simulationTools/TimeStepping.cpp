@@ -34,9 +34,13 @@
 #include "Relation.hpp"
 #include "BlockVector.hpp"
 #include "NewtonEulerR.hpp"
+#include "NewtonEulerDS.hpp"
+#include "MoreauJeanOSI.hpp"
 #include "FirstOrderR.hpp"
 
 #include <SiconosConfig.h>
+#include <algorithm>
+#include <cmath>
 #include <functional>
 using namespace std::placeholders;
 
@@ -425,11 +429,169 @@ void TimeStepping::advanceToEvent()
 {
   DEBUG_PRINTF("TimeStepping::advanceToEvent(). Time =%f\n",getTkp1());
   initialize();
+  if(_adaptiveTolerance > 0.)
+  {
+    adaptiveAdvanceToEvent();
+    return;
+  }
   if (!_skip_resetLambdas)
     resetLambdas();
   newtonSolve(_newtonTolerance, _newtonMaxIteration);
 }
 
+void TimeStepping::setAdaptiveTimeStepping(double tolerance, double violationTolerance,
+                                           double hMin, double hMax)
+{
+  if(tolerance > 0. && (hMin <= 0. || hMax < hMin))
+    THROW_EXCEPTION("TimeStepping::setAdaptiveTimeStepping - the time step bounds must satisfy 0 < hMin <= hMax.");
+  if(!_eventsManager->timeDiscretisation().hConst())
+    THROW_EXCEPTION("TimeStepping::setAdaptiveTimeStepping - the TimeDiscretisation must have a constant time step.");
+  _adaptiveTolerance = tolerance;
+  _adaptiveViolationTolerance = violationTolerance;
+  _adaptiveHMin = hMin;
+  _adaptiveHMax = hMax;
+}
+
+void TimeStepping::adaptiveAdvanceToEvent()
+{
+  DEBUG_BEGIN("TimeStepping::adaptiveAdvanceToEvent()\n");
+  for(OSIIterator itosi = _allOSI->begin(); itosi != _allOSI->end(); ++itosi)
+  {
+    if((*itosi)->getType() != OSI::MOREAUJEANOSI)
+      THROW_EXCEPTION("TimeStepping::advanceToEvent - the adaptive time stepping is only implemented for MoreauJeanOSI.");
+  }
+  if(_adaptiveHMatrices == 0.)
+    _adaptiveHMatrices = timeStep();
+
+  while(true)
+  {
+    double h = timeStep();
+    if(h != _adaptiveHMatrices)
+      updateTimeStepMatrices();
+
+    if(!_skip_resetLambdas)
+      resetLambdas();
+    newtonSolve(_newtonTolerance, _newtonMaxIteration);
+
+    // Moreau-Jean is of order one: the local error is O(h^2)
+    double ratio = adaptiveErrorRatio();
+    double factor = (ratio > 0.) ? 0.9 / std::sqrt(ratio) : 2.0;
+    factor = std::min(2.0, std::max(0.2, factor));
+    double hNew = std::min(_adaptiveHMax, std::max(_adaptiveHMin, factor * h));
+    DEBUG_PRINTF("h = %e, error ratio = %e, new h = %e\n", h, ratio, hNew);
+
+    if(ratio <= 1. || h <= _adaptiveHMin)
+    {
+      // The next step is scheduled now, otherwise its end would be
+      // computed with the current time step, and dropped if it is beyond T.
+      // The last step ends at T, and is stretched rather than followed by a
+      // tiny one.
+      double remaining = _T - nextTime();
+      if(remaining >= _adaptiveHMin)
+      {
+        if(hNew > remaining - _adaptiveHMin)
+          hNew = remaining;
+        _eventsManager->setNextTimeStep(hNew);
+      }
+      break;
+    }
+    _adaptiveNbRejectedSteps++;
+    restoreStateFromMemory();
+    _eventsManager->setCurrentTimeStep(hNew);
+  }
+  DEBUG_END("TimeStepping::adaptiveAdvanceToEvent()\n");
+}
+
+double TimeStepping::adaptiveErrorRatio()
+{
+  double h = timeStep();
+
+  // violation of the unilateral constraints: an active contact must be
+  // closed, an inactive one must not be penetrated. The contacts
+  // activated during the step are impacts.
+  double violation = 0.;
+  bool impact = false;
+  SP::InteractionsGraph indexSet0 = _nsds->topology()->indexSet0();
+  InteractionsGraph::VIterator ui, uiend;
+  for(std::tie(ui, uiend) = indexSet0->vertices(); ui != uiend; ++ui)
+  {
+    Interaction& inter = *indexSet0->bundle(*ui);
+    Type::Siconos nslawType = Type::value(*inter.nonSmoothLaw());
+    if(nslawType != Type::NewtonImpactNSL && nslawType != Type::NewtonImpactFrictionNSL)
+      continue;
+    double y = inter.y(0)->getValue(0);
+    bool active = inter.lambda(1) && inter.lambda(1)->getValue(0) != 0.;
+    violation = std::max(violation, active ? std::fabs(y) : -y);
+    if(active && inter.lambdaMemory(1).nbVectorsInMemory() > 0
+        && inter.lambdaMemory(1).getSiconosVector(0).getValue(0) == 0.)
+      impact = true;
+  }
+
+  // difference between the positions given by the scheme and by an
+  // explicit Euler step, theta h (v_{k+1} - v_k), only meaningful on
+  // smooth phases
+  double error = 0.;
+  if(!impact)
+  {
+    DynamicalSystemsGraph& dsg = *_nsds->dynamicalSystems();
+    DynamicalSystemsGraph::VIterator vi, viend;
+    for(std::tie(vi, viend) = dsg.vertices(); vi != viend; ++vi)
+    {
+      SP::SecondOrderDS d = std::dynamic_pointer_cast<SecondOrderDS>(dsg.bundle(*vi));
+      if(!d)
+        continue;
+      double theta = static_cast<MoreauJeanOSI&>(*dsg.properties(*vi).osi).theta();
+      const SiconosVector& v = *d->velocity();
+      const SiconosVector& vold = d->velocityMemory().getSiconosVector(0);
+      for(unsigned int i = 0; i < v.size(); ++i)
+        error = std::max(error, theta * h * std::fabs(v(i) - vold(i)));
+    }
+  }
+
+  double ratio = error / _adaptiveTolerance;
+  if(_adaptiveViolationTolerance > 0.)
+    ratio = std::max(ratio, violation / _adaptiveViolationTolerance);
+  return ratio;
+}
+
+void TimeStepping::updateTimeStepMatrices()
+{
+  // the iteration matrices and the matrices of the nonsmooth problems
+  // that depend on the time step have to be computed again
+  _adaptiveHMatrices = timeStep();
+  double t = startingTime();
+  for(OSIIterator itosi = _allOSI->begin(); itosi != _allOSI->end(); ++itosi)
+    static_cast<MoreauJeanOSI&>(**itosi).updateIterationMatrices(t);
+  for(OSNSIterator itOsns = _allNSProblems->begin(); itOsns != _allNSProblems->end(); ++itOsns)
+  {
+    if(*itOsns)
+      (*itOsns)->setHasBeenUpdated(false);
+  }
+}
+
+void TimeStepping::restoreStateFromMemory()
+{
+  DynamicalSystemsGraph& dsg = *_nsds->dynamicalSystems();
+  DynamicalSystemsGraph::VIterator vi, viend;
+  for(std::tie(vi, viend) = dsg.vertices(); vi != viend; ++vi)
+  {
+    SP::DynamicalSystem ds = dsg.bundle(*vi);
+    SP::SecondOrderDS d = std::dynamic_pointer_cast<SecondOrderDS>(ds);
+    if(d)
+    {
+      *d->q() = d->qMemory().getSiconosVector(0);
+      *d->velocity() = d->velocityMemory().getSiconosVector(0);
+      if(Type::value(*ds) == Type::NewtonEulerDS)
+        static_cast<NewtonEulerDS&>(*ds).computeT();
+    }
+    else if(ds->xMemory().nbVectorsInMemory() > 0)
+      *ds->x() = ds->xMemory().getSiconosVector(0);
+    ds->resetAllNonSmoothParts();
+  }
+  updateWorldFromDS();
+  updateOutput();
+}
+
 /*update of the nabla */
 /*discretisation of the Interactions */
 void   TimeStepping::prepareNewtonIteration()
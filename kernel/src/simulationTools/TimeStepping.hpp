@@ -126,6 +126,28 @@ protected:
    */
   bool _skip_resetLambdas;
 
+  /** tolerance on the local error estimate of the adaptive time stepping
+   *  (0: the time step of the TimeDiscretisation is kept)
+   */
+  double _adaptiveTolerance = 0.0;
+
+  /** tolerance on the violation of the unilateral constraints at the end of
+   *  a step in the adaptive time stepping (0: not checked)
+   */
+  double _adaptiveViolationTolerance = 0.0;
+
+  /** minimum time step of the adaptive time stepping */
+  double _adaptiveHMin = 0.0;
+
+  /** maximum time step of the adaptive time stepping */
+  double _adaptiveHMax = 0.0;
+
+  /** time step of the iteration matrices of the integrators */
+  double _adaptiveHMatrices = 0.0;
+
+  /** number of steps rejected by the controller */
+  unsigned int _adaptiveNbRejectedSteps = 0;
+
   /** Default Constructor
    */
   TimeStepping()
@@ -139,6 +161,29 @@ protected:
    */
   virtual void newtonSolve(double criterion, unsigned int maxStep);
 
+  /** step from current event to next event with the time step given by the
+   *  adaptive controller. The step is computed again with a smaller time
+   *  step while the error estimate is above the tolerances.
+   */
+  void adaptiveAdvanceToEvent();
+
+  /** error estimate of the last step, relative to the tolerances of the
+   *  adaptive time stepping
+   *
+   *  \return the ratio error / tolerance, the step is rejected if it is > 1
+   */
+  double adaptiveErrorRatio();
+
+  /** update the iteration matrices of the integrators and the nonsmooth
+   *  problems after a change of the time step
+   */
+  void updateTimeStepMatrices();
+
+  /** restore the state of the dynamical systems at the beginning of the
+   *  step from their memories (rejected step)
+   */
+  void restoreStateFromMemory();
+
 public:
   /** initialisation specific to TimeStepping for OneStepNSProblem.
    */
@@ -372,6 +417,40 @@ public:
    */
   double newtonResiduRMax() { return _newtonResiduRMax; };
 
+  /** enable the adaptive time stepping.
+   *
+   *  The time step of the TimeDiscretisation is then only used for the
+   *  first step. The local error is estimated on the positions from the
+   *  variation of the velocities during a step (the difference between the
+   *  scheme and an explicit Euler step), on smooth phases only: the steps
+   *  with an impact are measured by the violation of the unilateral
+   *  constraints (penetration, or gap of an active contact). A step with
+   *  an error above the tolerances is rejected, the state is restored from
+   *  the memories and the step is computed again with a smaller time step.
+   *  Only available with MoreauJeanOSI integrators and a constant time step
+   *  TimeDiscretisation.
+   *
+   *  \param tolerance tolerance on the local error of the positions
+   *  \param violationTolerance tolerance on the violation of the
+   *  constraints at the end of a step (0: not checked)
+   *  \param hMin minimum time step
+   *  \param hMax maximum time step
+   */
+  void setAdaptiveTimeStepping(double tolerance, double violationTolerance,
+                               double hMin, double hMax);
+
+  /** get the tolerance of the adaptive time stepping
+   *
+   *  \return the tolerance, 0 if the time step is constant
+   */
+  double adaptiveTolerance() { return _adaptiveTolerance; };
+
+  /** get the number of steps rejected by the adaptive time stepping
+   *
+   *  \return the number of rejected steps
+   */
+  unsigned int adaptiveNbRejectedSteps() { return _adaptiveNbRejectedSteps; };
+
   ACCEPT_STD_VISITORS();
 };
 
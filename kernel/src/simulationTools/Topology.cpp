@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <unordered_set>
 
 //#define DEBUG_STDOUT
 //#define DEBUG_MESSAGES 1
@@ -224,6 +225,39 @@ void Topology::__removeInteractionFromIndexSet(SP::Interaction inter)
 }
 
 
+/* an edge is removed from _DSG graph if its interaction belongs to a
+   set of interactions to remove, the corresponding vertex is then
+   removed from the adjoint graph (_IG)
+*/
+struct VertexIsInSet
+{
+  VertexIsInSet(const std::unordered_set<Interaction*>& I,
+                SP::DynamicalSystemsGraph sg, SP::InteractionsGraph asg) :
+    _I(I), __DSG(sg), __IG(asg) {};
+  bool operator()(DynamicalSystemsGraph::EDescriptor ed)
+  {
+    if(__IG->is_vertex(__DSG->bundle(ed)))
+    {
+      if(_I.count(&*__DSG->bundle(ed)))
+      {
+        __IG->remove_vertex(__DSG->bundle(ed));
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+    else
+    {
+      return true;
+    }
+  }
+  const std::unordered_set<Interaction*>& _I;
+  SP::DynamicalSystemsGraph __DSG;
+  SP::InteractionsGraph __IG;
+};
+
 void Topology::insertDynamicalSystem(SP::DynamicalSystem ds)
 {
   _DSG[0]->add_vertex(ds);
@@ -316,6 +350,35 @@ void Topology::removeInteraction(SP::Interaction inter)
   setHasChanged(true);
 }
 
+void Topology::removeInteractions(const std::vector<SP::Interaction>& inters)
+{
+  DEBUG_PRINTF("removeInteractions : %zu interactions\n", inters.size());
+
+  assert(_DSG[0]->edges_number() == _IG[0]->size());
+
+  // the dynamical systems involved, each one is visited once
+  std::unordered_set<Interaction*> toRemove;
+  std::vector<SP::DynamicalSystem> dss;
+  std::unordered_set<DynamicalSystem*> dsDone;
+  for(const SP::Interaction& inter : inters)
+  {
+    if(!_IG[0]->is_vertex(inter) || !toRemove.insert(&*inter).second)
+      continue;
+    InteractionProperties& prop = _IG[0]->properties(_IG[0]->descriptor(inter));
+    if(dsDone.insert(&*prop.source).second)
+      dss.push_back(prop.source);
+    if(dsDone.insert(&*prop.target).second)
+      dss.push_back(prop.target);
+  }
+
+  for(const SP::DynamicalSystem& ds : dss)
+    _DSG[0]->remove_out_edge_if(_DSG[0]->descriptor(ds),
+                                VertexIsInSet(toRemove, _DSG[0], _IG[0]));
+
+  assert(_DSG[0]->edges_number() == _IG[0]->size());
+  setHasChanged(true);
+}
+
 void Topology::removeDynamicalSystem(SP::DynamicalSystem ds)
 {
   DEBUG_PRINTF("removeDynamicalSystem : %p\n", &*ds);
@@ -339,17 +402,55 @@ Topology::link(SP::Interaction inter, SP::DynamicalSystem ds, SP::DynamicalSyste
     __removeInteractionFromIndexSet(inter);
   }
 
+  __setInteractionDSSizes(*inter, *ds, ds2);
+
+  return __addInteractionInIndexSet0(inter, ds, ds2);
+}
+
+void Topology::link(const InteractionLinks& links)
+{
+  DEBUG_PRINTF("Topology::link : %zu interactions\n", links.size());
+
+  // an interaction given several times keeps its last link, the other
+  // ones are skipped: it can be added only once in the graph
+  std::vector<const InteractionLink*> unique;
+  std::unordered_set<Interaction*> done;
+  for(auto l = links.rbegin(); l != links.rend(); ++l)
+    if(done.insert(&*std::get<0>(*l)).second)
+      unique.push_back(&*l);
+  std::reverse(unique.begin(), unique.end());
+
+  // the interactions already in the graph are removed at once, each of
+  // their dynamical systems being visited once (see removeInteractions)
+  std::vector<SP::Interaction> relinked;
+  for(const InteractionLink* l : unique)
+    if(_IG[0]->is_vertex(std::get<0>(*l)))
+      relinked.push_back(std::get<0>(*l));
+  if(!relinked.empty())
+    removeInteractions(relinked);
+
+  for(const InteractionLink* l : unique)
+  {
+    const SP::Interaction& inter = std::get<0>(*l);
+    const SP::DynamicalSystem& ds = std::get<1>(*l);
+    const SP::DynamicalSystem& ds2 = std::get<2>(*l);
+    __setInteractionDSSizes(*inter, *ds, ds2);
+    __addInteractionInIndexSet0(inter, ds, ds2);
+  }
+  setHasChanged(true);
+}
+
+void Topology::__setInteractionDSSizes(Interaction& inter, const DynamicalSystem& ds1,
+                                       const SP::DynamicalSystem& ds2)
+{
   // Compute interaction dimension (sum of involved dynamical systems sizes)
-  unsigned int sumOfDSSizes = 0;
-  sumOfDSSizes += ds->dimension();
+  unsigned int sumOfDSSizes = ds1.dimension();
   if(ds2)
   {
     sumOfDSSizes += ds2->dimension();
-    inter->setHas2Bodies(true);
+    inter.setHas2Bodies(true);
   }
-  inter->setDSSizes(sumOfDSSizes);
-
-  return __addInteractionInIndexSet0(inter, ds, ds2);
+  inter.setDSSizes(sumOfDSSizes);
 }
 
 bool Topology::hasInteraction(SP::Interaction inter) const
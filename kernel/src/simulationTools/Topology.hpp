@@ -96,6 +96,15 @@ private:
   std::pair<DynamicalSystemsGraph::EDescriptor, InteractionsGraph::VDescriptor>
   __addInteractionInIndexSet0(SP::Interaction inter, SP::DynamicalSystem ds1, SP::DynamicalSystem ds2 = SP::DynamicalSystem());
 
+  /** set the size of the dynamical systems linked to an Interaction (sum
+   *  of their dimensions) and whether it has two of them
+   *
+   *  \param inter the Interaction
+   *  \param ds1 the first dynamical system linked to the interaction
+   *  \param ds2 the second dynamical system, may be null
+   */
+  void __setInteractionDSSizes(Interaction& inter, const DynamicalSystem& ds1, const SP::DynamicalSystem& ds2);
+
   /** remove an Interaction from _IG and _DSG
    *
    *  \param inter a pointer to the Interaction to be removed
@@ -146,6 +155,14 @@ public:
    */
   void removeInteraction(SP::Interaction inter);
 
+  /** remove several Interactions from the topology. Each dynamical
+   *  system involved is visited once, whatever the number of its
+   *  interactions to remove.
+   *
+   *  \param inters the interactions to remove
+   */
+  void removeInteractions(const std::vector<SP::Interaction>& inters);
+
   /** add a dynamical system
    *
    *  \param ds the DynamicalSystem to add
@@ -206,6 +223,16 @@ public:
   std::pair<DynamicalSystemsGraph::EDescriptor, InteractionsGraph::VDescriptor>
   link(SP::Interaction inter, SP::DynamicalSystem ds, SP::DynamicalSystem ds2 = SP::DynamicalSystem());
 
+  /** link several interactions to their dynamical systems. Those already
+   *  in the graph are first removed together, as with removeInteractions,
+   *  then each interaction is added. An interaction given several times
+   *  is linked once, with its last dynamical systems, as with successive
+   *  calls to link. The topology is marked as changed once.
+   *
+   *  \param links the interactions and their dynamical systems
+   */
+  void link(const InteractionLinks& links);
+
   /** specify if the given Interaction is for controlling the DS
    *
    *  \param inter Interaction
@@ -143,3 +143,214 @@ void LsodarTest::testCstGradNLDS()
   std::cout <<std::endl <<std::endl;
 }
 
+
+/* the states of a few uncoupled stiff systems, first order and
+ * lagrangian ones, at each event, integrated with a full (jt = 2) or a
+ * band (jt = 4) jacobian */
+static std::vector<SiconosVector> stiffTrajectory(bool banded, integer& jt, integer& nje)
+{
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0., 2.));
+  std::vector<SP::DynamicalSystem> systems;
+
+  for(unsigned int i = 0; i < 3; ++i)
+  {
+    SP::SiconosMatrix A(new SimpleMatrix(2, 2));
+    (*A)(0, 0) = -1000. * (i + 1);
+    (*A)(0, 1) = 1.;
+    (*A)(1, 0) = 0.5;
+    (*A)(1, 1) = -1.;
+    SP::SiconosVector b(new SiconosVector(2));
+    b->setValue(1, 0.1 * i);
+    SP::SiconosVector x0(new SiconosVector(2));
+    x0->setValue(0, 1. + i);
+    x0->setValue(1, -1. + i);
+    systems.push_back(SP::DynamicalSystem(new FirstOrderLinearTIDS(x0, A, b)));
+  }
+
+  SP::SiconosVector q0(new SiconosVector(2));
+  SP::SiconosVector v0(new SiconosVector(2));
+  q0->setValue(0, 1.);
+  q0->setValue(1, -0.5);
+  SP::SiconosMatrix M(new SimpleMatrix(2, 2));
+  (*M)(0, 0) = (*M)(1, 1) = 1.;
+  SP::SiconosMatrix K(new SimpleMatrix(2, 2));
+  (*K)(0, 0) = 100.;
+  (*K)(1, 1) = 400.;
+  (*K)(0, 1) = (*K)(1, 0) = -50.;
+  SP::SiconosMatrix C(new SimpleMatrix(2, 2));
+  (*C)(0, 0) = 1.;
+  (*C)(1, 1) = 2.;
+  systems.push_back(SP::DynamicalSystem(new LagrangianLinearTIDS(q0, v0, M, K, C)));
+
+  SP::EventDriven sim(new EventDriven(nsds, SP::TimeDiscretisation(new TimeDiscretisation(0., 0.1)), 0));
+  SP::LsodarOSI lsodar(new LsodarOSI());
+  lsodar->setBandedJacobian(banded);
+  lsodar->setTol(1, 1e-10, 1e-12);
+  for(unsigned int i = 0; i < systems.size(); ++i)
+  {
+    nsds->insertDynamicalSystem(systems[i]);
+    sim->associate(lsodar, systems[i]);
+  }
+  sim->initialize();
+  jt = lsodar->intData(8);
+
+  std::vector<SiconosVector> trajectory;
+  while(sim->hasNextEvent())
+  {
+    sim->advanceToEvent();
+    sim->processEvents();
+    SiconosVector x(10);
+    for(unsigned int i = 0; i < 3; ++i)
+    {
+      x.setValue(2 * i, systems[i]->x()->getValue(0));
+      x.setValue(2 * i + 1, systems[i]->x()->getValue(1));
+    }
+    LagrangianDS& lds = static_cast<LagrangianDS&>(*systems[3]);
+    for(unsigned int k = 0; k < 2; ++k)
+    {
+      x.setValue(6 + k, lds.q()->getValue(k));
+      x.setValue(8 + k, lds.velocity()->getValue(k));
+    }
+    trajectory.push_back(x);
+  }
+  // number of jacobian evaluations
+  nje = lsodar->getIwork()[12];
+  return trajectory;
+}
+
+void LsodarTest::testBandedJacobian()
+{
+  std::cout << "------- Integrate stiff systems with a full and a band jacobian -------" <<std::endl;
+  integer jtFull, jtBanded, njeFull, njeBanded;
+  std::vector<SiconosVector> full = stiffTrajectory(false, jtFull, njeFull);
+  std::vector<SiconosVector> banded = stiffTrajectory(true, jtBanded, njeBanded);
+
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testBandedJacobian : jt ", (integer) 2, jtFull);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testBandedJacobian : jt ", (integer) 4, jtBanded);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testBandedJacobian : events ", full.size(), banded.size());
+  CPPUNIT_ASSERT(full.size() > 10);
+  // the stiff method, with its jacobian, is used
+  CPPUNIT_ASSERT(njeFull > 0);
+  CPPUNIT_ASSERT(njeBanded > 0);
+
+  double error = 0.;
+  for(unsigned int k = 0; k < full.size(); ++k)
+  {
+    SiconosVector diff(full[k]);
+    diff -= banded[k];
+    error = std::max(error, diff.normInf() / std::max(1., full[k].normInf()));
+  }
+  std::cout << "jacobian evaluations: " << njeFull << " (full), " << njeBanded << " (band)"
+            << ", max relative difference of the trajectories: " << error << std::endl;
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testBandedJacobian : trajectories ", error < 1e-6, true);
+}
+
+/* The right-hand side and its jacobian given to Lsodar by EventDriven,
+ * for a lagrangian system (with stiffness and damping) in contact with
+ * the ground through its first coordinate and a first order system. The
+ * derivatives of the lagrangian state are read from its velocity and
+ * acceleration, through the pointer links of LsodarOSI, with the
+ * acceleration LCP inactive (free flight) and active (resting contact). */
+void LsodarTest::testLagrangianRhs()
+{
+  std::cout << "------- Right-hand side and jacobian of a lagrangian system with contact -------" <<std::endl;
+  for(int contact = 0; contact < 2; ++contact)
+  {
+    SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0., 1.));
+    SP::SiconosVector q0(new SiconosVector(2));
+    SP::SiconosVector v0(new SiconosVector(2));
+    q0->setValue(0, contact ? 0. : 1.);
+    q0->setValue(1, 0.5);
+    v0->setValue(0, contact ? 0. : 2.);
+    v0->setValue(1, -1.);
+    SP::SiconosMatrix M(new SimpleMatrix(2, 2));
+    (*M)(0, 0) = 2.;
+    (*M)(1, 1) = 1.;
+    SP::SiconosMatrix K(new SimpleMatrix(2, 2));
+    (*K)(0, 0) = 3.;
+    (*K)(1, 1) = 4.;
+    (*K)(0, 1) = (*K)(1, 0) = 1.;
+    SP::SiconosMatrix C(new SimpleMatrix(2, 2));
+    (*C)(0, 0) = 0.1;
+    (*C)(1, 1) = 0.2;
+    SP::LagrangianLinearTIDS lds(new LagrangianLinearTIDS(q0, v0, M, K, C));
+    SP::SiconosVector weight(new SiconosVector(2));
+    weight->setValue(0, -9.81 * 2.);
+    lds->setFExtPtr(weight);
+
+    SP::SiconosMatrix A(new SimpleMatrix(2, 2));
+    (*A)(0, 0) = -1.;
+    (*A)(0, 1) = 2.;
+    (*A)(1, 1) = -3.;
+    SP::SiconosVector b(new SiconosVector(2));
+    b->setValue(0, 0.5);
+    SP::SiconosVector x0(new SiconosVector(2));
+    x0->setValue(0, 1.);
+    x0->setValue(1, -1.);
+    SP::FirstOrderLinearTIDS fods(new FirstOrderLinearTIDS(x0, A, b));
+
+    SP::SimpleMatrix H(new SimpleMatrix(1, 2));
+    (*H)(0, 0) = 1.;
+    SP::Interaction inter(new Interaction(SP::NonSmoothLaw(new NewtonImpactNSL(0.5)),
+                                          SP::Relation(new LagrangianLinearTIR(H))));
+    nsds->insertDynamicalSystem(lds);
+    nsds->insertDynamicalSystem(fods);
+    nsds->link(inter, lds);
+
+    SP::EventDriven sim(new EventDriven(nsds, SP::TimeDiscretisation(new TimeDiscretisation(0., 0.1))));
+    SP::LsodarOSI lsodar(new LsodarOSI());
+    sim->associate(lsodar, lds);
+    sim->associate(lsodar, fods);
+    sim->insertNonSmoothProblem(SP::OneStepNSProblem(new LCP()), SICONOS_OSNSP_ED_IMPACT);
+    sim->insertNonSmoothProblem(SP::OneStepNSProblem(new LCP()), SICONOS_OSNSP_ED_SMOOTH_ACC);
+    sim->initialize();
+    sim->firstInitialize();
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testLagrangianRhs : acceleration LCP ", contact == 1,
+                                 (*sim->oneStepNSProblems())[SICONOS_OSNSP_ED_SMOOTH_ACC]->hasInteractions());
+
+    // x = (q, v, x) and its derivative
+    integer n = 6;
+    double t = 0.;
+    double x[6] = {q0->getValue(0), q0->getValue(1), v0->getValue(0), v0->getValue(1),
+                   x0->getValue(0), x0->getValue(1)
+                  };
+    double xdot[6];
+    sim->computef(*lsodar, &n, &t, x, xdot);
+
+    double force[2];
+    for(unsigned int i = 0; i < 2; ++i)
+      force[i] = weight->getValue(i)
+                 - (*K)(i, 0) * x[0] - (*K)(i, 1) * x[1]
+                 - (*C)(i, 0) * x[2] - (*C)(i, 1) * x[3];
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(x[2], xdot[0], 1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(x[3], xdot[1], 1e-12);
+    if(contact)
+    {
+      // the contact force cancels the acceleration towards the ground
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(0., xdot[2], 1e-10);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(-force[0], inter->lambda(2)->getValue(0), 1e-10);
+    }
+    else
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(force[0] / (*M)(0, 0), xdot[2], 1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(force[1] / (*M)(1, 1), xdot[3], 1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL((*A)(0, 0) * x[4] + (*A)(0, 1) * x[5] + b->getValue(0), xdot[4], 1e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL((*A)(1, 0) * x[4] + (*A)(1, 1) * x[5] + b->getValue(1), xdot[5], 1e-12);
+
+    // full jacobian, column major, zeroed by Lsodar before the call
+    integer nrowpd = 6;
+    double jacob[36] = {0.};
+    sim->computeJacobianfx(*lsodar, &n, &t, x, jacob, &nrowpd);
+    SimpleMatrix ref(6, 6);
+    ref(0, 2) = ref(1, 3) = 1.;
+    for(unsigned int i = 0; i < 2; ++i)
+      for(unsigned int j = 0; j < 2; ++j)
+      {
+        ref(2 + i, j) = -(*K)(i, j) / (*M)(i, i);
+        ref(2 + i, 2 + j) = -(*C)(i, j) / (*M)(i, i);
+        ref(4 + i, 4 + j) = (*A)(i, j);
+      }
+    for(unsigned int i = 0; i < 6; ++i)
+      for(unsigned int j = 0; j < 6; ++j)
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(ref(i, j), jacob[i + 6 * j], 1e-12);
+  }
+}
@@ -20,6 +20,7 @@
 
 #include <cppunit/extensions/HelperMacros.h>
 #include "FirstOrderLinearTIDS.hpp"
+#include "LagrangianLinearTIDS.hpp"
 #include "LsodarOSI.hpp"
 #include "EventDriven.hpp"
 #include "TimeDiscretisation.hpp"
@@ -29,6 +30,9 @@
 #include "Interaction.hpp"
 #include "NonSmoothDynamicalSystem.hpp"
 #include "Relay.hpp"
+#include "LagrangianLinearTIR.hpp"
+#include "NewtonImpactNSL.hpp"
+#include "LCP.hpp"
 
 class LsodarTest : public CppUnit::TestFixture
 {
@@ -46,6 +50,8 @@ private:
   CPPUNIT_TEST(testCstGradTIDS);
   CPPUNIT_TEST(testCstGradDS);
   CPPUNIT_TEST(testCstGradNLDS);
+  CPPUNIT_TEST(testBandedJacobian);
+  CPPUNIT_TEST(testLagrangianRhs);
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -54,6 +60,8 @@ private:
   void testCstGradTIDS();
   void testCstGradDS();
   void testCstGradNLDS();
+  void testBandedJacobian();
+  void testLagrangianRhs();
   // Members
 
   unsigned int _n;
@@ -18,6 +18,9 @@
 #include "OSNSPTest.hpp"
 #include "SolverOptions.h"
 #include "FrictionContact.hpp"
+#include "GlobalFrictionContact.hpp"
+#include "NumericsMatrix.h"
+#include "SiconosKernel.hpp"
 
 // test suite registration
 CPPUNIT_TEST_SUITE_REGISTRATION(OSNSPTest);
@@ -58,3 +61,182 @@ void OSNSPTest::testOSNSBuild_options()
   auto options_link = problem->numericsSolverOptions();
   CPPUNIT_ASSERT_EQUAL_MESSAGE("test solver options : ",  options_link->solverId == SICONOS_FRICTION_3D_ADMM, true);
 }
+
+// Points sliding on the ground, without coupling: each contact is an
+// island, solved separately.
+static SP::SiconosVector slidingPoints(bool islands, NM_types storage, size_t & nbIslands)
+{
+  int nb = 3;
+  double h = 0.005;
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0., 0.2));
+  SP::NewtonImpactFrictionNSL nslaw(new NewtonImpactFrictionNSL(0.5, 0., 0.3, 3));
+  SP::SimpleMatrix H(new SimpleMatrix(3, 3));
+  H->setValue(0, 2, 1.);
+  H->setValue(1, 0, 1.);
+  H->setValue(2, 1, 1.);
+  std::vector<SP::LagrangianLinearTIDS> points;
+  for(int i = 0; i < nb; i++)
+  {
+    SP::SiconosVector q0(new SiconosVector(3));
+    SP::SiconosVector v0(new SiconosVector(3));
+    v0->setValue(0, 1.0 - 0.3 * i);
+    v0->setValue(1, 0.2 * i);
+    SP::SimpleMatrix mass(new SimpleMatrix(3, 3));
+    mass->eye();
+    SP::LagrangianLinearTIDS ds(new LagrangianLinearTIDS(q0, v0, mass));
+    SP::SiconosVector weight(new SiconosVector(3));
+    weight->setValue(2, -9.81);
+    ds->setFExtPtr(weight);
+    nsds->insertDynamicalSystem(ds);
+    SP::Interaction inter(new Interaction(nslaw, SP::Relation(new LagrangianLinearTIR(H))));
+    nsds->link(inter, ds);
+    points.push_back(ds);
+  }
+  SP::TimeDiscretisation td(new TimeDiscretisation(0., h));
+  SP::MoreauJeanOSI osi(new MoreauJeanOSI(0.5));
+  SP::FrictionContact osnspb(new FrictionContact(3));
+  osnspb->numericsSolverOptions()->dparam[SICONOS_DPARAM_TOL] = 1e-10;
+  osnspb->setMStorageType(storage);
+  osnspb->setComputeIslands(islands);
+  SP::TimeStepping s(new TimeStepping(nsds, td, osi, osnspb));
+  nbIslands = 0;
+  while(s->hasNextEvent())
+  {
+    s->computeOneStep();
+    nbIslands = std::max(nbIslands, osnspb->islands().size());
+    s->nextStep();
+  }
+  SP::SiconosVector q(new SiconosVector(3 * nb));
+  for(int i = 0; i < nb; i++)
+    setBlock(*points[i]->q(), q, 3, 0, 3 * i);
+  return q;
+}
+
+void OSNSPTest::testOSNSIslands()
+{
+  size_t nbIslands = 0;
+  SP::SiconosVector ref = slidingPoints(false, NM_DENSE, nbIslands);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test islands : ", nbIslands, (size_t)0);
+  for(NM_types storage : {NM_DENSE, NM_SPARSE_BLOCK})
+  {
+    SP::SiconosVector q = slidingPoints(true, storage, nbIslands);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("test islands : ", nbIslands, (size_t)3);
+    *q -= *ref;
+    CPPUNIT_ASSERT_MESSAGE("test islands : ", q->normInf() < 1e-10);
+  }
+}
+
+// The same points, with a global formulation: the contacts do not change,
+// so the second step must refill the sparse matrices of the first one in
+// place and keep the symbolic analysis of their factorization.
+void OSNSPTest::testGlobalAssemblyReuse()
+{
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0., 0.2));
+  SP::NewtonImpactFrictionNSL nslaw(new NewtonImpactFrictionNSL(0.5, 0., 0.3, 3));
+  SP::SimpleMatrix H(new SimpleMatrix(3, 3));
+  H->setValue(0, 2, 1.);
+  H->setValue(1, 0, 1.);
+  H->setValue(2, 1, 1.);
+  for(int i = 0; i < 3; i++)
+  {
+    SP::SiconosVector q0(new SiconosVector(3));
+    SP::SiconosVector v0(new SiconosVector(3));
+    v0->setValue(0, 1.0 - 0.3 * i);
+    SP::SimpleMatrix mass(new SimpleMatrix(3, 3));
+    mass->eye();
+    *mass *= 1. + i;
+    SP::LagrangianLinearTIDS ds(new LagrangianLinearTIDS(q0, v0, mass));
+    SP::SiconosVector weight(new SiconosVector(3));
+    weight->setValue(2, -9.81 * (1. + i));
+    ds->setFExtPtr(weight);
+    nsds->insertDynamicalSystem(ds);
+    nsds->link(SP::Interaction(new Interaction(nslaw, SP::Relation(new LagrangianLinearTIR(H)))), ds);
+  }
+  SP::TimeDiscretisation td(new TimeDiscretisation(0., 0.005));
+  SP::MoreauJeanGOSI osi(new MoreauJeanGOSI(0.5));
+  std::shared_ptr<GlobalFrictionContact> osnspb(new GlobalFrictionContact(3));
+  SP::TimeStepping s(new TimeStepping(nsds, td, osi, osnspb));
+
+  s->computeOneStep();
+  s->nextStep();
+  NumericsMatrix* W = osnspb->globalFrictionContactProblemPtr()->M;
+  NumericsMatrix* Hg = osnspb->globalFrictionContactProblemPtr()->H;
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test global assembly : ", W->storageType, NM_SPARSE);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test global assembly : ", Hg->size1, 9);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test global assembly : ", NM_Cholesky_factorize(W), 0);
+  CSparseMatrix_symbolic* symbolic = NM_internalData(W)->symbolic;
+  CPPUNIT_ASSERT_MESSAGE("test global assembly : ", symbolic);
+
+  s->computeOneStep();
+  CPPUNIT_ASSERT_MESSAGE("test global assembly : ",
+                         osnspb->globalFrictionContactProblemPtr()->M == W);
+  CPPUNIT_ASSERT_MESSAGE("test global assembly : ",
+                         osnspb->globalFrictionContactProblemPtr()->H == Hg);
+  // the new values are there and the previous factorization is discarded
+  CPPUNIT_ASSERT_MESSAGE("test global assembly : ", !NM_Cholesky_factorized(W));
+  for(int i = 0; i < 9; i++)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1. + i / 3, NM_get_value(W, i, i), 1e-14);
+  // H is the transpose of the relation matrices
+  for(int k = 0; k < 3; k++)
+  {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1., NM_get_value(Hg, 3 * k + 2, 3 * k), 1e-14);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1., NM_get_value(Hg, 3 * k, 3 * k + 1), 1e-14);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1., NM_get_value(Hg, 3 * k + 1, 3 * k + 2), 1e-14);
+  }
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test global assembly : ", NM_Cholesky_factorize(W), 0);
+  CPPUNIT_ASSERT_MESSAGE("test global assembly : ", NM_internalData(W)->symbolic == symbolic);
+}
+
+#ifdef SICONOS_HAS_MPI
+// The communicator given to the global problem is attached to the numerics
+// matrices M and H each time the problem is formed, and the problem is
+// solved on one process.
+void OSNSPTest::testGlobalMPIComm()
+{
+  int initialized = 0;
+  MPI_Initialized(&initialized);
+  if(!initialized)
+    MPI_Init(NULL, NULL);
+
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0., 0.2));
+  SP::NewtonImpactFrictionNSL nslaw(new NewtonImpactFrictionNSL(0.5, 0., 0.3, 3));
+  SP::SimpleMatrix H(new SimpleMatrix(3, 3));
+  H->setValue(0, 2, 1.);
+  H->setValue(1, 0, 1.);
+  H->setValue(2, 1, 1.);
+  SP::SiconosVector q0(new SiconosVector(3));
+  SP::SiconosVector v0(new SiconosVector(3));
+  v0->setValue(0, 1.0);
+  SP::SimpleMatrix mass(new SimpleMatrix(3, 3));
+  mass->eye();
+  SP::LagrangianLinearTIDS ds(new LagrangianLinearTIDS(q0, v0, mass));
+  SP::SiconosVector weight(new SiconosVector(3));
+  weight->setValue(2, -9.81);
+  ds->setFExtPtr(weight);
+  nsds->insertDynamicalSystem(ds);
+  nsds->link(SP::Interaction(new Interaction(nslaw, SP::Relation(new LagrangianLinearTIR(H)))), ds);
+  SP::TimeDiscretisation td(new TimeDiscretisation(0., 0.005));
+  SP::MoreauJeanGOSI osi(new MoreauJeanGOSI(0.5));
+  std::shared_ptr<GlobalFrictionContact> osnspb(new GlobalFrictionContact(3));
+  CPPUNIT_ASSERT_MESSAGE("test MPI communicator : ", osnspb->mpiComm() == MPI_COMM_NULL);
+  osnspb->setMPIComm(MPI_COMM_SELF);
+  CPPUNIT_ASSERT_MESSAGE("test MPI communicator : ", osnspb->mpiComm() == MPI_COMM_SELF);
+  SP::TimeStepping s(new TimeStepping(nsds, td, osi, osnspb));
+
+  for(int k = 0; k < 2; k++)
+  {
+    s->computeOneStep();
+    GlobalFrictionContactProblem* problem = osnspb->globalFrictionContactProblemPtr();
+    CPPUNIT_ASSERT_MESSAGE("test MPI communicator : ", NM_MPI_comm(problem->M) == MPI_COMM_SELF);
+    CPPUNIT_ASSERT_MESSAGE("test MPI communicator : ", NM_MPI_comm(problem->H) == MPI_COMM_SELF);
+    s->nextStep();
+  }
+  // the point stays on the ground (up to the solver tolerance) and is
+  // slowed down by the friction
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0., ds->q()->getValue(2), 1e-5);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1. - 2 * 0.3 * 9.81 * 0.005, ds->velocity()->getValue(0), 1e-4);
+
+  if(!initialized)
+    MPI_Finalize();
+}
+#endif
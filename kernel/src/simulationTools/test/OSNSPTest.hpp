@@ -19,6 +19,7 @@
 #define __OSNSPTest__
 
 #include <cppunit/extensions/HelperMacros.h>
+#include "SiconosConfig.h" // for SICONOS_HAS_MPI // IWYU pragma: keep
 
 class OSNSPTest : public CppUnit::TestFixture
 {
@@ -31,11 +32,21 @@ private:
   CPPUNIT_TEST(testOSNSBuild_default);
   CPPUNIT_TEST(testOSNSBuild_solverid);
   CPPUNIT_TEST(testOSNSBuild_options);
+  CPPUNIT_TEST(testOSNSIslands);
+  CPPUNIT_TEST(testGlobalAssemblyReuse);
+#ifdef SICONOS_HAS_MPI
+  CPPUNIT_TEST(testGlobalMPIComm);
+#endif
   CPPUNIT_TEST_SUITE_END();
 
   void testOSNSBuild_default();
   void testOSNSBuild_solverid();
   void testOSNSBuild_options();
+  void testOSNSIslands();
+  void testGlobalAssemblyReuse();
+#ifdef SICONOS_HAS_MPI
+  void testGlobalMPIComm();
+#endif
 
 
 public:
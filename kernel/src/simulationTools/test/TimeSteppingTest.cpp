@@ -0,0 +1,220 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include "TimeSteppingTest.hpp"
+#include "SiconosKernel.hpp"
+
+// test suite registration
+CPPUNIT_TEST_SUITE_REGISTRATION(TimeSteppingTest);
+
+// gives access to the recycling of the InteractionManager
+class RecyclingManager : public InteractionManager
+{
+public:
+  SP::LagrangianLinearTIR relation()
+  {
+    return recycledRelation<LagrangianLinearTIR>();
+  }
+  SP::Interaction interaction(SP::NonSmoothLaw nslaw, SP::Relation rel)
+  {
+    return makeInteraction(nslaw, rel);
+  }
+  size_t poolSize()
+  {
+    return _interactionPool[std::type_index(typeid(LagrangianLinearTIR))].size();
+  }
+  size_t nbReserved()
+  {
+    return _reservedInteractions.size();
+  }
+};
+
+
+void TimeSteppingTest::setUp()
+{}
+
+void TimeSteppingTest::tearDown()
+{}
+
+// A ball bouncing on the ground: the time step grows during the flights
+// and is reduced at the impacts.
+void TimeSteppingTest::testAdaptiveTimeStepping()
+{
+  double h = 1e-3;
+  double T = 2.0;
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0., T));
+  SP::SiconosVector q0(new SiconosVector(1, 1.0));
+  SP::SiconosVector v0(new SiconosVector(1, 0.0));
+  SP::SimpleMatrix mass(new SimpleMatrix(1, 1));
+  mass->eye();
+  SP::LagrangianLinearTIDS ball(new LagrangianLinearTIDS(q0, v0, mass));
+  SP::SiconosVector weight(new SiconosVector(1, -9.81));
+  ball->setFExtPtr(weight);
+  nsds->insertDynamicalSystem(ball);
+  SP::SimpleMatrix H(new SimpleMatrix(1, 1));
+  H->eye();
+  SP::Interaction inter(new Interaction(SP::NonSmoothLaw(new NewtonImpactNSL(0.9)),
+                                        SP::Relation(new LagrangianLinearTIR(H))));
+  nsds->link(inter, ball);
+
+  SP::TimeDiscretisation td(new TimeDiscretisation(0., h));
+  SP::MoreauJeanOSI osi(new MoreauJeanOSI(0.5));
+  SP::LCP osnspb(new LCP());
+  SP::TimeStepping s(new TimeStepping(nsds, td, osi, osnspb));
+  s->setAdaptiveTimeStepping(1e-2, 1e-3, 1e-5, 0.05);
+
+  unsigned int nbSteps = 0;
+  double hMax = 0.;
+  double qMin = 1.0;
+  double qMaxAfterImpact = 0.;
+  bool hasBounced = false;
+  while(s->hasNextEvent())
+  {
+    s->computeOneStep();
+    hMax = std::max(hMax, s->timeStep());
+    double q = ball->q()->getValue(0);
+    double v = ball->velocity()->getValue(0);
+    qMin = std::min(qMin, q);
+    if(v > 0.)
+      hasBounced = true;
+    if(hasBounced)
+      qMaxAfterImpact = std::max(qMaxAfterImpact, q);
+    s->nextStep();
+    nbSteps++;
+  }
+
+  std::cout << "adaptive time stepping: " << nbSteps << " steps, "
+            << s->adaptiveNbRejectedSteps() << " rejected, largest step " << hMax << std::endl;
+  CPPUNIT_ASSERT_MESSAGE("test adaptive time stepping, final time : ",
+                         std::fabs(s->startingTime() - T) < 1e-12);
+  CPPUNIT_ASSERT_MESSAGE("test adaptive time stepping, number of steps : ",
+                         nbSteps < T / h / 4);
+  CPPUNIT_ASSERT_MESSAGE("test adaptive time stepping, step growth : ", hMax > 10 * h);
+  CPPUNIT_ASSERT_MESSAGE("test adaptive time stepping, rejected steps : ",
+                         s->adaptiveNbRejectedSteps() > 0);
+  CPPUNIT_ASSERT_MESSAGE("test adaptive time stepping, bounce : ", hasBounced);
+  // with e = 0.9, the ball goes back up to about 0.81
+  CPPUNIT_ASSERT_MESSAGE("test adaptive time stepping, height after the bounce : ",
+                         qMaxAfterImpact > 0.75 && qMaxAfterImpact < 0.85);
+  CPPUNIT_ASSERT_MESSAGE("test adaptive time stepping, penetration : ", qMin > -2e-3);
+}
+
+// A ball on the ground, whose contact is removed and created again through
+// the pool of the interaction manager.
+void TimeSteppingTest::testInteractionRecycling()
+{
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0., 10.));
+  SP::SiconosVector q0(new SiconosVector(1, 0.1));
+  SP::SiconosVector v0(new SiconosVector(1, 0.0));
+  SP::SimpleMatrix mass(new SimpleMatrix(1, 1));
+  mass->eye();
+  SP::LagrangianLinearTIDS ball(new LagrangianLinearTIDS(q0, v0, mass));
+  SP::SiconosVector weight(new SiconosVector(1, -9.81));
+  ball->setFExtPtr(weight);
+  nsds->insertDynamicalSystem(ball);
+  SP::SimpleMatrix H(new SimpleMatrix(1, 1));
+  H->eye();
+  SP::NonSmoothLaw nslaw(new NewtonImpactNSL(0.));
+  SP::Interaction inter(new Interaction(nslaw, SP::Relation(new LagrangianLinearTIR(H))));
+  nsds->link(inter, ball);
+
+  SP::TimeDiscretisation td(new TimeDiscretisation(0., 1e-2));
+  SP::TimeStepping s(new TimeStepping(nsds, td, SP::MoreauJeanOSI(new MoreauJeanOSI(0.5)),
+                                      SP::LCP(new LCP())));
+  std::shared_ptr<RecyclingManager> manager(new RecyclingManager());
+  manager->setInteractionPoolSize(2);
+  s->insertInteractionManager(manager);
+
+  bool contact = false;
+  for(int k = 0; k < 30; k++)
+  {
+    s->computeOneStep();
+    contact = contact || inter->lambda(1)->getValue(0) > 0.;
+    s->nextStep();
+  }
+  CPPUNIT_ASSERT_MESSAGE("test recycling, contact : ", contact);
+
+  // unlink: the interaction goes to the pool, it is available once the
+  // changelog of the nsds does not reference it anymore. The simulation
+  // keeps the last change it has seen, so another change (here a new ds)
+  // is needed before the removal can be cleared.
+  Interaction* old = inter.get();
+  SP::Relation oldRelation = inter->relation();
+  size_t oldNumber = inter->number();
+  s->unlink(inter);
+  inter.reset();
+  oldRelation.reset();
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test recycling, pool : ", manager->poolSize(), (size_t)1);
+  s->computeOneStep();
+  s->nextStep();
+  s->clearNSDSChangeLog();
+  CPPUNIT_ASSERT_MESSAGE("test recycling, relation : ", !manager->relation());
+  SP::SiconosVector q1(new SiconosVector(1, 1.0));
+  nsds->insertDynamicalSystem(SP::LagrangianLinearTIDS(new LagrangianLinearTIDS(q1, v0, mass)));
+  s->computeOneStep();
+  s->nextStep();
+  s->clearNSDSChangeLog();
+
+  // makeInteraction with the recycled relation gives back the interaction
+  SP::LagrangianLinearTIR rel = manager->relation();
+  CPPUNIT_ASSERT_MESSAGE("test recycling, relation : ", rel);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test recycling, pool : ", manager->poolSize(), (size_t)0);
+  inter = manager->interaction(nslaw, rel);
+  CPPUNIT_ASSERT_MESSAGE("test recycling, interaction : ", inter.get() == old);
+  CPPUNIT_ASSERT_MESSAGE("test recycling, number : ", inter->number() > oldNumber);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test recycling, lambda : ", inter->lambda(1)->normInf(), 0.);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test recycling, y : ", inter->y(0)->normInf(), 0.);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test recycling, reserved : ", manager->nbReserved(), (size_t)0);
+
+  // the recycled interaction is a new contact of the simulation: the
+  // ball, that has fallen below the ground while it was unlinked, stops
+  // once the contact is active
+  nsds->link(inter, ball);
+  contact = false;
+  double qContact = 0.;
+  for(int k = 0; k < 30; k++)
+  {
+    s->computeOneStep();
+    if(!contact && inter->lambda(1)->getValue(0) > 0.)
+    {
+      contact = true;
+      qContact = ball->q()->getValue(0);
+    }
+    s->nextStep();
+  }
+  CPPUNIT_ASSERT_MESSAGE("test recycling, contact : ", contact);
+  CPPUNIT_ASSERT_MESSAGE("test recycling, penetration : ", ball->q()->getValue(0) > qContact - 1e-8);
+
+  // a relation taken from the pool but not passed to makeInteraction:
+  // its interaction is released at the next update of the interactions
+  s->unlink(inter);
+  inter.reset();
+  rel.reset();
+  SP::SiconosVector q2(new SiconosVector(1, 2.0));
+  nsds->insertDynamicalSystem(SP::LagrangianLinearTIDS(new LagrangianLinearTIDS(q2, v0, mass)));
+  s->computeOneStep();
+  s->nextStep();
+  s->clearNSDSChangeLog();
+  rel = manager->relation();
+  CPPUNIT_ASSERT_MESSAGE("test recycling, relation : ", rel);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test recycling, reserved : ", manager->nbReserved(), (size_t)1);
+  s->updateInteractions();
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test recycling, reserved : ", manager->nbReserved(), (size_t)0);
+  // rel is still used here, its interaction is not pooled again
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test recycling, pool : ", manager->poolSize(), (size_t)0);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("test recycling, relation : ", rel.use_count(), (long)1);
+}
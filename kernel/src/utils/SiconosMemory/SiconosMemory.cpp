@@ -25,6 +25,8 @@
 // the size of the vectors.
 SiconosMemory::SiconosMemory(const unsigned int size, const unsigned int vectorSize): MemoryContainer(), _indx(size-1)
 {
+  // the vectors are allocated once, without moves of the container
+  reserve(size);
   for(unsigned int i = 0; i < size; i++)
   {
     push_back(SiconosVector(vectorSize));
@@ -37,6 +39,7 @@ SiconosMemory::SiconosMemory(const SiconosMemory& Mem)
     _nbVectorsInMemory(Mem.nbVectorsInMemory()),
     _indx(Mem.size()-1)
 {
+  reserve(Mem.size());
   for(unsigned int i = 0; i < Mem.size(); i++)
   {
     push_back(Mem[i]);
@@ -66,6 +69,7 @@ void SiconosMemory::setMemorySize(const unsigned int steps,
 {
   _nbVectorsInMemory = 0;
   _indx = steps-1;
+  reserve(steps);
   for(unsigned int i = 0; i < size(); i++)
   {
     this->at(i).resize(vectorSize, true);
@@ -81,13 +85,16 @@ void SiconosMemory::setMemorySize(const unsigned int steps,
 const SiconosVector& SiconosMemory::getSiconosVector(const unsigned int index) const
 {
   assert(index < _nbVectorsInMemory && "getSiconosVector(index) : inconsistent index value");
-  return this->at((_indx + 1 + index) % this->size());
+  // _indx + 1 + index < 2 * size(): no modulo needed
+  MemoryContainer::size_type pos = _indx + 1 + index;
+  if(pos >= this->size())
+    pos -= this->size();
+  return this->at(pos);
 }
 
 SiconosVector& SiconosMemory::getSiconosVectorMutable(const unsigned int index)
 {
-  assert(index < _nbVectorsInMemory && "getSiconosVector(index) : inconsistent index value");
-  return *(SiconosVector*)(&this->at((_indx + 1 + index) % this->size()));
+  return const_cast<SiconosVector&>(getSiconosVector(index));
 }
 
 void SiconosMemory::swap(const SiconosVector& v)
@@ -107,18 +114,9 @@ void SiconosMemory::swap(const SiconosVector& v)
 
 void SiconosMemory::swap(SP::SiconosVector v)
 {
-  // Be robust to empty memory
   // Be robust to null pointer
-  if(size()==0 || !v)
-    return;
-
-  // If _nbVectorsInMemory is this->size(), we remove the last element.
-  (*this)[_indx] = *v;
-  _nbVectorsInMemory = std::min(_nbVectorsInMemory+1, this->size());
-  if(_indx > 0)
-    _indx--;
-  else
-    _indx = this->size()-1;
+  if(v)
+    swap(*v);
 }
 
 void SiconosMemory::display() const
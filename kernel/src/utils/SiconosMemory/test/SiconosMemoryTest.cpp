@@ -165,6 +165,39 @@ void SiconosMemoryTest::testSwap()
   std::cout << "-->  swap test ended with success." <<std::endl;
 }
 
+// many swaps: first-in first-out order, and the vectors allocated by the
+// constructor are reused, without any reallocation
+void SiconosMemoryTest::testRingBuffer()
+{
+  std::cout << "--> Test: ring buffer." <<std::endl;
+  SiconosMemory mem(_sizeMem, sizeVect);
+  const SiconosVector* slots = mem.data();
+  std::vector<const double*> arrays;
+  for(unsigned int i = 0; i < _sizeMem; ++i)
+    arrays.push_back(mem[i].getArray());
+
+  SiconosVector v(sizeVect);
+  for(unsigned int k = 0; k < 10; ++k)
+  {
+    v.fill(k);
+    mem.swap(v);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testRingBuffer : _nbVectorsInMemory OK",
+                                 mem.nbVectorsInMemory() == std::min(k + 1, _sizeMem), true);
+    for(unsigned int i = 0; i < mem.nbVectorsInMemory(); ++i)
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("testRingBuffer : vector OK",
+                                   mem.getSiconosVector(i).getValue(0) == (double)(k - i), true);
+  }
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testRingBuffer : no reallocation", mem.data() == slots, true);
+  for(unsigned int i = 0; i < _sizeMem; ++i)
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("testRingBuffer : no reallocation", mem[i].getArray() == arrays[i], true);
+
+  // the mutable access sees the same slot
+  mem.getSiconosVectorMutable(1).setValue(2, -1.);
+  CPPUNIT_ASSERT_EQUAL_MESSAGE("testRingBuffer : mutable access OK",
+                               mem.getSiconosVector(1).getValue(2) == -1., true);
+  std::cout << "-->  ring buffer test ended with success." <<std::endl;
+}
+
 void SiconosMemoryTest::End()
 {
   //   std::cout <<"======================================" <<std::endl;
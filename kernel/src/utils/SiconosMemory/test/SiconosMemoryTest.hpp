@@ -39,6 +39,7 @@ private:
   CPPUNIT_TEST(testSetVectorMemory);
   CPPUNIT_TEST(testGetSiconosVector);
   CPPUNIT_TEST(testSwap);
+  CPPUNIT_TEST(testRingBuffer);
   CPPUNIT_TEST(End);
   CPPUNIT_TEST_SUITE_END();
 
@@ -48,6 +49,7 @@ private:
   void testSetVectorMemory();
   void testGetSiconosVector();
   void testSwap();
+  void testRingBuffer();
   void End();
 
   SP::MemoryContainer V1, V2, V3;
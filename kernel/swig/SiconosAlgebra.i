@@ -39,12 +39,23 @@
 %rename("solve_vector") *::Solve(SiconosVector &);
 
 
+// the output arguments of these methods, when given as numpy arrays,
+// are updated in place: getRow, getCol and toBlock (vOut), Solve,
+// PLUForwardBackwardInPlace and SolveByLeastSquares (B)
+%apply (SiconosVector & INPLACE) { (SiconosVector& vOut) };
+%apply (SiconosVector & INPLACE) { (SiconosVector& B) };
+%apply (SiconosMatrix& INPLACE) { (SiconosMatrix& B) };
+
 %include SiconosMatrix.hpp
 %include SimpleMatrix.hpp
 %include SiconosVector.hpp
 %include SiconosVectorIterator.hpp
 %include BlockVector.hpp
 
+%clear SiconosVector& vOut;
+%clear SiconosVector& B;
+%clear SiconosMatrix& B;
+
 %extend SiconosMatrix{
   std::string __str__() { return $self->toString(); }
     PyObject *__getitem__(PyObject *args) {
@@ -131,6 +131,14 @@ Example of usage:
 // 1. Vector and Matrix <=> numpy array (dense only)
 %include SiconosAlgebra.i
 
+// mpi4py communicators <=> MPI_Comm (GlobalFrictionContact::setMPIComm)
+#ifdef SICONOS_HAS_MPI
+#ifdef WITH_MPI4PY
+%include mpi4py/mpi4py.i
+%mpi4py_typemap(Comm, MPI_Comm);
+#endif
+#endif
+
 
 // 2. try to hide SP::Type on python side
 
@@ -167,6 +175,15 @@ namespace boost
 %feature("notabstract") TimeSteppingDirectProjection;
 %feature("notabstract") EventDriven;
 
+// release the GIL while the simulation integrates: python threads
+// (controllers, outputs) may run concurrently. Python code called back
+// from the kernel (directors) takes the GIL again.
+%feature("nothreadallow", "0") computeOneStep;
+%feature("nothreadallow", "0") advanceToEvent;
+%feature("nothreadallow", "0") Simulation::run;
+%feature("nothreadallow", "0") TimeStepping::run;
+%feature("nothreadallow", "0") TimeSteppingD1Minus::run;
+
 // common declarations with Numerics
 
 // note : solver_options_delete is call by ~LCP(), ~FrictionContact(), etc.
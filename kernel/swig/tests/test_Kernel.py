@@ -195,6 +195,26 @@ def test_BoundaryCondition():
     assert (B.velocityIndices() == [1, 2, 5]).all()
 
 
+def test_numpy_inplace_update():
+    # numpy arrays given for non-const SiconosVector / SiconosMatrix
+    # references are updated with the results
+    v = sk.SiconosVector([1.0, 2.0, 3.0])
+    out = np.zeros(4)
+    v.toBlock(out, 2, 1, 2)
+    assert (out == [0.0, 0.0, 2.0, 3.0]).all()
+
+    A = sk.SimpleMatrix(np.diag([2.0, 4.0]))
+    b = np.array([2.0, 8.0])
+    A.solve_vector(b)
+    assert np.allclose(b, [1.0, 2.0])
+
+    A = sk.SimpleMatrix(np.diag([2.0, 4.0]))
+    # C memory order: the temporary matrix is a fortran copy
+    B = np.array([[2.0, 4.0], [8.0, 12.0]])
+    A.solve_matrix(B)
+    assert np.allclose(B, [[1.0, 2.0], [2.0, 3.0]])
+
+
 if __name__ == "__main__":
 
     # execute only if run as a script
@@ -0,0 +1,17 @@
+#!/usr/bin/env python3
+
+# kept alone as we may want to run it with mpirun
+
+
+def test_gfc_mpi_comm():
+
+    # the mpi4py communicator is converted to a MPI_Comm by the kernel
+    # module and handed to the numerics matrices of the problem
+    import siconos.kernel as sk
+    from mpi4py import MPI
+
+    comm = MPI.COMM_WORLD
+
+    osnspb = sk.GlobalFrictionContact(3)
+    osnspb.setMPIComm(comm)
+    assert osnspb.mpiComm() == comm
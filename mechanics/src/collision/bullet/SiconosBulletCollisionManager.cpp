@@ -438,6 +438,7 @@ protected:
   void updateShape(BodyCH2dRecord &record);
 
   void updateAllShapesForDS(const SecondOrderDS &bds);
+  void setActivationForDS(const SecondOrderDS &bds, bool active);
   void updateShapePosition(const BodyBulletShapeRecord &record);
 
   /* Helper to apply an offset transform to a position and return as a
@@ -684,6 +685,13 @@ void SiconosBulletCollisionManager_impl::updateAllShapesForDS(const SecondOrderD
     (*it)->acceptSP(updateShapeVisitor);
 }
 
+void SiconosBulletCollisionManager_impl::setActivationForDS(const SecondOrderDS &bds, bool active)
+{
+  std::vector<std::shared_ptr<BodyBulletShapeRecord> >::iterator it;
+  for(it = bodyShapeMap[&bds].begin(); it != bodyShapeMap[&bds].end(); it++)
+    (*it)->btobject->forceActivationState(active ? ACTIVE_TAG : ISLAND_SLEEPING);
+}
+
 // helper for enabling polyhedral contact clipping for shape types
 // derived from btPolyhedralConvexShape
 static void initPolyhedralFeatures(btPolyhedralConvexShape& btshape)
@@ -2296,6 +2304,7 @@ public:
 
 // called once for each contact point as it is destroyed
 Simulation* SiconosBulletCollisionManager::gSimulation;
+std::vector<SP::Interaction>* SiconosBulletCollisionManager::gUnlinkedInteractions = nullptr;
 bool SiconosBulletCollisionManager::bulletContactClear(void* userPersistentData)
 {
   /* note: stored pointer to shared_ptr! */
@@ -2317,7 +2326,10 @@ bool SiconosBulletCollisionManager::bulletContactClear(void* userPersistentData)
   //   rel_bullet2d3DR->preDelete();
   // std::static_pointer_cast<BulletR>((*p_inter)->relation())->preDelete();
   //_stats.interaction_destroyed++;
-  gSimulation->unlink(*p_inter);
+  if(gUnlinkedInteractions)
+    gUnlinkedInteractions->push_back(*p_inter);
+  else
+    gSimulation->unlink(*p_inter);
   delete p_inter;
   return false;
 }
@@ -2486,7 +2498,8 @@ SP::BulletR SiconosBulletCollisionManager::makeBulletR(SP::RigidBodyDS ds1,
     SP::SiconosShape shape2,
     const btManifoldPoint &p)
 {
-  return std::make_shared<BulletR>();
+  SP::BulletR rel = recycledRelation<BulletR>();
+  return rel ? rel : std::make_shared<BulletR>();
 }
 SP::Bullet5DR SiconosBulletCollisionManager::makeBullet5DR(SP::RigidBodyDS ds1,
     SP::SiconosShape shape1,
@@ -2494,7 +2507,8 @@ SP::Bullet5DR SiconosBulletCollisionManager::makeBullet5DR(SP::RigidBodyDS ds1,
     SP::SiconosShape shape2,
     const btManifoldPoint &p)
 {
-  return std::make_shared<Bullet5DR>();
+  SP::Bullet5DR rel = recycledRelation<Bullet5DR>();
+  return rel ? rel : std::make_shared<Bullet5DR>();
 }
 SP::Bullet2dR SiconosBulletCollisionManager::makeBullet2dR(SP::RigidBody2dDS ds1,
     SP::SiconosShape shape1,
@@ -2502,7 +2516,8 @@ SP::Bullet2dR SiconosBulletCollisionManager::makeBullet2dR(SP::RigidBody2dDS ds1
     SP::SiconosShape shape2,
     const btManifoldPoint &p)
 {
-  return std::make_shared<Bullet2dR>();
+  SP::Bullet2dR rel = recycledRelation<Bullet2dR>();
+  return rel ? rel : std::make_shared<Bullet2dR>();
 }
 SP::Bullet2d3DR SiconosBulletCollisionManager::makeBullet2d3DR(SP::RigidBody2dDS ds1,
     SP::SiconosShape shape1,
@@ -2510,7 +2525,8 @@ SP::Bullet2d3DR SiconosBulletCollisionManager::makeBullet2d3DR(SP::RigidBody2dDS
     SP::SiconosShape shape2,
     const btManifoldPoint &p)
 {
-  return std::make_shared<Bullet2d3DR>();
+  SP::Bullet2d3DR rel = recycledRelation<Bullet2d3DR>();
+  return rel ? rel : std::make_shared<Bullet2d3DR>();
 }
 class CollisionUpdateVisitor : public SiconosVisitor
 {
@@ -2529,7 +2545,16 @@ public:
       {
         impl.createCollisionObjectsForBodyContactorSet(bds);
       }
-      impl.updateAllShapesForDS(*bds);
+      // A body frozen by its integrator does not move: its collision
+      // objects are put to sleep, so that bullet skips the pairs of
+      // sleeping objects and keeps their contact points.
+      if(bds->isSleeping())
+        impl.setActivationForDS(*bds, false);
+      else
+      {
+        impl.setActivationForDS(*bds, true);
+        impl.updateAllShapesForDS(*bds);
+      }
     }
   }
   void visit(SP::RigidBody2dDS bds)
@@ -2606,8 +2631,14 @@ void SiconosBulletCollisionManager::updateInteractions(SP::Simulation simulation
   // Important parameter controlling contact point making and breaking
   gContactBreakingThreshold = _options.contactBreakingThreshold;
 
-  // 1. perform bullet collision detection
+  // 1. perform bullet collision detection, the interactions of deleted
+  //    contact points are unlinked at once afterwards
+  std::vector<SP::Interaction> unlinkedInteractions;
+  gUnlinkedInteractions = &unlinkedInteractions;
   _impl->_collisionWorld->performDiscreteCollisionDetection();
+  gUnlinkedInteractions = nullptr;
+  if(!unlinkedInteractions.empty())
+    simulation->unlink(unlinkedInteractions);
 #ifdef BULLET_TIMER
   end_old =end;
   end = std::chrono::system_clock::now();
@@ -2624,10 +2655,12 @@ void SiconosBulletCollisionManager::updateInteractions(SP::Simulation simulation
 
   DEBUG_PRINT("SiconosBulletCollisionManager :: iterating contact points:\n");
   //getchar();
-  // 2. deleted contact points have been removed from the graph during the
+  // 2. deleted contact points have been removed from the graph after the
   //    bullet collision detection callbacks
 
-  // 3. for each contact point, if there is no interaction, create one
+  // 3. for each contact point, if there is no interaction, create one,
+  //    the new interactions are linked at once at the end
+  InteractionLinks newLinks;
   IterateContactPoints t(_impl->_collisionWorld);
   IterateContactPoints::iterator it, itend=t.end();
   DEBUG_EXPR_WE(
@@ -2849,7 +2882,7 @@ void SiconosBulletCollisionManager::updateInteractions(SP::Simulation simulation
             _stats.interaction_warnings ++;
           }
 
-          inter = std::make_shared<Interaction>(nslaw, rel);
+          inter = makeInteraction(nslaw, rel);
           _stats.new_interactions_created ++;
         }
         else if(nslaw && nslaw->size() == 2)
@@ -2889,7 +2922,7 @@ void SiconosBulletCollisionManager::updateInteractions(SP::Simulation simulation
             _stats.interaction_warnings ++;
           }
           DEBUG_PRINT("SiconosBulletCollisionManager :: create 2d interaction\n");
-          inter = std::make_shared<Interaction>(nslaw, rel);
+          inter = makeInteraction(nslaw, rel);
           _stats.new_interactions_created ++;
         }
 
@@ -2933,7 +2966,7 @@ void SiconosBulletCollisionManager::updateInteractions(SP::Simulation simulation
             _stats.interaction_warnings ++;
           }
 
-          inter = std::make_shared<Interaction>(nslaw, rel);
+          inter = makeInteraction(nslaw, rel);
           _stats.new_interactions_created ++;
         }
         else if(nslaw && nslaw->size() == 3)
@@ -2977,7 +3010,7 @@ void SiconosBulletCollisionManager::updateInteractions(SP::Simulation simulation
             _stats.interaction_warnings ++;
           }
           DEBUG_PRINT("SiconosBulletCollisionManager :: create 2d interaction\n");
-          inter = std::make_shared<Interaction>(nslaw, rel);
+          inter = makeInteraction(nslaw, rel);
           _stats.new_interactions_created ++;
         }
       }
@@ -3000,11 +3033,13 @@ void SiconosBulletCollisionManager::updateInteractions(SP::Simulation simulation
         it->point->m_userPersistentData = (void*)(new SP::Interaction(inter));
         DEBUG_PRINT("SiconosBulletCollisionManager :: link the interaction\n");
         /* link bodies by the new interaction */
-        simulation->link(inter, pairA->ds, pairB->ds);
+        newLinks.emplace_back(inter, pairA->ds, pairB->ds);
       }
     }
     //getchar();
   }
+  if(!newLinks.empty())
+    simulation->link(newLinks);
   //getchar();
 #ifdef BULLET_TIMER
   end_old =end;
@@ -102,6 +102,10 @@ protected:
                                          const btCollisionObjectWrapper* colObj1Wrap, int partId1, int index1);
   static Simulation *gSimulation;
 
+  // if not null, interactions of removed contact points are gathered
+  // here by bulletContactClear to be unlinked at once
+  static std::vector<SP::Interaction> *gUnlinkedInteractions;
+
 public:
   SiconosBulletCollisionManager();
   SiconosBulletCollisionManager(const SiconosBulletOptions &options);
@@ -113,7 +117,9 @@ protected:
   SiconosBulletStatistics _stats;
 
   /** Provided so that creation of collision points can be overridden.
-   *  See modify_normals.py in examples/Mechanics/Hacks */
+   *  See modify_normals.py in examples/Mechanics/Hacks.
+   *  The default implementations reuse the relation of a recycled
+   *  interaction if any, see InteractionManager::setInteractionPoolSize. */
   virtual SP::BulletR makeBulletR(SP::RigidBodyDS ds1, SP::SiconosShape shape1,
                                   SP::RigidBodyDS ds2, SP::SiconosShape shape2,
                                   const btManifoldPoint &);
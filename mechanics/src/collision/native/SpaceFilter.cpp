@@ -23,6 +23,8 @@
 
 
 #include <cmath>
+#include <algorithm>
+#include <climits>
 //#define DEBUG_MESSAGES 1
 #include "siconos_debug.h"
 
@@ -62,6 +64,8 @@ SpaceFilter::SpaceFilter(unsigned int bboxfactor,
   _plans(plans),
   _moving_plans(moving_plans),
   _hash_table(new space_hash()),
+  _flat_broadphase(false),
+  _broadphase(new FlatBroadphase()),
   diskdisk_relations(new DiskDiskRDeclaredPool()),
   diskplan_relations(new DiskPlanRDeclaredPool()),
   circlecircle_relations(new CircleCircleRDeclaredPool())
@@ -74,6 +78,8 @@ SpaceFilter::SpaceFilter(unsigned int bboxfactor,
   _cellsize(cellsize),
   _plans(plans),
   _hash_table(new space_hash()),
+  _flat_broadphase(false),
+  _broadphase(new FlatBroadphase()),
   diskdisk_relations(new DiskDiskRDeclaredPool()),
   diskplan_relations(new DiskPlanRDeclaredPool()),
   circlecircle_relations(new CircleCircleRDeclaredPool())
@@ -81,6 +87,8 @@ SpaceFilter::SpaceFilter(unsigned int bboxfactor,
 
 SpaceFilter::SpaceFilter() :
   _hash_table(new space_hash()),
+  _flat_broadphase(false),
+  _broadphase(new FlatBroadphase()),
   diskdisk_relations(new DiskDiskRDeclaredPool()),
   diskplan_relations(new DiskPlanRDeclaredPool()),
   circlecircle_relations(new CircleCircleRDeclaredPool())
@@ -209,6 +217,320 @@ public:
 
 
 
+/* the native bodies are collected in flat arrays (flat broadphase) */
+struct SpaceFilter::_BodyCollect : public SiconosVisitor
+{
+public:
+  FlatBroadphase& broadphase;
+  _BodyCollect(FlatBroadphase& b) : broadphase(b) {};
+
+  using SiconosVisitor::visit;
+
+  void visit(SP::Disk pds)
+  {
+    broadphase.push(pds, FlatBroadphase::CIRCULAR,
+                    pds->getQ(0), pds->getQ(1), 0., pds->getRadius());
+  }
+
+  void visit(SP::Circle pds)
+  {
+    broadphase.push(pds, FlatBroadphase::CIRCULAR,
+                    pds->getQ(0), pds->getQ(1), 0., pds->getRadius());
+  }
+
+  void visit(SP::SphereLDS pds)
+  {
+    broadphase.push(pds, FlatBroadphase::SPHERE_LDS,
+                    pds->getQ(0), pds->getQ(1), pds->getQ(2), pds->getRadius());
+  }
+
+  void visit(SP::SphereNEDS pds)
+  {
+    broadphase.push(pds, FlatBroadphase::SPHERE_NEDS,
+                    pds->getQ(0), pds->getQ(1), pds->getQ(2), pds->getRadius());
+  }
+
+  void visit(SP::ExternalBody)
+  {
+    broadphase.has_external = true;
+  }
+};
+
+/* interleave the bits of the cell coordinates: 32 bits for each of
+ * the two coordinates of a planar cell, 21 bits otherwise */
+static std::uint64_t morton_spread2(std::uint64_t v)
+{
+  v &= 0xffffffffULL;
+  v = (v | (v << 16)) & 0x0000ffff0000ffffULL;
+  v = (v | (v << 8)) & 0x00ff00ff00ff00ffULL;
+  v = (v | (v << 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  v = (v | (v << 2)) & 0x3333333333333333ULL;
+  v = (v | (v << 1)) & 0x5555555555555555ULL;
+  return v;
+}
+
+static std::uint64_t morton_spread3(std::uint64_t v)
+{
+  v &= 0x1fffffULL;
+  v = (v | (v << 32)) & 0x001f00000000ffffULL;
+  v = (v | (v << 16)) & 0x001f0000ff0000ffULL;
+  v = (v | (v << 8)) & 0x100f00f00f00f00fULL;
+  v = (v | (v << 4)) & 0x10c30c30c30c30c3ULL;
+  v = (v | (v << 2)) & 0x1249249249249249ULL;
+  return v;
+}
+
+void FlatBroadphase::clear()
+{
+  _previous_number.swap(number);
+  number.clear();
+  bodies.clear();
+  type.clear();
+  x.clear();
+  y.clear();
+  z.clear();
+  radius.clear();
+  has_external = false;
+}
+
+void FlatBroadphase::push(SP::DynamicalSystem ds, BodyType t,
+                          double xc, double yc, double zc, double r)
+{
+  bodies.push_back(ds);
+  number.push_back(ds->number());
+  type.push_back(t);
+  x.push_back(xc);
+  y.push_back(yc);
+  z.push_back(zc);
+  radius.push_back(r);
+}
+
+std::uint64_t FlatBroadphase::cellKey(int i, int j, int k) const
+{
+  // the keys of far away cells may collide: the cell coordinates are
+  // checked in findPairs
+  std::uint64_t u = (std::uint64_t)((std::int64_t) i - imin);
+  std::uint64_t v = (std::uint64_t)((std::int64_t) j - jmin);
+  if(planar)
+    return morton_spread2(u) | (morton_spread2(v) << 1);
+  std::uint64_t w = (std::uint64_t)((std::int64_t) k - kmin);
+  return morton_spread3(u) | (morton_spread3(v) << 1) | (morton_spread3(w) << 2);
+}
+
+/* LSD radix sort of the body indices by their keys, one counting sort
+ * per byte of the largest key */
+void FlatBroadphase::_radixSort()
+{
+  size_t n = key.size();
+  order.resize(n);
+  _order_work.resize(n);
+  std::uint64_t key_max = 0;
+  for(size_t b = 0; b < n; ++b)
+  {
+    order[b] = (unsigned int) b;
+    key_max = (std::max)(key_max, key[b]);
+  }
+
+  for(unsigned int shift = 0; shift < 64 && (key_max >> shift); shift += 8)
+  {
+    size_t count[257] = {0};
+    for(size_t p = 0; p < n; ++p)
+      ++count[((key[order[p]] >> shift) & 0xff) + 1];
+    for(unsigned int d = 0; d < 256; ++d)
+      count[d + 1] += count[d];
+    for(size_t p = 0; p < n; ++p)
+      _order_work[count[(key[order[p]] >> shift) & 0xff]++] = order[p];
+    order.swap(_order_work);
+  }
+}
+
+void FlatBroadphase::sort(double cellsize)
+{
+  size_t n = bodies.size();
+  ci.resize(n);
+  cj.resize(n);
+  ck.resize(n);
+  key.resize(n);
+  sorted_key.resize(n);
+  if(n == 0)
+  {
+    order.clear();
+    return;
+  }
+
+  imin = jmin = kmin = INT_MAX;
+  imax = jmax = kmax = INT_MIN;
+  rmax = 0.;
+  for(size_t b = 0; b < n; ++b)
+  {
+    rmax = (std::max)(rmax, radius[b]);
+    ci[b] = (int) floor(x[b] / cellsize);
+    cj[b] = (int) floor(y[b] / cellsize);
+    ck[b] = (int) floor(z[b] / cellsize);
+    imin = (std::min)(imin, ci[b]);
+    imax = (std::max)(imax, ci[b]);
+    jmin = (std::min)(jmin, cj[b]);
+    jmax = (std::max)(jmax, cj[b]);
+    kmin = (std::min)(kmin, ck[b]);
+    kmax = (std::max)(kmax, ck[b]);
+  }
+  planar = (kmin == kmax);
+  for(size_t b = 0; b < n; ++b)
+    key[b] = cellKey(ci[b], cj[b], ck[b]);
+
+  // the bodies move a little between two calls: the previous order is
+  // almost sorted and an insertion sort is cheaper, as long as it does
+  // not move too many indices
+  if(number == _previous_number && order.size() == n)
+  {
+    size_t budget = 8 * n;
+    for(size_t p = 1; p < n; ++p)
+    {
+      unsigned int b = order[p];
+      size_t q = p;
+      for(; q > 0 && key[order[q - 1]] > key[b] && budget > 0; --q, --budget)
+        order[q] = order[q - 1];
+      order[q] = b;
+      if(budget == 0)
+      {
+        _radixSort();
+        break;
+      }
+    }
+  }
+  else
+  {
+    _radixSort();
+  }
+
+  for(size_t p = 0; p < n; ++p)
+    sorted_key[p] = key[order[p]];
+}
+
+void FlatBroadphase::boundingCells(unsigned int b, unsigned int bboxfactor, double cellsize,
+                                   int& i0, int& i1, int& j0, int& j1,
+                                   int& k0, int& k1) const
+{
+  // same bounding box as _BodyHash
+  double d = bboxfactor * radius[b];
+  i0 = (int) floor((x[b] - d) / cellsize);
+  i1 = (int) floor((x[b] + d) / cellsize);
+  j0 = (int) floor((y[b] - d) / cellsize);
+  j1 = (int) floor((y[b] + d) / cellsize);
+  k0 = k1 = ck[b];
+  if(type[b] != CIRCULAR)
+  {
+    k0 = (int) floor((z[b] - d) / cellsize);
+    k1 = (int) floor((z[b] + d) / cellsize);
+  }
+}
+
+void FlatBroadphase::cellBodies(int i, int j, int k, unsigned int bboxfactor, double cellsize,
+                                std::vector<unsigned int>& neighbours) const
+{
+  if(order.empty())
+    return;
+
+  // the centers of the bodies covering the cell are at most this number
+  // of cells away
+  int reach = (int) ceil(bboxfactor * rmax / cellsize) + 1;
+  int i0 = (std::max)(imin, i - reach), i1 = (std::min)(imax, i + reach);
+  int j0 = (std::max)(jmin, j - reach), j1 = (std::min)(jmax, j + reach);
+  int k0 = (std::max)(kmin, k - reach), k1 = (std::min)(kmax, k + reach);
+
+  for(int ii = i0; ii <= i1; ++ii)
+  {
+    for(int jj = j0; jj <= j1; ++jj)
+    {
+      for(int kk = k0; kk <= k1; ++kk)
+      {
+        std::uint64_t cell = cellKey(ii, jj, kk);
+        size_t p = std::lower_bound(sorted_key.begin(), sorted_key.end(), cell)
+                   - sorted_key.begin();
+        for(; p < sorted_key.size() && sorted_key[p] == cell; ++p)
+        {
+          unsigned int a = order[p];
+          if(ci[a] != ii || cj[a] != jj || ck[a] != kk)
+            continue;
+          int ai0, ai1, aj0, aj1, ak0, ak1;
+          boundingCells(a, bboxfactor, cellsize, ai0, ai1, aj0, aj1, ak0, ak1);
+          if(ai0 <= i && i <= ai1 && aj0 <= j && j <= aj1 && ak0 <= k && k <= ak1)
+            neighbours.push_back(a);
+        }
+      }
+    }
+  }
+}
+
+void FlatBroadphase::findPairs(unsigned int bboxfactor, double cellsize)
+{
+  for(unsigned int t = 0; t < NUMBER_OF_BODY_TYPES; ++t)
+    pairs[t].clear();
+
+  int n = (int) bodies.size();
+
+#ifdef _OPENMP
+  #pragma omp parallel
+#endif
+  {
+    std::vector<std::uint64_t> local[NUMBER_OF_BODY_TYPES];
+
+#ifdef _OPENMP
+    #pragma omp for schedule(static)
+#endif
+    for(int b = 0; b < n; ++b)
+    {
+      int i0, i1, j0, j1, k0, k1;
+      boundingCells(b, bboxfactor, cellsize, i0, i1, j0, j1, k0, k1);
+      i0 = (std::max)(imin, i0);
+      i1 = (std::min)(imax, i1);
+      j0 = (std::max)(jmin, j0);
+      j1 = (std::min)(jmax, j1);
+      k0 = (std::max)(kmin, k0);
+      k1 = (std::min)(kmax, k1);
+
+      for(int i = i0; i <= i1; ++i)
+      {
+        for(int j = j0; j <= j1; ++j)
+        {
+          for(int k = k0; k <= k1; ++k)
+          {
+            std::uint64_t cell = cellKey(i, j, k);
+            size_t p = std::lower_bound(sorted_key.begin(), sorted_key.end(), cell)
+                       - sorted_key.begin();
+            for(; p < (size_t) n && sorted_key[p] == cell; ++p)
+            {
+              unsigned int a = order[p];
+              if(a == (unsigned int) b || type[a] != type[b]
+                  || ci[a] != i || cj[a] != j || ck[a] != k)
+                continue;
+              std::uint64_t first = (std::min)(a, (unsigned int) b);
+              std::uint64_t second = (std::max)(a, (unsigned int) b);
+              local[type[b]].push_back((first << 32) | second);
+            }
+          }
+        }
+      }
+    }
+
+#ifdef _OPENMP
+    #pragma omp critical
+#endif
+    for(unsigned int t = 0; t < NUMBER_OF_BODY_TYPES; ++t)
+      pairs[t].insert(pairs[t].end(), local[t].begin(), local[t].end());
+  }
+
+  // a pair is found from both bodies when each center is in the
+  // bounding box of the other one
+  for(unsigned int t = 0; t < NUMBER_OF_BODY_TYPES; ++t)
+  {
+    std::sort(pairs[t].begin(), pairs[t].end());
+    pairs[t].erase(std::unique(pairs[t].begin(), pairs[t].end()), pairs[t].end());
+  }
+}
+
+
+
 /* proximity detection for circular object */
 struct SpaceFilter::_CircularFilter : public SiconosVisitor
 {
@@ -1030,8 +1352,12 @@ struct SpaceFilter::_FindInteractions : public SiconosVisitor
   SP::Simulation sim;
   SP::SpaceFilter parent;
   double time;
+
+  /* look for the neighbours in the hash table, otherwise only the
+   * interactions with the plans are updated */
+  bool neighbours;
   _FindInteractions(SP::Simulation s, SP::SpaceFilter p, double time)
-    : sim(s), parent(p), time(time) {};
+    : sim(s), parent(p), time(time), neighbours(true) {};
 
   void visit_circular(SP::CircularDS  ds1)
   {
@@ -1062,6 +1388,9 @@ struct SpaceFilter::_FindInteractions : public SiconosVisitor
       }
     }
 
+    if(!neighbours)
+      return;
+
     SP::SiconosVector Q1 = ds1->q();
 
     double x1 = Q1->getValue(0);
@@ -1127,6 +1456,9 @@ struct SpaceFilter::_FindInteractions : public SiconosVisitor
                                    (*parent->_plans)(i, 3), ds1);
     }
 
+    if(!neighbours)
+      return;
+
     SP::SiconosVector Q1 = ds1->q();
 
     double x1 = Q1->getValue(0);
@@ -1184,6 +1516,9 @@ struct SpaceFilter::_FindInteractions : public SiconosVisitor
                                     (*parent->_plans)(i, 3), ds1);
     }
 
+    if(!neighbours)
+      return;
+
     SP::SiconosVector Q1 = ds1->q();
 
     double x1 = Q1->getValue(0);
@@ -1237,6 +1572,78 @@ struct SpaceFilter::_FindInteractions : public SiconosVisitor
 };
 
 
+/* proximity detection with the flat arrays cell list */
+void SpaceFilter::_flatUpdateInteractions(SP::Simulation sim,
+                                          std::shared_ptr<_BodyHash> hasher,
+                                          std::shared_ptr<_FindInteractions> findInteractions)
+{
+  SP::DynamicalSystemsGraph
+  DSG0 = sim->nonSmoothDynamicalSystem()->topology()->dSG(0);
+  FlatBroadphase& broadphase = *_broadphase;
+
+  // 1: collect the native bodies
+  std::shared_ptr<_BodyCollect> collector(new _BodyCollect(broadphase));
+  broadphase.clear();
+  DynamicalSystemsGraph::VIterator vi, viend;
+  for(std::tie(vi, viend) = DSG0->vertices();
+      vi != viend; ++vi)
+  {
+    DSG0->bundle(*vi)->acceptSP(collector);
+  }
+
+  // the external bodies look for their neighbours in the hash table
+  if(broadphase.has_external)
+  {
+    for(std::tie(vi, viend) = DSG0->vertices();
+        vi != viend; ++vi)
+    {
+      DSG0->bundle(*vi)->acceptSP(hasher);
+    }
+  }
+
+  // 2: cell list and candidate pairs
+  broadphase.sort(_cellsize);
+  broadphase.findPairs(_bboxfactor, _cellsize);
+
+  // 3: plans and external bodies
+  findInteractions->neighbours = false;
+  for(std::tie(vi, viend) = DSG0->vertices();
+      vi != viend; ++vi)
+  {
+    DSG0->bundle(*vi)->acceptSP(findInteractions);
+  }
+
+  // 4: prox detection of the candidate pairs, one kind of body at a time
+  std::vector<std::uint64_t>::const_iterator it;
+
+  _CircularFilter circularFilter(sim, shared_from_this(), SP::CircularDS());
+  const std::vector<std::uint64_t>& circulars = broadphase.pairs[FlatBroadphase::CIRCULAR];
+  for(it = circulars.begin(); it != circulars.end(); ++it)
+  {
+    circularFilter.ds1 = std::static_pointer_cast<CircularDS>(broadphase.bodies[*it >> 32]);
+    circularFilter.visit_circular(
+      std::static_pointer_cast<CircularDS>(broadphase.bodies[*it & 0xffffffff]));
+  }
+
+  _SphereLDSFilter sphereLDSFilter(sim, shared_from_this(), SP::SphereLDS());
+  const std::vector<std::uint64_t>& spheresLDS = broadphase.pairs[FlatBroadphase::SPHERE_LDS];
+  for(it = spheresLDS.begin(); it != spheresLDS.end(); ++it)
+  {
+    sphereLDSFilter.ds1 = std::static_pointer_cast<SphereLDS>(broadphase.bodies[*it >> 32]);
+    sphereLDSFilter.visit(
+      std::static_pointer_cast<SphereLDS>(broadphase.bodies[*it & 0xffffffff]));
+  }
+
+  _SphereNEDSFilter sphereNEDSFilter(sim, shared_from_this(), SP::SphereNEDS());
+  const std::vector<std::uint64_t>& spheresNEDS = broadphase.pairs[FlatBroadphase::SPHERE_NEDS];
+  for(it = spheresNEDS.begin(); it != spheresNEDS.end(); ++it)
+  {
+    sphereNEDSFilter.ds1 = std::static_pointer_cast<SphereNEDS>(broadphase.bodies[*it >> 32]);
+    sphereNEDSFilter.visit(
+      std::static_pointer_cast<SphereNEDS>(broadphase.bodies[*it & 0xffffffff]));
+  }
+}
+
 /* general proximity detection */
 void SpaceFilter::updateInteractions(SP::Simulation sim)
 {
@@ -1252,8 +1659,15 @@ void SpaceFilter::updateInteractions(SP::Simulation sim)
 
   _hash_table->clear();
 
-  // 1: rehash DS
   DynamicalSystemsGraph::VIterator vi, viend;
+
+  if(_flat_broadphase)
+  {
+    _flatUpdateInteractions(sim, hasher, findInteractions);
+    return;
+  }
+
+  // 1: rehash DS
   for(std::tie(vi, viend) = DSG0->vertices();
       vi != viend; ++vi)
   {
@@ -1279,7 +1693,14 @@ bool SpaceFilter::haveNeighbours(SP::Hashed h)
 {
   std::pair<space_hash::iterator, space_hash::iterator> neighbours
     = _hash_table->equal_range(h);
-  return (neighbours.first != neighbours.second);
+  if(neighbours.first != neighbours.second)
+    return true;
+
+  // the native bodies of the flat broadphase are not hashed
+  std::vector<unsigned int> flatNeighbours;
+  if(_flat_broadphase)
+    _broadphase->cellBodies(h->i, h->j, h->k, _bboxfactor, _cellsize, flatNeighbours);
+  return !flatNeighbours.empty();
 }
 
 
@@ -1330,6 +1751,20 @@ double SpaceFilter::minDistance(SP::Hashed h)
 
       dmin = (std::min)(dmin, distance->result);
     }
+
+    // the native bodies of the flat broadphase are not hashed
+    if(_flat_broadphase)
+    {
+      std::vector<unsigned int> flatNeighbours;
+      _broadphase->cellBodies(h->i, h->j, h->k, _bboxfactor, _cellsize, flatNeighbours);
+      for(std::vector<unsigned int>::const_iterator it = flatNeighbours.begin();
+          it != flatNeighbours.end(); ++it)
+      {
+        _broadphase->bodies[*it]->acceptSP(distance);
+
+        dmin = (std::min)(dmin, distance->result);
+      }
+    }
   }
 
   return dmin;
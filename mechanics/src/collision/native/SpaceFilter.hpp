@@ -29,6 +29,12 @@
  *   Munich, Germany
  *   pp. 47-54
  *   November 19-21, 2003
+ *
+ *  With setFlatBroadphase(true), Disk, Circle, SphereLDS and SphereNEDS
+ *  bodies are not hashed: their centers and radii are copied into flat arrays, sorted
+ *  into a cell list along the Morton order of the cells, and the
+ *  candidate pairs are gathered in contiguous buffers, one per kind of
+ *  body, before the proximity detection.
  */
 
 #ifndef SpaceFilter_hpp
@@ -47,6 +53,7 @@ DEFINE_SPTR(DiskDiskRDeclaredPool);
 DEFINE_SPTR(DiskPlanRDeclaredPool);
 DEFINE_SPTR(CircleCircleRDeclaredPool);
 DEFINE_SPTR(Hashed);
+DEFINE_SPTR(FlatBroadphase);
 
 class SpaceFilter : public InteractionManager,
                     public std::enable_shared_from_this<SpaceFilter> {
@@ -71,6 +78,12 @@ protected:
   /* the hash table */
   SP::space_hash _hash_table;
 
+  /** use the flat arrays cell list for the native bodies */
+  bool _flat_broadphase;
+
+  /* the flat arrays of the native bodies */
+  SP::FlatBroadphase _broadphase;
+
   /* relations pool */
   SP::DiskDiskRDeclaredPool diskdisk_relations;
   SP::DiskPlanRDeclaredPool diskplan_relations;
@@ -100,6 +113,9 @@ protected:
   /* the body hasher */
   struct _BodyHash;
 
+  /* the native bodies collector (flat broadphase) */
+  struct _BodyCollect;
+
   /* the proximity detection */
   struct _FindInteractions;
 
@@ -111,10 +127,15 @@ protected:
   /* to compute distance */
   struct _DiskDistance;
 
+  void _flatUpdateInteractions(SP::Simulation,
+                               std::shared_ptr<_BodyHash> hasher,
+                               std::shared_ptr<_FindInteractions> findInteractions);
+
   friend struct SpaceFilter::_CircularFilter;
   friend struct SpaceFilter::_SphereLDSFilter;
   friend struct SpaceFilter::_SphereNEDSFilter;
   friend struct SpaceFilter::_BodyHash;
+  friend struct SpaceFilter::_BodyCollect;
   friend struct SpaceFilter::_FindInteractions;
   friend struct SpaceFilter::_IsSameDiskPlanR;
   friend struct SpaceFilter::_IsSameDiskMovingPlanR;
@@ -155,6 +176,14 @@ public:
 
   void setCellsize(unsigned int value) { _cellsize = value; }
 
+  /** use the flat arrays cell list or the hash table (default) for
+   *  the broadphase of Disk, Circle, SphereLDS and SphereNEDS bodies.
+   *  These bodies are hashed anyway when some ExternalBody is present.
+   */
+  void setFlatBroadphase(bool value) { _flat_broadphase = value; }
+
+  inline bool flatBroadphase() { return _flat_broadphase; };
+
   /** get the neighbours
    * */
   //  std::pair<space_hash::iterator, space_hash::iterator>
@@ -24,6 +24,8 @@
 #define SpaceFilter_impl_hpp
 
 #include <map>
+#include <vector>
+#include <cstdint>
 
 #include <NSLawMatrix.hpp>
 #include <SpaceFilter.hpp>
@@ -68,6 +70,86 @@ class space_hash : public boost::unordered_multiset < SP::Hashed,
   ACCEPT_SERIALIZATION(space_hash);
 };
 
+/* flat arrays of the native bodies and their cell list. The bodies
+ * are stored in the order of the vertices of the DS graph, the cell
+ * list is the array of the body indices sorted by the Morton key of
+ * the cell of their center. */
+class FlatBroadphase
+{
+protected:
+
+  ACCEPT_SERIALIZATION(FlatBroadphase);
+
+public:
+
+  enum BodyType
+  {
+    CIRCULAR = 0,
+    SPHERE_LDS = 1,
+    SPHERE_NEDS = 2,
+    NUMBER_OF_BODY_TYPES = 3
+  };
+
+  std::vector<SP::DynamicalSystem> bodies;
+  std::vector<int> number;
+  std::vector<unsigned char> type;
+  std::vector<double> x, y, z, radius;
+
+  /* an ExternalBody has been met during the collection */
+  bool has_external;
+
+  /* cells of the centers */
+  std::vector<int> ci, cj, ck;
+  int imin, jmin, kmin, imax, jmax, kmax;
+  bool planar;
+
+  /* the largest radius */
+  double rmax;
+
+  /* the cell list */
+  std::vector<std::uint64_t> key;
+  std::vector<unsigned int> order;
+  std::vector<std::uint64_t> sorted_key;
+
+  /* candidate pairs (index of the first body << 32 | index of the
+   * second one), one buffer per body type */
+  std::vector<std::uint64_t> pairs[NUMBER_OF_BODY_TYPES];
+
+  FlatBroadphase() : has_external(false), imin(0), jmin(0), kmin(0),
+    imax(0), jmax(0), kmax(0), planar(true), rmax(0.) {};
+
+  /** forget the bodies, the previous order is kept for the next sort */
+  void clear();
+
+  void push(SP::DynamicalSystem ds, BodyType t,
+            double xc, double yc, double zc, double r);
+
+  /** sort the bodies along the Morton order of their cells. If the
+   *  bodies are the same as in the previous call, the previous order is
+   *  updated by insertion when it is nearly sorted. */
+  void sort(double cellsize);
+
+  /** fill pairs with the bodies of the same type such that the center
+   *  of one is in the bounding box of the other */
+  void findPairs(unsigned int bboxfactor, double cellsize);
+
+  /** append to neighbours the bodies whose bounding box covers the
+   *  cell (i, j, k), i.e. the bodies the hash table would give */
+  void cellBodies(int i, int j, int k, unsigned int bboxfactor, double cellsize,
+                  std::vector<unsigned int>& neighbours) const;
+
+  /** the cells covered by the bounding box of a body */
+  void boundingCells(unsigned int b, unsigned int bboxfactor, double cellsize,
+                     int& i0, int& i1, int& j0, int& j1, int& k0, int& k1) const;
+
+  std::uint64_t cellKey(int i, int j, int k) const;
+
+private:
+  std::vector<int> _previous_number;
+  std::vector<unsigned int> _order_work;
+  void _radixSort();
+};
+
 /* relations pool */
 typedef std::pair<double, double> CircleCircleRDeclared;
 typedef std::pair<double, double> DiskDiskRDeclared;
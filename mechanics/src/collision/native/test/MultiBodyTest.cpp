@@ -66,7 +66,11 @@
 #include "Disk.hpp"
 #include "Circle.hpp"
 #include "DiskPlanR.hpp"
+#include "SphereNEDS.hpp"
+#include "SphereNEDSPlanR.hpp"
+#include "SphereNEDSSphereNEDSR.hpp"
 #include "SpaceFilter.hpp"
+#include "SpaceFilter_impl.hpp"
 
 class Disks : public SiconosBodies, public std::enable_shared_from_this<Disks>
 {
@@ -85,6 +89,8 @@ TYPEDEF_SPTR(Disks)
 // Siconos
 #include <SiconosKernel.hpp>
 #include <SiconosPointers.hpp>
+#include <map>
+#include <set>
 
 using namespace std;
 
@@ -373,12 +379,175 @@ void MultiBodyTest::t2()
 
 }
 
+static SP::SphereNEDS groundSphere(double x, double vx,
+                                   SP::NonSmoothDynamicalSystem nsds,
+                                   SP::NonSmoothLaw nslaw)
+{
+  double r = 0.1, m = 1.;
+  SP::SimpleMatrix I(new SimpleMatrix(3, 3));
+  I->eye();
+  *I *= 0.4 * m * r * r;
+  SP::SiconosVector q0(new SiconosVector(7));
+  SP::SiconosVector v0(new SiconosVector(6));
+  q0->setValue(0, x);
+  q0->setValue(2, r);
+  q0->setValue(3, 1.);
+  v0->setValue(0, vx);
+  SP::SphereNEDS sphere(new SphereNEDS(r, m, I, q0, v0));
+  SP::SiconosVector weight(new SiconosVector(3));
+  weight->setValue(2, -9.81 * m);
+  sphere->setFExtPtr(weight);
+  nsds->insertDynamicalSystem(sphere);
+  SP::Interaction ground(new Interaction(nslaw, SP::Relation(new SphereNEDSPlanR(r, 0., 0., 1., 0.))));
+  nsds->link(ground, sphere);
+  return sphere;
+}
+
+// a sphere at rest on the ground is frozen, and woken up by another one
 void MultiBodyTest::t3()
 {
+  double h = 5e-3;
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0., 1.));
+  SP::NonSmoothLaw nslaw(new NewtonImpactFrictionNSL(0., 0., 0.5, 3));
+  SP::SphereNEDS resting = groundSphere(0., 0., nsds, nslaw);
+  SP::SphereNEDS moving = groundSphere(-0.5, 1., nsds, nslaw);
+  SP::Interaction shock(new Interaction(nslaw, SP::Relation(new SphereNEDSSphereNEDSR(0.1, 0.1))));
+  nsds->link(shock, moving, resting);
+
+  SP::MoreauJeanOSI osi(new MoreauJeanOSI(0.5));
+  osi->setDeactivation(1e-6, 10);
+  SP::TimeStepping s(new TimeStepping(nsds, SP::TimeDiscretisation(new TimeDiscretisation(0., h)),
+                                      osi, SP::OneStepNSProblem(new FrictionContact(3))));
+
+  SiconosVector q0(*resting->q());
+  for(unsigned int k = 0; k < 20; ++k)
+  {
+    s->computeOneStep();
+    s->nextStep();
+  }
+  CPPUNIT_ASSERT(resting->isSleeping());
+  CPPUNIT_ASSERT(!moving->isSleeping());
+  CPPUNIT_ASSERT((*resting->q() - q0).normInf() == 0.);
+
+  bool woken = false;
+  for(unsigned int k = 0; k < 80; ++k)
+  {
+    s->computeOneStep();
+    s->nextStep();
+    woken = woken || !resting->isSleeping();
+  }
+  CPPUNIT_ASSERT(woken);
+  CPPUNIT_ASSERT(resting->q()->getValue(0) > 0.);
+}
+
+/* contacts between disks found by the space filter after the bodies
+ * have been moved nsteps times. The pairs are given with the indices of
+ * the disks in their creation order. The answers of haveNeighbours and
+ * minDistance (disks only) in the cell of each disk are also given. */
+static std::set<std::pair<int, int> > diskContacts(bool flat, unsigned int nsteps,
+                                                   bool circles,
+                                                   std::vector<bool>& neighbours,
+                                                   std::vector<double>& distances)
+{
+  SP::NonSmoothDynamicalSystem nsds(new NonSmoothDynamicalSystem(0., 1.));
+  SP::NonSmoothLaw nslaw(new NewtonImpactFrictionNSL(0., 0., 0.3, 2));
+  std::vector<SP::CircularDS> disks;
+  std::map<int, int> index;
+
+  // a pseudo random cloud of disks, circles included
+  unsigned int seed = 12345;
+  for(unsigned int i = 0; i < 400; ++i)
+  {
+    SP::SiconosVector q(new SiconosVector(NDOF));
+    SP::SiconosVector v(new SiconosVector(NDOF));
+    seed = 1103515245 * seed + 12345;
+    (*q)(0) = -40. + 80. * ((seed >> 8) & 0xffff) / 65535.;
+    seed = 1103515245 * seed + 12345;
+    (*q)(1) = -40. + 80. * ((seed >> 8) & 0xffff) / 65535.;
+    double r = 0.5 + 0.5 * (i % 3);
+    SP::CircularDS disk;
+    if(!circles || i % 10)
+      disk.reset(new Disk(r, 1., q, v));
+    else
+      disk.reset(new Circle(4 * r, 1., q, v));
+    nsds->insertDynamicalSystem(disk);
+    index[disk->number()] = i;
+    disks.push_back(disk);
+  }
+
+  SP::SiconosMatrix plans(new SimpleMatrix(1, 6));
+  plans->zero();
+  (*plans)(0, 1) = 1.;
+  (*plans)(0, 2) = 1000.;
+
+  SP::TimeStepping s(new TimeStepping(nsds, SP::TimeDiscretisation(new TimeDiscretisation(0., 0.01)),
+                                      SP::MoreauJeanOSI(new MoreauJeanOSI(0.5)),
+                                      SP::OneStepNSProblem(new FrictionContact(2))));
+  SP::SpaceFilter filter(new SpaceFilter(3, 6, plans));
+  filter->insertNonSmoothLaw(nslaw, 0, 0);
+  filter->setFlatBroadphase(flat);
+
+  for(unsigned int step = 0; step <= nsteps; ++step)
+  {
+    if(step > 0)
+    {
+      // small moves, the cell list is updated
+      for(unsigned int i = 0; i < disks.size(); ++i)
+      {
+        disks[i]->q()->setValue(0, disks[i]->getQ(0) + 0.3 * cos(i + step));
+        disks[i]->q()->setValue(1, disks[i]->getQ(1) + 0.3 * sin(i + step));
+      }
+    }
+    filter->updateInteractions(s);
+  }
+
+  std::set<std::pair<int, int> > contacts;
+  SP::DynamicalSystemsGraph DSG0 = nsds->topology()->dSG(0);
+  DynamicalSystemsGraph::EIterator ei, eiend;
+  for(std::tie(ei, eiend) = DSG0->edges(); ei != eiend; ++ei)
+  {
+    int i1 = index[DSG0->bundle(DSG0->source(*ei))->number()];
+    int i2 = index[DSG0->bundle(DSG0->target(*ei))->number()];
+    contacts.insert(std::pair<int, int>((std::min)(i1, i2), (std::max)(i1, i2)));
+  }
+
+  neighbours.clear();
+  distances.clear();
+  for(unsigned int i = 0; i < disks.size(); ++i)
+  {
+    SP::Hashed h(new Hashed(disks[i], (int) floor(disks[i]->getQ(0) / 6),
+                            (int) floor(disks[i]->getQ(1) / 6)));
+    neighbours.push_back(filter->haveNeighbours(h));
+    if(!circles)
+      distances.push_back(filter->minDistance(h));
+  }
+  // an empty cell
+  neighbours.push_back(filter->haveNeighbours(SP::Hashed(new Hashed(disks[0], 100, 100))));
+  return contacts;
 }
 
+// the flat broadphase finds the same contacts as the hash table
 void MultiBodyTest::t4()
 {
+  for(unsigned int circles = 0; circles < 2; ++circles)
+  {
+    for(unsigned int nsteps = 0; nsteps < 4; nsteps += 3)
+    {
+      std::vector<bool> hashedNeighbours, flatNeighbours;
+      std::vector<double> hashedDistances, flatDistances;
+      std::set<std::pair<int, int> > hashed =
+        diskContacts(false, nsteps, circles, hashedNeighbours, hashedDistances);
+      std::set<std::pair<int, int> > flat =
+        diskContacts(true, nsteps, circles, flatNeighbours, flatDistances);
+      std::cout << "contacts after " << nsteps << " steps: " << hashed.size()
+                << " (hash table), " << flat.size() << " (flat)" << std::endl;
+      CPPUNIT_ASSERT(hashed.size() > 0);
+      CPPUNIT_ASSERT(hashed == flat);
+      CPPUNIT_ASSERT(hashedNeighbours == flatNeighbours);
+      CPPUNIT_ASSERT(!flatNeighbours.back());
+      CPPUNIT_ASSERT(hashedDistances == flatDistances);
+    }
+  }
 }
 
 void MultiBodyTest::t5()
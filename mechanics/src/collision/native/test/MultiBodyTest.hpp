@@ -33,9 +33,9 @@ private:
 
   CPPUNIT_TEST(t2);
 
-  //  CPPUNIT_TEST(t3);
+  CPPUNIT_TEST(t3);
 
-  //  CPPUNIT_TEST(t4);
+  CPPUNIT_TEST(t4);
 
   //  CPPUNIT_TEST(t5);
 
@@ -25,6 +25,8 @@ if(WITH_TESTING)
   
   new_test(NAME tools_projection SOURCES test_projection.c)
 
+  new_test(SOURCES fixed_point_acceleration_test.c)
+
   new_test(SOURCES NumericsArrays.c)
 
   #  tests for NumericsMatrix
@@ -64,6 +66,8 @@ if(WITH_TESTING)
   #  Use new_tests_collection function as below.
   
   new_test(NAME lcp_test_DefaultSolverOptions SOURCES LinearComplementarity_DefaultSolverOptions_test.c)
+  new_test(SOURCES lcp_pivot_lumod_sparse_test.c)
+  new_test(SOURCES lcp_enum_threads_test.c)
 
   new_tests_collection(
     DRIVER lcp_test_collection.c.in FORMULATION lcp COLLECTION TEST_LCP_COLLECTION_1
@@ -113,6 +117,8 @@ if(WITH_TESTING)
     new_test(NAME MLCPtest SOURCES main_mlcp.cpp)
   endif()
   new_test(SOURCES MixedLinearComplementarity_ReadWrite_test.c)
+  new_test(SOURCES mlcp_direct_cache_test.c)
+  new_test(SOURCES mlcp_enum_threads_test.c)
 
   # ----------- MCP solvers tests -----------
   begin_tests(src/MCP/test)
@@ -207,6 +213,10 @@ if(WITH_TESTING)
   new_tests_collection(
     DRIVER fc_test_collection.c.in FORMULATION fc3d COLLECTION TEST_QUARTIC_COLLECTION_1
     EXTRA_SOURCES data_collection_5.c test_quartic_1.c)
+
+  new_test(SOURCES fc3d_nsgs_specialized_test.c)
+  new_test(SOURCES fc3d_acceleration_test.c)
+  new_test(SOURCES fc3d_nsgs_mixed_precision_test.c)
     
   # --- LMGC driver ---
   new_test(SOURCES fc3d_newFromFortranData.c)
@@ -363,6 +373,9 @@ if(WITH_TESTING)
     DRIVER gmp_test_collection.c.in FORMULATION gmp COLLECTION TEST_NSGS_COLLECTION_1
     EXTRA_SOURCES data_collection_1.c test_solvers_1.c)
 
+  new_test(SOURCES gmp_components_test.c)
+  new_test(SOURCES gmp_reduced_sparse_test.c)
+
   # ----------- Variationnal inequalities solvers tests -----------
   begin_tests(src/VI/test)
 
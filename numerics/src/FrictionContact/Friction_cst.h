@@ -258,11 +258,34 @@ enum SICONOS_FRICTION_3D_NSGS_IPARAM
   SICONOS_FRICTION_3D_NSGS_FREEZING_CONTACT =19,
   /** index in iparam to store the  */
   SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION =14,
+  /** index in iparam to store the mixed precision strategy */
+  SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION =15,
+  /** index in iparam to force the generic loop instead of the specialized ones */
+  SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP =16,
 };
 enum SICONOS_FRICTION_3D_NSGS_DPARAM
 {
   /** index in dparam to store the relaxation strategy */
   SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE=8,
+  /** index in dparam to store the tolerance of the single precision sweeps */
+  SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TOL=9,
+};
+
+/** iparam indices for the acceleration of the fixed point solvers
+    (FPP, DSFP, EG, VI_FPP and NSGS), see fixed_point_acceleration.h */
+enum SICONOS_FRICTION_3D_ACCELERATION_IPARAM
+{
+  /** index in iparam to store the acceleration strategy
+      (a value of SICONOS_FIXED_POINT_ACCELERATION_ENUM) */
+  SICONOS_FRICTION_3D_IPARAM_ACCELERATION = 11,
+  /** index in iparam to store the memory of the Anderson acceleration */
+  SICONOS_FRICTION_3D_IPARAM_ACCELERATION_MEMORY = 12,
+};
+
+enum SICONOS_FRICTION_3D_ACCELERATION_DPARAM
+{
+  /** index in dparam to store the maximum omega of the SOR acceleration */
+  SICONOS_FRICTION_3D_DPARAM_ACCELERATION_OMEGA_MAX = 10,
 };
 
 
@@ -302,6 +325,24 @@ enum SICONOS_FRICTION_3D_NSGS_RELAXATION_ENUM
   SICONOS_FRICTION_3D_NSGS_RELAXATION_FALSE,
   SICONOS_FRICTION_3D_NSGS_RELAXATION_TRUE
 };
+enum SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_ENUM
+{
+  /** all the sweeps are done in double precision */
+  SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_FALSE =0,
+  /** the first sweeps use a single precision copy of the extra diagonal
+      blocks of M (sparse block storage only), until the light error is
+      below dparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TOL] **/
+  SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TRUE =1
+};
+enum SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP_ENUM
+{
+  /** the loops specialized at compile time are used for the common
+      local solvers and options (default) */
+  SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP_FALSE =0,
+  /** the generic loop, testing the options at each iteration, is
+      always used */
+  SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP_TRUE =1
+};
 enum SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION_ENUM
 {
 
@@ -25,6 +25,7 @@
 #include "SolverOptions.h"           // for SolverOptions, solver_options_nu...
 #include "fc3d_Solvers.h"            // for fc3d_DeSaxceFixedPoint, fc3d_DeS...
 #include "fc3d_compute_error.h"      // for fc3d_compute_error
+#include "fixed_point_acceleration.h"  // for fixed_point_acceleration_apply
 #include "numerics_verbose.h"        // for verbose, numerics_error
 #include "projectionOnCone.h"        // for projectionOnCone
 #include "SiconosBlas.h"                   // for cblas_dcopy, cblas_dnrm2
@@ -55,6 +56,10 @@ void fc3d_DeSaxceFixedPoint(FrictionContactProblem* problem, double *reaction, d
   int nLocal = 3;
   double * velocitytmp = (double *)calloc(n, sizeof(double));
 
+  /* acceleration of the fixed point iterations (NULL if none) */
+  fixed_point_acceleration* acceleration =
+    fc3d_fixed_point_acceleration_new(problem, reaction, options);
+
   double rho = 0.0;
 
   if(dparam[SICONOS_FRICTION_3D_NSN_RHO] > 0.0)
@@ -110,6 +115,10 @@ void fc3d_DeSaxceFixedPoint(FrictionContactProblem* problem, double *reaction, d
 
     if(error < tolerance) hasNotConverged = 0;
     *info = hasNotConverged;
+
+    /* acceleration of the fixed point iterations */
+    if(acceleration && hasNotConverged && iter < itermax)
+      fixed_point_acceleration_apply(acceleration, reaction, error);
   }
 
 
@@ -119,6 +128,7 @@ void fc3d_DeSaxceFixedPoint(FrictionContactProblem* problem, double *reaction, d
   iparam[SICONOS_IPARAM_ITER_DONE] = iter;
   dparam[SICONOS_DPARAM_RESIDU] = error;
   free(velocitytmp);
+  fixed_point_acceleration_free(acceleration);
 
 }
 
@@ -28,6 +28,7 @@
 #include "siconos_debug.h"                   // for DEBUG_PRINTF, DEBUG_EXPR_WE
 #include "fc3d_Solvers.h"            // for fc3d_ExtraGradient, fc3d_ExtraGr...
 #include "fc3d_compute_error.h"      // for fc3d_compute_error
+#include "fixed_point_acceleration.h"  // for fixed_point_acceleration_apply
 #include "numerics_verbose.h"        // for verbose
 #include "projectionOnCone.h"        // for projectionOnCone
 #include "SiconosBlas.h"                   // for cblas_dcopy, cblas_dnrm2, cblas_...
@@ -63,6 +64,10 @@ void fc3d_ExtraGradient(FrictionContactProblem* problem, double *reaction, doubl
   double * velocitytmp = (double *)calloc(n,sizeof(double));
   double * reactiontmp = (double *)calloc(n,sizeof(double));
 
+  /* acceleration of the fixed point iterations (NULL if none) */
+  fixed_point_acceleration* acceleration =
+    fc3d_fixed_point_acceleration_new(problem, reaction, options);
+
   double rho = 0.0, rho_k =0.0;
   int isVariable = 0;
 
@@ -159,6 +164,10 @@ void fc3d_ExtraGradient(FrictionContactProblem* problem, double *reaction, doubl
       }
       if(error < tolerance) hasNotConverged = 0;
       *info = hasNotConverged;
+
+      /* acceleration of the fixed point iterations */
+      if(acceleration && hasNotConverged && iter < itermax)
+        fixed_point_acceleration_apply(acceleration, reaction, error);
     }
   }
 
@@ -307,6 +316,10 @@ void fc3d_ExtraGradient(FrictionContactProblem* problem, double *reaction, doubl
       }
       if(error < tolerance) hasNotConverged = 0;
       *info = hasNotConverged;
+
+      /* acceleration of the fixed point iterations */
+      if(acceleration && hasNotConverged && iter < itermax)
+        fixed_point_acceleration_apply(acceleration, reaction, error);
     }
   }
 
@@ -319,6 +332,7 @@ void fc3d_ExtraGradient(FrictionContactProblem* problem, double *reaction, doubl
   iparam[SICONOS_IPARAM_ITER_DONE] = iter;
   free(velocitytmp);
   free(reactiontmp);
+  fixed_point_acceleration_free(acceleration);
   if(isVariable)
   {
     free(reaction_k);
@@ -29,6 +29,7 @@
 #include "siconos_debug.h"                   // for DEBUG_EXPR_WE, DEBUG_PRINTF
 #include "fc3d_Solvers.h"            // for fc3d_fixedPointProjection, fc3d_...
 #include "fc3d_compute_error.h"      // for fc3d_compute_error
+#include "fixed_point_acceleration.h"  // for fixed_point_acceleration_apply
 #include "numerics_verbose.h"        // for verbose
 #include "projectionOnCone.h"        // for projectionOnCone
 #include "SiconosBlas.h"                   // for cblas_dcopy, cblas_dnrm2, cblas_...
@@ -59,6 +60,10 @@ void fc3d_fixedPointProjection(FrictionContactProblem* problem, double *reaction
   int nLocal = 3;
   double * velocitytmp = (double *)malloc(n * sizeof(double));
 
+  /* acceleration of the fixed point iterations (NULL if none) */
+  fixed_point_acceleration* acceleration =
+    fc3d_fixed_point_acceleration_new(problem, reaction, options);
+
 
   double rho = 0.0, rho_k =0.0;
   int isVariable = 0;
@@ -231,6 +236,10 @@ void fc3d_fixedPointProjection(FrictionContactProblem* problem, double *reaction
 
       if(error < tolerance) hasNotConverged = 0;
       *info = hasNotConverged;
+
+      /* acceleration of the fixed point iterations */
+      if(acceleration && hasNotConverged && iter < itermax)
+        fixed_point_acceleration_apply(acceleration, reaction, error);
     }
 
   }
@@ -242,6 +251,7 @@ void fc3d_fixedPointProjection(FrictionContactProblem* problem, double *reaction
   iparam[SICONOS_IPARAM_ITER_DONE] = iter;
   dparam[SICONOS_DPARAM_RESIDU] = error;
   free(velocitytmp);
+  fixed_point_acceleration_free(acceleration);
   free(reaction_k);
   free(velocity_k);
   free(reactiontmp);
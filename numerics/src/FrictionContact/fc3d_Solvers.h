@@ -37,6 +37,7 @@
 #include "fc3d_onecontact_nonsmooth_Newton_solvers.h"
 #include "fc3d_projection.h"
 #include "fc3d_unitary_enumerative.h"
+#include "fixed_point_acceleration.h"
 
 /** pointer to function used to call local solver */
 typedef int (*SolverPtr)(FrictionContactProblem *, double *, SolverOptions *);
@@ -109,6 +110,33 @@ extern "C" {
     [in] iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE_SEED(6)] : seed for the random
     generator in shuffling  contacts
 
+    [in] iparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION(15)] : mixed
+    precision SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_FALSE (0) : all the
+    sweeps are in double precision SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TRUE
+    (1) : if M has a sparse block storage, the first sweeps use a single
+    precision copy of its extra diagonal blocks, until the light error is
+    below dparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TOL(9)], with
+    the shuffle and relaxation options. The iterations then go on in
+    double precision.
+
+    [in] iparam[SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP(16)] :
+    SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP_FALSE (0) : the loops
+    specialized at compile time are used for the NSN-AC and projection
+    local solvers, without freezing and with a light error evaluation,
+    SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP_TRUE (1) : the generic loop
+    is always used.
+
+    [in] iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION(11)] : acceleration
+    of the outer loop, SICONOS_FIXED_POINT_ACCELERATION_NONE (0),
+    SICONOS_FIXED_POINT_ACCELERATION_ANDERSON (1) with the memory
+    iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION_MEMORY(12)],
+    SICONOS_FIXED_POINT_ACCELERATION_NESTEROV (2) or
+    SICONOS_FIXED_POINT_ACCELERATION_SOR (3) with omega bounded by
+    dparam[SICONOS_FRICTION_3D_DPARAM_ACCELERATION_OMEGA_MAX(10)]. The
+    specialized loops are not used when the acceleration is active, and
+    the acceleration safeguard uses the full error (computeError), not the
+    light one.
+
     [out] iparam[SICONOS_IPARAM_ITER_DONE(1)] = iter number of performed
     iterations
 
@@ -116,6 +144,7 @@ extern "C" {
 
     [in]  dparam[SICONOS_DPARAM_TOL(0)] user tolerance on the loop
     [in]  dparam[8]  the relaxation parameter omega
+    [in]  dparam[9]  the tolerance of the single precision sweeps
     [out] dparam[SICONOS_DPARAM_RESIDU(1)]  reached error
 
     The internal (local) solver must set by the SolverOptions options[1]
@@ -232,6 +261,9 @@ void fc3d_ConvexQP_ProjectedGradient_Cylinder(FrictionContactProblem *problem,
    \param info return 0 if the solution is found
    \param options the solver options : dparam[3] : rho . if dparam[3] >0 then
    rho=dparam[3] otherwise a computataion of rho is assumed.
+
+   The iterations may be accelerated with
+   iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION(11)], see fc3d_nsgs.
 */
 void fc3d_DeSaxceFixedPoint(FrictionContactProblem *problem, double *reaction,
                             double *velocity, int *info,
@@ -248,6 +280,9 @@ void fc3d_DeSaxceFixedPoint(FrictionContactProblem *problem, double *reaction,
    \param options the solver options :
    dparam[3] : rho . if dparam[3] >0 then rho=dparam[3] otherwise a
    computataion of rho is assumed.
+
+   The iterations may be accelerated with
+   iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION(11)], see fc3d_nsgs.
 */
 void fc3d_fixedPointProjection(FrictionContactProblem *problem,
                                double *reaction, double *velocity, int *info,
@@ -262,6 +297,10 @@ void fc3d_fixedPointProjection(FrictionContactProblem *problem,
    \param reaction global vector (n), in-out parameters
    \param info return 0 if the solution is found
    \param options the solver options :
+
+   The iterations may be accelerated with
+   iparam[SICONOS_VI_IPARAM_ACCELERATION(11)], see
+   variationalInequality_FixedPointProjection.
 */
 void fc3d_VI_FixedPointProjection(FrictionContactProblem *problem,
                                   double *reaction, double *velocity, int *info,
@@ -280,6 +319,9 @@ void fc3d_VI_FixedPointProjection_Cylinder(FrictionContactProblem *problem,
    \param reaction global vector (n), in-out parameters
    \param info return 0 if the solution is found
    \param options the solver options
+
+   The iterations may be accelerated with
+   iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION(11)], see fc3d_nsgs.
 */
 void fc3d_ExtraGradient(FrictionContactProblem *problem, double *reaction,
                         double *velocity, int *info, SolverOptions *options);
@@ -384,6 +426,20 @@ void fc3d_set_internalsolver_tolerance(FrictionContactProblem *problem,
                                        SolverOptions *internalsolver_options,
                                        double error);
 
+/** Create the acceleration of the fixed point iterations of a solver
+    (FPP, DSFP, EG or NSGS), following
+    iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION]. The accelerated
+    reactions are projected on the friction cones.
+
+    \param problem the friction-contact 3D problem to solve
+    \param reaction the starting point of the iterations
+    \param options the solver options
+    \return the acceleration data, NULL if no acceleration is required
+*/
+fixed_point_acceleration *
+fc3d_fixed_point_acceleration_new(FrictionContactProblem *problem,
+                                  double *reaction, SolverOptions *options);
+
 /** \addtogroup SetSolverOptions
  * @{
  */
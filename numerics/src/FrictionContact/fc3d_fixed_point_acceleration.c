@@ -0,0 +1,49 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+#include "FrictionContactProblem.h"    // for FrictionContactProblem
+#include "Friction_cst.h"              // for SICONOS_FRICTION_3D_IPARAM_ACC...
+#include "SiconosBlas.h"               // for cblas_dcopy
+#include "SolverOptions.h"             // for SolverOptions
+#include "fc3d_Solvers.h"              // for fc3d_fixed_point_acceleration_new
+#include "fixed_point_acceleration.h"  // for fixed_point_acceleration_new
+#include "projectionOnCone.h"          // for projectionOnCone
+
+/* projection of the reactions of all the contacts on their friction cones */
+static void fc3d_projection_on_cones(void* env, double* reaction, double* preaction)
+{
+  FrictionContactProblem* problem = (FrictionContactProblem*)env;
+  int nc = problem->numberOfContacts;
+  cblas_dcopy(3 * nc, reaction, 1, preaction, 1);
+  for(int contact = 0 ; contact < nc ; ++contact)
+    projectionOnCone(&preaction[3 * contact], problem->mu[contact]);
+}
+
+fixed_point_acceleration* fc3d_fixed_point_acceleration_new(FrictionContactProblem* problem,
+                                                            double* reaction,
+                                                            SolverOptions* options)
+{
+  fixed_point_acceleration* acceleration =
+    fixed_point_acceleration_new(options->iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION],
+                                 3 * problem->numberOfContacts,
+                                 options->iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION_MEMORY],
+                                 options->dparam[SICONOS_FRICTION_3D_DPARAM_ACCELERATION_OMEGA_MAX],
+                                 &fc3d_projection_on_cones, problem);
+  if(acceleration)
+    fixed_point_acceleration_initialize(acceleration, reaction);
+  return acceleration;
+}
@@ -25,7 +25,9 @@
 #include "Friction_cst.h"                              // for SICONOS_FRICTI...
 #include "NumericsArrays.h"                            // for uint_shuffle
 #include "NumericsFwd.h"                               // for SolverOptions
+#include "NumericsMatrix.h"                            // for NumericsMatrix
 #include "SolverOptions.h"                             // for SolverOptions
+#include "SparseBlockMatrix.h"                         // for SBM_new_float_bl...
 #include "fc3d_2NCP_Glocker.h"                         // for NCPGlocker_update
 #include "fc3d_NCPGlockerFixedPoint.h"                 // for fc3d_FixedP_in...
 #include "fc3d_Path.h"                                 // for fc3d_Path_init...
@@ -35,6 +37,7 @@
 #include "fc3d_onecontact_nonsmooth_Newton_solvers.h"  // for fc3d_onecontac...
 #include "fc3d_projection.h"                           // for fc3d_projectio...
 #include "fc3d_unitary_enumerative.h"                  // for fc3d_unitary_e...
+#include "fixed_point_acceleration.h"                  // for fixed_point_acc...
 #include "numerics_verbose.h"                          // for numerics_printf
 #include "SiconosBlas.h"                                     // for cblas_dnrm2
 /* #define DEBUG_STDOUT */
@@ -560,6 +563,247 @@ void statsIterationCallback(FrictionContactProblem *problem,
 }
 
 
+/* Sweeps with a single precision copy of the extra diagonal blocks of
+ * M (SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION). Only the data streamed
+ * through memory at each sweep is in single precision: the diagonal
+ * blocks, the local problems and the reaction stay in double
+ * precision. The sweeps stop when the light error is below
+ * max(tolerance, dparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TOL]),
+ * the iterations then go on in double precision with the usual loops.
+ * The local problem is built as in the update functions without
+ * regularization (fc3d_nsgs_update, fc3d_projection_update,
+ * fc3d_onecontact_nonsmooth_Newton_AC_update). The contacts are
+ * shuffled and the local solutions relaxed as in the generic loop.
+ */
+static
+void fc3d_nsgs_single_precision_sweeps(FrictionContactProblem *problem,
+                                       FrictionContactProblem *localproblem,
+                                       SolverPtr local_solver,
+                                       double *reaction, SolverOptions *options,
+                                       unsigned int *scontacts,
+                                       double tolerance, double *error, int *iter)
+{
+  SolverOptions * localsolver_options = options->internalSolvers[0];
+  SparseBlockStructuredMatrix* M = problem->M->matrix1;
+  unsigned int nc = problem->numberOfContacts;
+  int itermax = options->iparam[SICONOS_IPARAM_MAX_ITER];
+  int filter = (options->iparam[SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION]
+                == SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION_TRUE);
+  int shuffle = options->iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE];
+  int relaxation = (options->iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION]
+                    == SICONOS_FRICTION_3D_NSGS_RELAXATION_TRUE);
+  double omega = options->dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE];
+  double single_precision_tolerance =
+    fmax(tolerance, options->dparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TOL]);
+  double norm_r[] = {1e24};
+  double localreaction[3];
+
+  float * blocks = SBM_new_float_blocks_3x3(M);
+
+  int hasNotConverged = 1;
+  while((*iter < itermax) && (hasNotConverged > 0))
+  {
+    ++(*iter);
+    double light_error_sum = 0.0;
+    fc3d_set_internalsolver_tolerance(problem, options, localsolver_options, *error);
+
+    for(unsigned int i = 0 ; i < nc ; ++i)
+    {
+      unsigned int contact = i;
+      if(shuffle == SICONOS_FRICTION_3D_NSGS_SHUFFLE_TRUE
+          || shuffle == SICONOS_FRICTION_3D_NSGS_SHUFFLE_TRUE_EACH_LOOP)
+      {
+        if(shuffle == SICONOS_FRICTION_3D_NSGS_SHUFFLE_TRUE_EACH_LOOP)
+          uint_shuffle(scontacts, nc);
+        contact = scontacts[i];
+      }
+      fc3d_local_problem_fill_M(problem, localproblem, contact);
+      localproblem->q[0] = problem->q[contact*3 + 0];
+      localproblem->q[1] = problem->q[contact*3 + 1];
+      localproblem->q[2] = problem->q[contact*3 + 2];
+      SBM_row_prod_no_diag_3x3_float(contact, M, blocks, reaction, localproblem->q);
+      localproblem->mu[0] = problem->mu[contact];
+
+      localsolver_options->iparam[SICONOS_FRICTION_3D_CURRENT_CONTACT_NUMBER] = contact;
+      localreaction[0] = reaction[contact*3 + 0];
+      localreaction[1] = reaction[contact*3 + 1];
+      localreaction[2] = reaction[contact*3 + 2];
+      (*local_solver)(localproblem, localreaction, localsolver_options);
+
+      if(relaxation)
+        performRelaxation(localreaction, &reaction[contact*3], omega);
+
+      light_error_sum += light_error_squared(localreaction, &reaction[contact*3]);
+
+      if(filter)
+        acceptLocalReactionFiltered(localproblem, localsolver_options,
+                                    contact, *iter, reaction, localreaction);
+      else
+        acceptLocalReactionUnconditionally(contact, reaction, localreaction);
+    }
+
+    *error = calculateLightError(light_error_sum, nc, reaction, norm_r);
+    hasNotConverged = (*error >= single_precision_tolerance);
+    numerics_printf("--------------- FC3D - NSGS - Iteration %i (single precision) "
+                    "Residual = %14.7e, tolerance = %7.3e", *iter, *error,
+                    single_precision_tolerance);
+  }
+  free(blocks);
+}
+
+
+/* NSGS loops specialized at compile time, for the local solvers,
+ * error evaluations, relaxation and shuffle options used in most
+ * simulations. The local solver and the update of the local problem
+ * are direct calls and the options are constants, so that the inner
+ * loop over the contacts has no indirect call and no iparam test. The
+ * loop is selected once per call to fc3d_nsgs, see
+ * fc3d_nsgs_select_specialized_loop.
+ *
+ * FULL_FINAL is 0 for SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT
+ * and 1 for SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL.
+ * The loop returns hasNotConverged.
+ */
+typedef int (*SpecializedLoopPtr)(FrictionContactProblem *, FrictionContactProblem *,
+                                  double *, double *, SolverOptions *, ComputeErrorPtr,
+                                  unsigned int *, double *, double, double *, int *);
+
+#define FC3D_NSGS_SPECIALIZED_LOOP(NAME, SOLVE, UPDATE, SHUFFLE, RELAXATION, FULL_FINAL) \
+  static int NAME(FrictionContactProblem *problem,                      \
+                  FrictionContactProblem *localproblem,                 \
+                  double *reaction, double *velocity,                   \
+                  SolverOptions *options, ComputeErrorPtr computeError, \
+                  unsigned int *scontacts, double *tolerance,           \
+                  double norm_q, double *error, int *iter)              \
+  {                                                                     \
+    SolverOptions * localsolver_options = options->internalSolvers[0];  \
+    unsigned int nc = problem->numberOfContacts;                        \
+    int itermax = options->iparam[SICONOS_IPARAM_MAX_ITER];             \
+    int filter = (options->iparam[SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION] \
+                  == SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION_TRUE); \
+    double omega = options->dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE]; \
+    double norm_r[] = {1e24};                                           \
+    double localreaction[3];                                            \
+    int hasNotConverged = 1;                                            \
+                                                                        \
+    while((*iter < itermax) && (hasNotConverged > 0))                   \
+    {                                                                   \
+      ++(*iter);                                                        \
+      double light_error_sum = 0.0;                                     \
+      fc3d_set_internalsolver_tolerance(problem, options, localsolver_options, *error); \
+                                                                        \
+      for(unsigned int i = 0 ; i < nc ; ++i)                            \
+      {                                                                 \
+        unsigned int contact = SHUFFLE ? scontacts[i] : i;              \
+                                                                        \
+        UPDATE(contact, problem, localproblem, reaction, localsolver_options); \
+        localsolver_options->iparam[SICONOS_FRICTION_3D_CURRENT_CONTACT_NUMBER] = contact; \
+        localreaction[0] = reaction[contact*3 + 0];                     \
+        localreaction[1] = reaction[contact*3 + 1];                     \
+        localreaction[2] = reaction[contact*3 + 2];                     \
+        SOLVE(localproblem, localreaction, localsolver_options);        \
+                                                                        \
+        if(RELAXATION)                                                  \
+          performRelaxation(localreaction, &reaction[contact*3], omega); \
+                                                                        \
+        light_error_sum += light_error_squared(localreaction, &reaction[contact*3]); \
+                                                                        \
+        if(filter)                                                      \
+          acceptLocalReactionFiltered(localproblem, localsolver_options, \
+                                      contact, *iter, reaction, localreaction); \
+        else                                                            \
+          acceptLocalReactionUnconditionally(contact, reaction, localreaction); \
+      }                                                                 \
+                                                                        \
+      *error = calculateLightError(light_error_sum, nc, reaction, norm_r); \
+      if(FULL_FINAL)                                                    \
+      {                                                                 \
+        hasNotConverged = determine_convergence_with_full_final(problem, options, computeError, \
+                          reaction, velocity,                           \
+                          tolerance, norm_q, *error,                    \
+                          *iter);                                       \
+        if(!(*tolerance > 0.0))                                         \
+        {                                                               \
+          numerics_warning("fc3d_nsgs", "tolerance has to be positive!!"); \
+          numerics_warning("fc3d_nsgs", "we stop the iterations");      \
+          break;                                                        \
+        }                                                               \
+      }                                                                 \
+      else                                                              \
+        hasNotConverged = determine_convergence(*error, *tolerance, *iter, options); \
+                                                                        \
+      statsIterationCallback(problem, options, reaction, velocity, *error); \
+    }                                                                   \
+    return hasNotConverged;                                             \
+  }
+
+#define FC3D_NSGS_SPECIALIZED_LOOPS(PREFIX, SOLVE, UPDATE)                   \
+  FC3D_NSGS_SPECIALIZED_LOOP(PREFIX##_light, SOLVE, UPDATE, 0, 0, 0)         \
+  FC3D_NSGS_SPECIALIZED_LOOP(PREFIX##_light_full_final, SOLVE, UPDATE, 0, 0, 1) \
+  FC3D_NSGS_SPECIALIZED_LOOP(PREFIX##_relax_light, SOLVE, UPDATE, 0, 1, 0)   \
+  FC3D_NSGS_SPECIALIZED_LOOP(PREFIX##_relax_light_full_final, SOLVE, UPDATE, 0, 1, 1) \
+  FC3D_NSGS_SPECIALIZED_LOOP(PREFIX##_shuffle_light, SOLVE, UPDATE, 1, 0, 0) \
+  FC3D_NSGS_SPECIALIZED_LOOP(PREFIX##_shuffle_light_full_final, SOLVE, UPDATE, 1, 0, 1) \
+  FC3D_NSGS_SPECIALIZED_LOOP(PREFIX##_shuffle_relax_light, SOLVE, UPDATE, 1, 1, 0) \
+  FC3D_NSGS_SPECIALIZED_LOOP(PREFIX##_shuffle_relax_light_full_final, SOLVE, UPDATE, 1, 1, 1) \
+  static SpecializedLoopPtr PREFIX##_loops[2][2][2] =                        \
+  {                                                                          \
+    {{PREFIX##_light, PREFIX##_light_full_final},                            \
+     {PREFIX##_relax_light, PREFIX##_relax_light_full_final}},               \
+    {{PREFIX##_shuffle_light, PREFIX##_shuffle_light_full_final},            \
+     {PREFIX##_shuffle_relax_light, PREFIX##_shuffle_relax_light_full_final}} \
+  };
+
+/* Alart-Curnier nonsmooth Newton (NSN, NSN_GP and NSN_GP_HYBRID) */
+FC3D_NSGS_SPECIALIZED_LOOPS(fc3d_nsgs_loop_nsn_ac,
+                            fc3d_onecontact_nonsmooth_Newton_solvers_solve,
+                            fc3d_onecontact_nonsmooth_Newton_AC_update)
+
+/* Projection on cone */
+FC3D_NSGS_SPECIALIZED_LOOPS(fc3d_nsgs_loop_projection,
+                            fc3d_projectionOnCone_solve,
+                            fc3d_projection_update)
+
+static
+SpecializedLoopPtr fc3d_nsgs_select_specialized_loop(SolverPtr local_solver,
+                                                     UpdatePtr update_localproblem,
+                                                     SolverOptions *options)
+{
+  int* iparam = options->iparam;
+
+  if(iparam[SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP] == SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP_TRUE)
+    return NULL;
+
+  if(iparam[SICONOS_FRICTION_3D_NSGS_FREEZING_CONTACT] != 0)
+    return NULL;
+
+  int shuffle;
+  if(iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] == SICONOS_FRICTION_3D_NSGS_SHUFFLE_FALSE)
+    shuffle = 0;
+  else if(iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] == SICONOS_FRICTION_3D_NSGS_SHUFFLE_TRUE)
+    shuffle = 1;
+  else
+    return NULL;
+
+  int full_final;
+  if(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT)
+    full_final = 0;
+  else if(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL)
+    full_final = 1;
+  else
+    return NULL;
+
+  int relaxation = (iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] == SICONOS_FRICTION_3D_NSGS_RELAXATION_TRUE);
+
+  if(local_solver == &fc3d_onecontact_nonsmooth_Newton_solvers_solve
+      && update_localproblem == &fc3d_onecontact_nonsmooth_Newton_AC_update)
+    return fc3d_nsgs_loop_nsn_ac_loops[shuffle][relaxation][full_final];
+  else if(local_solver == &fc3d_projectionOnCone_solve
+          && update_localproblem == &fc3d_projection_update)
+    return fc3d_nsgs_loop_projection_loops[shuffle][relaxation][full_final];
+
+  return NULL;
+}
 
 
 void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
@@ -646,10 +890,42 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
 
   /*****  NSGS Iterations *****/
 
+  /* First sweeps in single precision */
+  if(iparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION] == SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TRUE)
+  {
+    if(problem->M->storageType == NM_SPARSE_BLOCK
+        && (update_localproblem == &fc3d_nsgs_update
+            || update_localproblem == &fc3d_projection_update
+            || update_localproblem == &fc3d_onecontact_nonsmooth_Newton_AC_update))
+      fc3d_nsgs_single_precision_sweeps(problem, localproblem, local_solver,
+                                        reaction, options, scontacts, tolerance, &error, &iter);
+    else
+      numerics_warning("fc3d_nsgs", "mixed precision needs a sparse block storage "
+                       "of M and a local solver without regularization, it is not used");
+  }
+
+  /* Acceleration of the outer loop (NULL if none), only done in the
+   * generic loop */
+  fixed_point_acceleration* acceleration =
+    fc3d_fixed_point_acceleration_new(problem, reaction, options);
+
+  /* Loops specialized at compile time for the most common local
+   * solvers and options */
+  SpecializedLoopPtr specialized_loop = NULL;
+  if(!acceleration)
+    specialized_loop = fc3d_nsgs_select_specialized_loop(local_solver, update_localproblem, options);
+  if(specialized_loop)
+  {
+    hasNotConverged = (*specialized_loop)(problem, localproblem, reaction, velocity,
+                                          options, computeError, scontacts,
+                                          &tolerance, norm_q, &error, &iter);
+  }
+
   /* A special case for the most common options (should correspond
    * with mechanics_run.py **/
-  if(iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] == SICONOS_FRICTION_3D_NSGS_SHUFFLE_FALSE
-     && iparam[SICONOS_FRICTION_3D_NSGS_FREEZING_CONTACT] == 0
+  else if(!acceleration
+      && iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] == SICONOS_FRICTION_3D_NSGS_SHUFFLE_FALSE
+      && iparam[SICONOS_FRICTION_3D_NSGS_FREEZING_CONTACT] == 0
       && iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] == SICONOS_FRICTION_3D_NSGS_RELAXATION_FALSE
       && iparam[SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION] == SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION_TRUE
       && iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT)
@@ -837,6 +1113,18 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
 
       statsIterationCallback(problem, options, reaction, velocity, error);
 
+      if(acceleration && hasNotConverged > 0 && iter < itermax)
+      {
+        /* The light error measures the last increment of the reactions,
+         * it is not a merit function after an extrapolated step: the
+         * safeguard of the acceleration uses the full error. */
+        double merit = error;
+        if(!(iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] == SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_FULL
+             && iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION_FREQUENCY] <= 0))
+          (*computeError)(problem, reaction, velocity, tolerance, options, norm_q, &merit);
+        fixed_point_acceleration_apply(acceleration, reaction, merit);
+      }
+
       /* if(iparam[SICONOS_FRICTION_3D_NSGS_FREEZING_CONTACT] >0) */
       /* { */
       /*   int frozen_contact=0; */
@@ -877,6 +1165,7 @@ void fc3d_nsgs(FrictionContactProblem* problem, double *reaction,
   (*freeSolver)(problem,localproblem,localsolver_options);
   fc3d_local_problem_free(localproblem, problem);
   if(scontacts) free(scontacts);
+  fixed_point_acceleration_free(acceleration);
 }
 
 void fc3d_nsgs_set_default(SolverOptions* options)
@@ -890,6 +1179,9 @@ void fc3d_nsgs_set_default(SolverOptions* options)
   options->iparam[SICONOS_FRICTION_3D_NSGS_FREEZING_CONTACT] = 0;
   options->iparam[SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION] = SICONOS_FRICTION_3D_NSGS_FILTER_LOCAL_SOLUTION_FALSE;
   options->iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] = SICONOS_FRICTION_3D_NSGS_RELAXATION_FALSE;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION] = SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_FALSE;
+  options->dparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TOL] = 1e-4;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP] = SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP_FALSE;
   options->iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION_FREQUENCY] = 0;
   options->dparam[SICONOS_DPARAM_TOL] = 1e-4;
   options->dparam[SICONOS_FRICTION_3D_DPARAM_INTERNAL_ERROR_RATIO] = 10.0;
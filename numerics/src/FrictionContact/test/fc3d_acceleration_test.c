@@ -0,0 +1,108 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The FC3D solvers with an accelerated fixed point loop (NSGS, DSFP, FPP,
+   EG and VI FPP) run without acceleration and with the Anderson, Nesterov
+   and SOR accelerations. With NSGS, the light error evaluation is used, the
+   acceleration safeguard must still lead to the solution. Each run must
+   converge, and the error of its result, computed again with
+   fc3d_compute_error, must be below the tolerance. */
+
+#include <stdio.h>                      // for printf
+#include <stdlib.h>                     // for calloc, free
+#include "FrictionContactProblem.h"     // for FrictionContactProblem, friction...
+#include "Friction_cst.h"               // for SICONOS_FRICTION_3D_IPARAM_ACCEL...
+#include "NonSmoothDrivers.h"           // for fc3d_driver
+#include "SiconosBlas.h"                // for cblas_dnrm2
+#include "SolverOptions.h"              // for SolverOptions, solver_options_c...
+#include "VI_cst.h"                     // for SICONOS_VI_IPARAM_ACCELERATION
+#include "fc3d_compute_error.h"         // for fc3d_compute_error
+#include "fixed_point_acceleration.h"   // for SICONOS_FIXED_POINT_ACCELERATIO...
+
+static int solve(FrictionContactProblem* problem, int solver, int acceleration,
+                 double tolerance, double * reaction, double * velocity, int * iter)
+{
+  SolverOptions * options = solver_options_create(solver);
+  options->dparam[SICONOS_DPARAM_TOL] = tolerance;
+  options->iparam[SICONOS_IPARAM_MAX_ITER] = 20000;
+  if(solver == SICONOS_FRICTION_3D_VI_FPP)
+    options->iparam[SICONOS_VI_IPARAM_ACCELERATION] = acceleration;
+  else
+    options->iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION] = acceleration;
+  if(solver == SICONOS_FRICTION_3D_NSGS)
+    options->iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] =
+      SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL;
+  if(solver == SICONOS_FRICTION_3D_EG)
+    options->dparam[SICONOS_VI_DPARAM_RHO] = -1.;
+  for(int i = 0; i < 3 * problem->numberOfContacts; i++)
+    reaction[i] = velocity[i] = 0.;
+  int info = fc3d_driver(problem, reaction, velocity, options);
+  *iter = options->iparam[SICONOS_IPARAM_ITER_DONE];
+  solver_options_delete(options);
+  free(options);
+  return info;
+}
+
+int main(void)
+{
+  int info = 0;
+  const char * files[3] = {"./data/FC3D_Example1_SBM.dat", "./data/Rover4144.dat",
+                           "./data/NESpheres_10_1.dat"
+                          };
+  int solvers[5] = {SICONOS_FRICTION_3D_NSGS, SICONOS_FRICTION_3D_DSFP, SICONOS_FRICTION_3D_FPP,
+                    SICONOS_FRICTION_3D_EG, SICONOS_FRICTION_3D_VI_FPP
+                   };
+  int accelerations[4] = {SICONOS_FIXED_POINT_ACCELERATION_NONE,
+                          SICONOS_FIXED_POINT_ACCELERATION_ANDERSON,
+                          SICONOS_FIXED_POINT_ACCELERATION_NESTEROV,
+                          SICONOS_FIXED_POINT_ACCELERATION_SOR
+                         };
+  double tolerance = 1e-8;
+  for(int k = 0; k < 3; k++)
+  {
+    FrictionContactProblem * problem = frictionContact_new_from_filename(files[k]);
+    if(!problem)
+    {
+      printf("%s: cannot read the problem\n", files[k]);
+      return 1;
+    }
+    int size = 3 * problem->numberOfContacts;
+    double norm_q = cblas_dnrm2(size, problem->q, 1);
+    double * reaction = (double *)calloc(size, sizeof(double));
+    double * velocity = (double *)calloc(size, sizeof(double));
+
+    for(int s = 0; s < 5; s++)
+      for(int a = 0; a < 4; a++)
+      {
+        int iter = 0;
+        double error = 0.;
+        int info_k = solve(problem, solvers[s], accelerations[a], tolerance,
+                           reaction, velocity, &iter);
+        fc3d_compute_error(problem, reaction, velocity, tolerance, NULL, norm_q, &error);
+        printf("%s, solver %i, acceleration %i: info %i, iter %i, error %e\n",
+               files[k], solvers[s], accelerations[a], info_k, iter, error);
+        if(info_k || error > tolerance)
+          info++;
+      }
+    free(reaction);
+    free(velocity);
+    frictionContactProblem_free(problem);
+  }
+  printf("End of test, info = %i\n", info);
+  return info;
+}
@@ -0,0 +1,112 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* FC3D problems with a sparse block storage of M solved by NSGS in double
+   precision and with first sweeps in single precision, for the NSN-AC and
+   projection local solvers, with and without shuffle and relaxation. The
+   iterations end in double precision: the mixed precision run must
+   converge when the double one does, and the full error of its result
+   must be below the tolerance too. */
+
+#include <stdio.h>                   // for printf
+#include <stdlib.h>                  // for calloc, free
+#include "FrictionContactProblem.h"  // for FrictionContactProblem, friction...
+#include "Friction_cst.h"            // for SICONOS_FRICTION_3D_NSGS_MIXED_P...
+#include "NonSmoothDrivers.h"        // for fc3d_driver
+#include "NumericsMatrix.h"          // for NM_SPARSE_BLOCK
+#include "SiconosBlas.h"             // for cblas_dnrm2
+#include "SolverOptions.h"           // for SolverOptions, solver_options_c...
+#include "fc3d_compute_error.h"      // for fc3d_compute_error
+
+static int solve(FrictionContactProblem* problem, int local_solver, int mixed_precision,
+                 int shuffle, int relaxation, double tolerance,
+                 double * reaction, double * velocity, double * error)
+{
+  SolverOptions * options = solver_options_create(SICONOS_FRICTION_3D_NSGS);
+  options->dparam[SICONOS_DPARAM_TOL] = tolerance;
+  options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION] = mixed_precision;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] = shuffle;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE_SEED] = 7;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] = relaxation;
+  options->dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE] = 0.9;
+  solver_options_update_internal(options, 0, local_solver);
+  int size = 3 * problem->numberOfContacts;
+  for(int i = 0; i < size; i++)
+    reaction[i] = velocity[i] = 0.;
+  int info = fc3d_driver(problem, reaction, velocity, options);
+  fc3d_compute_error(problem, reaction, velocity, tolerance, options,
+                     cblas_dnrm2(size, problem->q, 1), error);
+  solver_options_delete(options);
+  free(options);
+  return info;
+}
+
+int main(void)
+{
+  int info = 0;
+  const char * files[3] = {"./data/FC3D_Example1_SBM.dat", "./data/Confeti-ex13-4contact-Fc3D-SBM.dat",
+                           "./data/BoxesStack1-i100000-32.hdf5.dat"
+                          };
+  int local_solvers[2] = {SICONOS_FRICTION_3D_ONECONTACT_NSN,
+                          SICONOS_FRICTION_3D_ONECONTACT_ProjectionOnCone
+                         };
+  double tolerance = 1e-8;
+  for(int k = 0; k < 3; k++)
+  {
+    FrictionContactProblem * problem = frictionContact_new_from_filename(files[k]);
+    if(!problem)
+    {
+      printf("%s: cannot read the problem\n", files[k]);
+      return 1;
+    }
+    if(problem->M->storageType != NM_SPARSE_BLOCK)
+    {
+      printf("%s: M has not a sparse block storage\n", files[k]);
+      return 1;
+    }
+    int size = 3 * problem->numberOfContacts;
+    double * reaction = (double *)calloc(size, sizeof(double));
+    double * velocity = (double *)calloc(size, sizeof(double));
+
+    for(int l = 0; l < 2; l++)
+      for(int shuffle = 0; shuffle < 2; shuffle++)
+        for(int relaxation = 0; relaxation < 2; relaxation++)
+        {
+          double error_ref = 0., error = 0.;
+          int info_ref = solve(problem, local_solvers[l], SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_FALSE,
+                               shuffle, relaxation, tolerance, reaction, velocity, &error_ref);
+          int info_k = solve(problem, local_solvers[l], SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TRUE,
+                             shuffle, relaxation, tolerance, reaction, velocity, &error);
+          if(info_k != info_ref || (!info_ref && error > tolerance))
+          {
+            printf("%s, local solver %i, shuffle %i, relaxation %i: "
+                   "info %i, error %e instead of info %i, error %e\n",
+                   files[k], local_solvers[l], shuffle, relaxation,
+                   info_k, error, info_ref, error_ref);
+            info++;
+          }
+        }
+    printf("%s: done\n", files[k]);
+    free(reaction);
+    free(velocity);
+    frictionContactProblem_free(problem);
+  }
+  printf("End of test, info = %i\n", info);
+  return info;
+}
@@ -0,0 +1,125 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The same FC3D problems solved by NSGS with the loops specialized at
+   compile time and with the generic loop, for the NSN-AC and projection
+   local solvers and for all the shuffle, relaxation and error evaluation
+   (light and light with full final) options of the specialized loops. The
+   local problems are solved in the same order with the same operations:
+   the number of iterations, the solutions and the errors must be the
+   ones of the generic loop, up to round-off errors. */
+
+#include <math.h>                    // for fabs
+#include <stdio.h>                   // for printf
+#include <stdlib.h>                  // for calloc, free
+#include "FrictionContactProblem.h"  // for FrictionContactProblem, friction...
+#include "Friction_cst.h"            // for SICONOS_FRICTION_3D_NSGS_GENERIC_...
+#include "NonSmoothDrivers.h"        // for fc3d_driver
+#include "SolverOptions.h"           // for SolverOptions, solver_options_c...
+
+static int solve(FrictionContactProblem* problem, int local_solver, int generic_loop,
+                 int shuffle, int relaxation, int error_evaluation,
+                 double * reaction, double * velocity, int * iter, double * error)
+{
+  SolverOptions * options = solver_options_create(SICONOS_FRICTION_3D_NSGS);
+  options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+  options->iparam[SICONOS_IPARAM_MAX_ITER] = 200;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP] = generic_loop;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] = shuffle;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE_SEED] = 7;
+  options->iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] = relaxation;
+  options->dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE] = 0.9;
+  options->iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] = error_evaluation;
+  solver_options_update_internal(options, 0, local_solver);
+  for(int i = 0; i < 3 * problem->numberOfContacts; i++)
+    reaction[i] = velocity[i] = 0.;
+  int info = fc3d_driver(problem, reaction, velocity, options);
+  *iter = options->iparam[SICONOS_IPARAM_ITER_DONE];
+  *error = options->dparam[SICONOS_DPARAM_RESIDU];
+  solver_options_delete(options);
+  free(options);
+  return info;
+}
+
+int main(void)
+{
+  int info = 0;
+  const char * files[4] = {"./data/FC3D_Example1_SBM.dat", "./data/Capsules-i122-1617.dat",
+                           "./data/Rover4144.dat", "./data/NESpheres_10_1.dat"
+                          };
+  int local_solvers[2] = {SICONOS_FRICTION_3D_ONECONTACT_NSN,
+                          SICONOS_FRICTION_3D_ONECONTACT_ProjectionOnCone
+                         };
+  int error_evaluations[2] = {SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT,
+                              SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT_WITH_FULL_FINAL
+                             };
+  for(int k = 0; k < 4; k++)
+  {
+    FrictionContactProblem * problem = frictionContact_new_from_filename(files[k]);
+    if(!problem)
+    {
+      printf("%s: cannot read the problem\n", files[k]);
+      return 1;
+    }
+    int size = 3 * problem->numberOfContacts;
+    double * reaction_ref = (double *)calloc(size, sizeof(double));
+    double * velocity_ref = (double *)calloc(size, sizeof(double));
+    double * reaction = (double *)calloc(size, sizeof(double));
+    double * velocity = (double *)calloc(size, sizeof(double));
+
+    for(int l = 0; l < 2; l++)
+      for(int shuffle = 0; shuffle < 2; shuffle++)
+        for(int relaxation = 0; relaxation < 2; relaxation++)
+          for(int e = 0; e < 2; e++)
+          {
+            int iter_ref = 0, iter = 0;
+            double error_ref = 0., error = 0.;
+            int info_ref = solve(problem, local_solvers[l], SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP_TRUE,
+                                 shuffle, relaxation, error_evaluations[e],
+                                 reaction_ref, velocity_ref, &iter_ref, &error_ref);
+            int info_k = solve(problem, local_solvers[l], SICONOS_FRICTION_3D_NSGS_GENERIC_LOOP_FALSE,
+                               shuffle, relaxation, error_evaluations[e],
+                               reaction, velocity, &iter, &error);
+            double diff = 0.;
+            for(int i = 0; i < size; i++)
+            {
+              if(fabs(reaction[i] - reaction_ref[i]) > diff)
+                diff = fabs(reaction[i] - reaction_ref[i]);
+              if(fabs(velocity[i] - velocity_ref[i]) > diff)
+                diff = fabs(velocity[i] - velocity_ref[i]);
+            }
+            if(info_k != info_ref || iter != iter_ref
+                || diff > 1e-12 || fabs(error - error_ref) > 1e-12)
+            {
+              printf("%s, local solver %i, shuffle %i, relaxation %i, error evaluation %i: "
+                     "info %i, iter %i, error %e instead of info %i, iter %i, error %e (diff = %e)\n",
+                     files[k], local_solvers[l], shuffle, relaxation, error_evaluations[e],
+                     info_k, iter, error, info_ref, iter_ref, error_ref, diff);
+              info++;
+            }
+          }
+    printf("%s: done\n", files[k]);
+    free(reaction_ref);
+    free(velocity_ref);
+    free(reaction);
+    free(velocity);
+    frictionContactProblem_free(problem);
+  }
+  printf("End of test, info = %i\n", info);
+  return info;
+}
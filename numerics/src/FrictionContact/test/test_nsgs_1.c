@@ -20,12 +20,13 @@
 #include "Friction_cst.h"                // for SICONOS_FRICTION_3D_ONECONTA...
 #include "NumericsFwd.h"                 // for SolverOptions
 #include "SolverOptions.h"               // for SolverOptions, solver_option...
+#include "fixed_point_acceleration.h"    // for SICONOS_FIXED_POINT_ACCELERA...
 #include "frictionContact_test_utils.h"  // for build_test_collection
 #include "test_utils.h"                  // for TestCase
 
 TestCase * build_test_collection(int n_data, const char ** data_collection, int* number_of_tests)
 {
-  int n_solvers = 5;
+  int n_solvers = 8;
   *number_of_tests = n_data * n_solvers;
   TestCase * collection = malloc((*number_of_tests) * sizeof(TestCase));
 
@@ -103,6 +104,42 @@ TestCase * build_test_collection(int n_data, const char ** data_collection, int*
     current++;
   }
 
+  // nsgs with shuffled contacts and relaxation, light error evaluation.
+  for(int d =0; d <n_data; d++)
+  {
+    collection[current].filename = data_collection[d];
+    collection[current].options = solver_options_create(topsolver);
+    collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-5;
+    collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_NSGS_SHUFFLE] = SICONOS_FRICTION_3D_NSGS_SHUFFLE_TRUE;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_NSGS_RELAXATION] = SICONOS_FRICTION_3D_NSGS_RELAXATION_TRUE;
+    collection[current].options->dparam[SICONOS_FRICTION_3D_NSGS_RELAXATION_VALUE] = 1.;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_IPARAM_ERROR_EVALUATION] = SICONOS_FRICTION_3D_NSGS_ERROR_EVALUATION_LIGHT;
+    current++;
+  }
+
+  // nsgs with first sweeps in single precision.
+  for(int d =0; d <n_data; d++)
+  {
+    collection[current].filename = data_collection[d];
+    collection[current].options = solver_options_create(topsolver);
+    collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-5;
+    collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION] = SICONOS_FRICTION_3D_NSGS_MIXED_PRECISION_TRUE;
+    current++;
+  }
+
+  // nsgs with Anderson acceleration of the outer loop.
+  for(int d =0; d <n_data; d++)
+  {
+    collection[current].filename = data_collection[d];
+    collection[current].options = solver_options_create(topsolver);
+    collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-5;
+    collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+    collection[current].options->iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION] = SICONOS_FIXED_POINT_ACCELERATION_ANDERSON;
+    current++;
+  }
+
   return collection;
 
 }
@@ -21,13 +21,14 @@
 #include "NumericsFwd.h"                 // for SolverOptions
 #include "SolverOptions.h"               // for solver_options_create, Solve...
 #include "VI_cst.h"                      // for SICONOS_VI_DPARAM_RHO, SICON...
+#include "fixed_point_acceleration.h"    // for SICONOS_FIXED_POINT_ACCELERA...
 #include "frictionContact_test_utils.h"  // for build_test_collection
 #include "test_utils.h"                  // for TestCase
 
 TestCase * build_test_collection(int n_data, const char ** data_collection, int* number_of_tests)
 {
 
-  *number_of_tests = 8; //n_data * n_solvers;
+  *number_of_tests = 12; //n_data * n_solvers;
   TestCase * collection = (TestCase*)malloc((*number_of_tests) * sizeof(TestCase));
 
   int current = 0;
@@ -70,6 +71,39 @@ TestCase * build_test_collection(int n_data, const char ** data_collection, int*
   collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
   current++;
 
+  // EG, rho = -1, Anderson acceleration
+  collection[current].filename = data_collection[d];
+  collection[current].options = solver_options_create(SICONOS_FRICTION_3D_EG);
+  collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-10;
+  collection[current].options->dparam[SICONOS_VI_DPARAM_RHO] = -1;
+  collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+  collection[current].options->iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION] = SICONOS_FIXED_POINT_ACCELERATION_ANDERSON;
+  current++;
+
+  // FPP, Nesterov acceleration
+  collection[current].filename = data_collection[d];
+  collection[current].options = solver_options_create(SICONOS_FRICTION_3D_FPP);
+  collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+  collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+  collection[current].options->iparam[SICONOS_FRICTION_3D_IPARAM_ACCELERATION] = SICONOS_FIXED_POINT_ACCELERATION_NESTEROV;
+  current++;
+
+  // VI FPP, SOR acceleration
+  collection[current].filename = data_collection[d];
+  collection[current].options = solver_options_create(SICONOS_FRICTION_3D_VI_FPP);
+  collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+  collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+  collection[current].options->iparam[SICONOS_VI_IPARAM_ACCELERATION] = SICONOS_FIXED_POINT_ACCELERATION_SOR;
+  current++;
+
+  // VI FPP, Anderson acceleration
+  collection[current].filename = data_collection[d];
+  collection[current].options = solver_options_create(SICONOS_FRICTION_3D_VI_FPP);
+  collection[current].options->dparam[SICONOS_DPARAM_TOL] = 1e-8;
+  collection[current].options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+  collection[current].options->iparam[SICONOS_VI_IPARAM_ACCELERATION] = SICONOS_FIXED_POINT_ACCELERATION_ANDERSON;
+  current++;
+
 
   // HP
   collection[current].filename = data_collection[d];
@@ -33,16 +33,19 @@
 #include "MLCP_Solvers.h"                       // for mixedLinearComplement...
 #include "MixedLinearComplementarityProblem.h"  // for MixedLinearComplement...
 #include "NonSmoothDrivers.h"                   // for linearComplementarity...
+#include "CSparseMatrix_internal.h"             // for CSparseMatrix, CS_INT
 #include "NumericsMatrix.h"                     // for NumericsMatrix, NM_fill
 #include "SolverOptions.h"                      // for SICONOS_NUMERICS_PROB...
 #include "SparseBlockMatrix.h"                  // for SparseBlockStructured...
 #include "lcp_cst.h"                            // for SICONOS_LCP_ENUM
 #include "mlcp_cst.h"                           // for SICONOS_MLCP_ENUM
+#include "numerics_verbose.h"                   // for numerics_printf_verbose
 #include "pinv.h"                               // for pinv
 
 void _GMPReducedEquality(GenericMechanicalProblem* pInProblem, double * reducedProb, double * Qreduced, int * Me_size, int* Mi_size);
 void _GMPReducedGetSizes(GenericMechanicalProblem* pInProblem, int * Me_size, int* Mi_size);
 void buildReducedGMP(GenericMechanicalProblem* pInProblem, double * Me, double * Mi, double * Qe, double * Qi, int * Me_Size, int* Mi_Size);
+GenericMechanicalProblem * _GMPReducedInequalities(GenericMechanicalProblem* pInProblem);
 
 #ifdef GMP_DEBUG_REDUCED
 static void printDenseMatrice(char* name, FILE * file, double * m, int N, int M)
@@ -117,6 +120,39 @@ void gmp_reduced_convert_solution(GenericMechanicalProblem* pInProblem, double *
     curProblem = curProblem->nextProblem;
   }
 }
+/* The GMP made of the inequality problems of pInProblem, without M and q */
+GenericMechanicalProblem * _GMPReducedInequalities(GenericMechanicalProblem* pInProblem)
+{
+  listNumericsProblem * curProblem = 0;
+  GenericMechanicalProblem * _pnumerics_GMP = genericMechanicalProblem_new();
+  curProblem =  pInProblem->firstListElem;
+  while(curProblem)
+  {
+    switch(curProblem->type)
+    {
+    case SICONOS_NUMERICS_PROBLEM_EQUALITY:
+    {
+      break;
+    }
+    case SICONOS_NUMERICS_PROBLEM_LCP:
+    {
+      gmp_add(_pnumerics_GMP, curProblem->type, curProblem->size);
+      break;
+    }
+    case SICONOS_NUMERICS_PROBLEM_FC3D:
+    {
+      FrictionContactProblem* pFC3D = (FrictionContactProblem*)gmp_add(_pnumerics_GMP, curProblem->type, curProblem->size);
+      *(pFC3D->mu) = *(((FrictionContactProblem*)curProblem->problem)->mu);
+      break;
+    }
+    default:
+      printf("GMPReduced  buildReducedGMP: problemType unknown: %d . \n", curProblem->type);
+    }
+    curProblem = curProblem->nextProblem;
+  }
+  return _pnumerics_GMP;
+}
+
 void _GMPReducedGetSizes(GenericMechanicalProblem* pInProblem, int * Me_size, int* Mi_size)
 {
   listNumericsProblem * curProblem = 0;
@@ -538,33 +574,7 @@ void gmp_reduced_solve(GenericMechanicalProblem* pInProblem, double *reaction, d
   fprintf(file, "_W=Mi2+_minusMi1pseduInvMe1*Me2;\n");
 
 #endif
-  listNumericsProblem * curProblem = 0;
-  GenericMechanicalProblem * _pnumerics_GMP = genericMechanicalProblem_new();
-  curProblem =  pInProblem->firstListElem;
-  while(curProblem)
-  {
-    switch(curProblem->type)
-    {
-    case SICONOS_NUMERICS_PROBLEM_EQUALITY:
-    {
-      break;
-    }
-    case SICONOS_NUMERICS_PROBLEM_LCP:
-    {
-      gmp_add(_pnumerics_GMP, curProblem->type, curProblem->size);
-      break;
-    }
-    case SICONOS_NUMERICS_PROBLEM_FC3D:
-    {
-      FrictionContactProblem* pFC3D = (FrictionContactProblem*)gmp_add(_pnumerics_GMP, curProblem->type, curProblem->size);
-      *(pFC3D->mu) = *(((FrictionContactProblem*)curProblem->problem)->mu);
-      break;
-    }
-    default:
-      printf("GMPReduced  buildReducedGMP: problemType unknown: %d . \n", curProblem->type);
-    }
-    curProblem = curProblem->nextProblem;
-  }
+  GenericMechanicalProblem * _pnumerics_GMP = _GMPReducedInequalities(pInProblem);
   NumericsMatrix numM;
   NM_null(&numM);
   numM.storageType = 0;
@@ -630,6 +640,170 @@ void gmp_reduced_solve(GenericMechanicalProblem* pInProblem, double *reaction, d
 
 }
 
+/*
+ * The equalities are eliminated as in gmp_reduced_solve, but M is kept in
+ * sparse storage and Me_1 is factorized with the sparse LU backend. Only
+ * the columns of Me_2 that are not empty are needed for the coupling
+ * Mi_1 Me_1^{-1} Me_2, and only the reduced matrix of the inequalities is
+ * dense.
+ */
+void gmp_reduced_sparse_solve(GenericMechanicalProblem* pInProblem, double *reaction, double *velocity, int * info, SolverOptions* options)
+{
+  int Me_size;
+  int Mi_size;
+  _GMPReducedGetSizes(pInProblem, &Me_size, &Mi_size);
+  if((Me_size == 0 || Mi_size == 0))
+  {
+    gmp_gauss_seidel(pInProblem, reaction, velocity, info, options);
+    return;
+  }
+  int nbRow = Me_size + Mi_size;
+
+  /* Position of each row in the equalities (>= 0) or in the inequalities (< 0) */
+  int * newIndex = (int *) malloc(nbRow * sizeof(int));
+  double *Qe = (double *) malloc(Me_size * sizeof(double));
+  double *Qi = (double *) malloc(Mi_size * sizeof(double));
+  int curRowE = 0;
+  int curRowI = 0;
+  int curRow = 0;
+  listNumericsProblem * curProblem =  pInProblem->firstListElem;
+  while(curProblem)
+  {
+    for(int i = 0; i < curProblem->size; i++, curRow++)
+    {
+      if(curProblem->type == SICONOS_NUMERICS_PROBLEM_EQUALITY)
+      {
+        Qe[curRowE] = pInProblem->q[curRow];
+        newIndex[curRow] = curRowE++;
+      }
+      else
+      {
+        Qi[curRowI] = pInProblem->q[curRow];
+        newIndex[curRow] = -(++curRowI);
+      }
+    }
+    curProblem = curProblem->nextProblem;
+  }
+
+  /* Split M in the four blocks, the reduced matrix starts with Mi_2 */
+  CSparseMatrix* Mcsc = NM_csc(pInProblem->M);
+  CS_INT nnzMe1 = 0, nnzMe2 = 0, nnzMi1 = 0;
+  for(int j = 0; j < nbRow; j++)
+  {
+    for(CS_INT p = Mcsc->p[j]; p < Mcsc->p[j+1]; p++)
+    {
+      int i = newIndex[Mcsc->i[p]];
+      if(newIndex[j] >= 0)
+      {
+        if(i >= 0) nnzMe1++;
+        else nnzMi1++;
+      }
+      else if(i >= 0) nnzMe2++;
+    }
+  }
+  NumericsMatrix * Me1 = NM_create(NM_SPARSE, Me_size, Me_size);
+  NumericsMatrix * Me2 = NM_create(NM_SPARSE, Me_size, Mi_size);
+  NumericsMatrix * Mi1 = NM_create(NM_SPARSE, Mi_size, Me_size);
+  NM_triplet_alloc(Me1, nnzMe1);
+  NM_triplet_alloc(Me2, nnzMe2);
+  NM_triplet_alloc(Mi1, nnzMi1);
+  /* The reduced matrix of the inequalities, W = Mi_2 - Mi_1 Me_1^{-1} Me_2,
+     stays dense: it is the matrix of the GMP solved by gmp_gauss_seidel
+     below, and Me_1^{-1} Me_2 fills it in. */
+  double * Wdense = (double *)calloc(Mi_size * Mi_size, sizeof(double));
+  for(int j = 0; j < nbRow; j++)
+  {
+    int jj = newIndex[j];
+    for(CS_INT p = Mcsc->p[j]; p < Mcsc->p[j+1]; p++)
+    {
+      int ii = newIndex[Mcsc->i[p]];
+      double x = Mcsc->x[p];
+      if(jj >= 0)
+      {
+        if(ii >= 0) NM_zentry(Me1, ii, jj, x, 0.);
+        else NM_zentry(Mi1, -ii - 1, jj, x, 0.);
+      }
+      else
+      {
+        if(ii >= 0) NM_zentry(Me2, ii, -jj - 1, x, 0.);
+        else Wdense[(-ii - 1) + (-jj - 1) * Mi_size] += x;
+      }
+    }
+  }
+  free(newIndex);
+
+  if(NM_LU_factorize(Me1))
+  {
+    numerics_printf_verbose(1, "gmp_reduced_sparse_solve: the equality block is singular, switch to gmp_reduced_solve");
+    NM_free(Me1);
+    NM_free(Me2);
+    NM_free(Mi1);
+    free(Wdense);
+    free(Qe);
+    free(Qi);
+    gmp_reduced_solve(pInProblem, reaction, velocity, info, options);
+    return;
+  }
+
+  /* W = Mi_2 - Mi_1 Me_1^{-1} Me_2, column by column */
+  double * col = (double *) malloc(Me_size * sizeof(double));
+  CSparseMatrix* Me2csc = NM_csc(Me2);
+  for(int j = 0; j < Mi_size; j++)
+  {
+    if(Me2csc->p[j] == Me2csc->p[j+1]) continue;
+    memset(col, 0, Me_size * sizeof(double));
+    for(CS_INT p = Me2csc->p[j]; p < Me2csc->p[j+1]; p++)
+      col[Me2csc->i[p]] += Me2csc->x[p];
+    NM_LU_solve(Me1, col, 1);
+    NM_gemv(-1.0, Mi1, col, 1.0, Wdense + j * Mi_size);
+  }
+
+  /* Qi = Qi - Mi_1 Me_1^{-1} Qe */
+  memcpy(col, Qe, Me_size * sizeof(double));
+  NM_LU_solve(Me1, col, 1);
+  NM_gemv(-1.0, Mi1, col, 1.0, Qi);
+
+  GenericMechanicalProblem * _pnumerics_GMP = _GMPReducedInequalities(pInProblem);
+  NumericsMatrix numM;
+  NM_null(&numM);
+  numM.storageType = 0;
+  numM.matrix0 = Wdense;
+  numM.matrix1 = 0;
+  numM.size0 = Mi_size;
+  numM.size1 = Mi_size;
+  _pnumerics_GMP->M = &numM;
+  _pnumerics_GMP->q = Qi;
+  double *Rreduced = (double *) malloc(Mi_size * sizeof(double));
+  double *Vreduced = (double *) malloc(Mi_size * sizeof(double));
+  gmp_gauss_seidel(_pnumerics_GMP, Rreduced, Vreduced, info, options);
+  if(!*info)
+  {
+    /* Re = -Me_1^{-1}(Me_2 Ri + Qe) */
+    memcpy(col, Qe, Me_size * sizeof(double));
+    NM_gemv(1.0, Me2, Rreduced, 1.0, col);
+    NM_LU_solve(Me1, col, 1);
+    cblas_dscal(Me_size, -1.0, col, 1);
+    gmp_reduced_convert_solution(pInProblem, reaction, velocity, col, Rreduced, Vreduced);
+    double err;
+    int tolViolate = gmp_compute_error(pInProblem, reaction, velocity, options->dparam[SICONOS_DPARAM_TOL], options, &err);
+    if(tolViolate)
+    {
+      printf("GMPReducedSparse, warning, reduced problem solved, but error of initial probleme violated tol = %e, err= %e\n", options->dparam[SICONOS_DPARAM_TOL], err);
+    }
+  }
+
+  free(Rreduced);
+  free(Vreduced);
+  genericMechanicalProblem_free(_pnumerics_GMP, NUMERICS_GMP_FREE_GMP);
+  NM_free(Me1);
+  NM_free(Me2);
+  NM_free(Mi1);
+  free(col);
+  free(Wdense);
+  free(Qe);
+  free(Qi);
+}
+
 void _GMPReducedEquality(GenericMechanicalProblem* pInProblem, double * reducedProb, double * Qreduced, int * Me_size, int* Mi_size)
 {
 
@@ -35,6 +35,13 @@
  */
 void gmp_reduced_solve(GenericMechanicalProblem* pInProblem, double *reaction , double *velocity, int* info, SolverOptions* options);
 
+/* The equalities are eliminated as in gmp_reduced_solve, with M kept in
+ * sparse storage: Me_1 is factorized with the sparse LU backend and only
+ * the non empty columns of Me_2 are used to form Mi_1 Me_1^{-1} Me_2.
+ * If Me_1 is singular, gmp_reduced_solve is used.
+ */
+void gmp_reduced_sparse_solve(GenericMechanicalProblem* pInProblem, double *reaction , double *velocity, int* info, SolverOptions* options);
+
 /*  The equalities are assembled in an single block.
  *
  * 0=(Me_1 Me_2)(Re Ri)' + Qe
@@ -36,6 +36,12 @@ enum GENERIC_MECHANICAL_SOLVER
 enum GENERIC_MECHANICAL_IPARAM
   {
    SICONOS_GENERIC_MECHANICAL_IPARAM_ISREDUCED = 2,
+   /** 1 to solve independently the connected components of the graph of the blocks
+       (sparse block storage only), 0 (default) for a single Gauss-Seidel loop */
+   SICONOS_GENERIC_MECHANICAL_IPARAM_CONNECTED_COMPONENTS = 7,
+   /** number of threads used to solve the connected components
+       (needs OpenMP, 0 or 1 for the serial one, negative for the OpenMP default) */
+   SICONOS_GENERIC_MECHANICAL_IPARAM_NUMBER_OF_THREADS = 8,
    SICONOS_GENERIC_MECHANICAL_IPARAM_WITH_LINESEARCH = 19,
   };
 
@@ -52,6 +58,7 @@ enum GENERIC_MECHANICAL_ISREDUCED
    SICONOS_GENERIC_MECHANICAL_SUBS_EQUALITIES = 1, // The equalities are substituated
    SICONOS_GENERIC_MECHANICAL_ASSEMBLE_EQUALITIES = 2, // Equalities are assemblated in one block
    SICONOS_GENERIC_MECHANICAL_MLCP_LIKE = 3, // Try to solve like a MLCP (==> No FC3d)
+   SICONOS_GENERIC_MECHANICAL_SUBS_EQUALITIES_SPARSE = 4, // The equalities are substituated, with sparse storage
   };
 
 extern const char* const  SICONOS_GENERIC_MECHANICAL_NSGS_STR;
@@ -43,6 +43,10 @@
 #include "lcp_cst.h"                       // for SICONOS_LCP_LEMKE
 #include "numerics_verbose.h"              // for verbose
 #include "relay_cst.h"                     // for SICONOS_RELAY_LEMKE
+#include "SparseBlockMatrix.h"             // for SparseBlockStructuredMatrix
+#ifdef _OPENMP
+#include <omp.h>                           // for omp_get_max_threads
+#endif
 
 /* #define DEBUG_NOCOLOR */
 /* #define DEBUG_STDOUT */
@@ -55,61 +59,141 @@
 
 const char* const   SICONOS_GENERIC_MECHANICAL_NSGS_STR = "GMP_NSGS";
 
-int gmp_compute_error(GenericMechanicalProblem* pGMP, double *reaction, double *velocity, double tol, SolverOptions* options, double * err)
+/* Velocity of the block currentRowNumber, V = M R + Q. The local q of the
+ * block, without the diagonal product, is stored in curProblem->q. */
+static void gmp_compute_local_velocity(GenericMechanicalProblem* pGMP, listNumericsProblem * curProblem,
+                                       int currentRowNumber, int posInX, double *reaction, double *velocity,
+                                       double * bufForLocalProblemDense)
 {
-  listNumericsProblem * curProblem = pGMP->firstListElem;
-  NM_types storageType = pGMP->M->storageType;
   NumericsMatrix* numMat = pGMP->M;
-  int currentRowNumber = 0;
-  int ii;
-  int  posInX = 0;
-  int curSize = 0;
-  *err = 0.0;
-  double localError = 0;
-  double * bufForLocalProblemDense = (storageType == NM_DENSE) ? (double*) malloc(pGMP->maxLocalSize * pGMP->maxLocalSize * sizeof(double)) : 0;
+  int curSize = curProblem->size;
 
+  /*localproblem->q <-- GMP->q */
+  memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
 #ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
-  numerics_printf("GenericMechanical compute_error BEGIN:\n");
+  printDenseMatrice("q", 0, curProblem->q, curSize, 1);
+  printDenseMatrice("reaction", 0, reaction, pGMP->size, 1);
 #endif
-  /*update localProblem->q and compute V = M*R+Q of the GMP */
-  posInX = 0;
-  while(curProblem)
-  {
-    curSize = curProblem->size;
+  /*computation of the localproblem->q*/
+  NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, curProblem->q, NULL, 0);
+#ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
+  printDenseMatrice("qnodiag", 0, curProblem->q, curSize, 1);
+#endif
+  /*computation of the velocity of the GMP*/
+  memcpy(velocity + posInX, curProblem->q, curSize * sizeof(double));
+  /*add the missing product to the velocity: the diagonal one*/
 
-    /*localproblem->q <-- GMP->q */
-    memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
+  double * diagBlock = 0;
+  if(numMat->storageType == NM_DENSE)  /*dense*/
+  {
+    NM_extract_diag_block(numMat, currentRowNumber, posInX, curSize, &bufForLocalProblemDense);
+    diagBlock = bufForLocalProblemDense;
+  }
+  else
+  {
+    NM_extract_diag_block(numMat, currentRowNumber, posInX, curSize, &diagBlock);
+  }
 #ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
-    printDenseMatrice("q", 0, curProblem->q, curSize, 1);
-    printDenseMatrice("reaction", 0, reaction, pGMP->size, 1);
+  printDenseMatrice("diagBlock", 0, diagBlock, curSize, curSize);
+  printDenseMatrice("Rlocal", 0, reaction + posInX, curSize, 1);
 #endif
-    /*computation of the localproblem->q*/
-    NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, curProblem->q, NULL, 0);
+  cblas_dgemv(CblasColMajor,CblasNoTrans, curSize, curSize, 1.0, diagBlock, curSize, reaction + posInX, 1, 1.0, velocity + posInX, 1);
 #ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
-    printDenseMatrice("qnodiag", 0, curProblem->q, curSize, 1);
+  printDenseMatrice("velocity", 0, velocity + posInX, curSize, 1);
 #endif
-    /*computation of the velocity of the GMP*/
-    memcpy(velocity + posInX, curProblem->q, curSize * sizeof(double));
-    /*add the missing product to the velocity: the diagonal one*/
+}
 
-    double * diagBlock = 0;
-    if(storageType == NM_DENSE)  /*dense*/
-    {
-      NM_extract_diag_block(numMat, currentRowNumber, posInX, curSize, &bufForLocalProblemDense);
-      diagBlock = bufForLocalProblemDense;
-    }
-    else
+/* Error of one block, once its velocity has been computed. A negative value
+ * means that the reaction or the velocity is not a number. */
+static double gmp_compute_local_error(listNumericsProblem * curProblem, double *reaction, double *velocity,
+                                      SolverOptions* options)
+{
+  int curSize = curProblem->size;
+  int ii;
+  double localError = 0.;
+  for(ii = 0; ii < curSize; ii++)
+    if(isnan(velocity[ii]) || isnan(reaction[ii]))
+      return -1.;
+  switch(curProblem->type)
+  {
+  case SICONOS_NUMERICS_PROBLEM_EQUALITY:
+  {
+    for(ii = 0; ii < curSize; ii++)
     {
-      NM_extract_diag_block(numMat, currentRowNumber, posInX, curSize, &diagBlock);
+      if(fabs(velocity[ii]) > localError)
+        localError = fabs(velocity[ii]);
     }
 #ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
-    printDenseMatrice("diagBlock", 0, diagBlock, curSize, curSize);
-    printDenseMatrice("Rlocal", 0, reaction + posInX, curSize, 1);
+    numerics_printf("GenericMechanical_driver, localerror of linearSystem: %e\n", localError);
 #endif
-    cblas_dgemv(CblasColMajor,CblasNoTrans, curSize, curSize, 1.0, diagBlock, curSize, reaction + posInX, 1, 1.0, velocity + posInX, 1);
+    break;
+  }
+  case SICONOS_NUMERICS_PROBLEM_LCP:
+  {
+    lcp_compute_error_only(curSize, reaction, velocity, &localError);
+    localError = localError / (1 + cblas_dnrm2(curSize, curProblem->q, 1));
+#ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
+    numerics_printf("GenericMechanical_driver, localerror of lcp: %e\n", localError);
+#endif
+    break;
+  }
+  case SICONOS_NUMERICS_PROBLEM_RELAY:
+  {
+    relay_compute_error((RelayProblem*) curProblem->problem,
+                        reaction, velocity,
+                        options->dparam[SICONOS_DPARAM_TOL], &localError);
+
+    localError = localError / (1 + cblas_dnrm2(curSize, curProblem->q, 1));
+#ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
+    numerics_printf("GenericMechanical_driver, localerror of lcp: %e\n", localError);
+#endif
+    break;
+  }
+  case SICONOS_NUMERICS_PROBLEM_FC2D:
+  {
+    FrictionContactProblem * fcProblem = (FrictionContactProblem *)curProblem->problem;
+    double worktmp[2];
+    fc2d_unitary_compute_and_add_error(reaction, velocity, fcProblem->mu[0], &localError, worktmp);
+    localError = sqrt(localError) / (1 + cblas_dnrm2(curSize, curProblem->q, 1));
+#ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
+    numerics_printf("GenericMechanical_driver FC2D, Local Velocity v_n=%e v_t1=%e localerror=%e\n", *(velocity), *(velocity + 1),  localError);
+#endif
+    break;
+  }
+  case SICONOS_NUMERICS_PROBLEM_FC3D:
+  {
+    FrictionContactProblem * fcProblem = (FrictionContactProblem *)curProblem->problem;
+    double worktmp[3];
+    fc3d_unitary_compute_and_add_error(reaction, velocity, fcProblem->mu[0], &localError, worktmp);
+    localError = sqrt(localError) / (1 + cblas_dnrm2(curSize, curProblem->q, 1));
+#ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
+    numerics_printf("GenericMechanical_driver FC3D, Local Velocity v_n=%e v_t1=%e v_t2=%e localerror=%e\n", *(velocity), *(velocity + 1), *(velocity + 2), localError);
+#endif
+    break;
+  }
+  default:
+    numerics_printf("Numerics : gmp_gauss_seidel unknown problem type %d.\n", curProblem->type);
+  }
+  return localError;
+}
+
+int gmp_compute_error(GenericMechanicalProblem* pGMP, double *reaction, double *velocity, double tol, SolverOptions* options, double * err)
+{
+  listNumericsProblem * curProblem = pGMP->firstListElem;
+  NM_types storageType = pGMP->M->storageType;
+  int currentRowNumber = 0;
+  int  posInX = 0;
+  *err = 0.0;
+  double localError = 0;
+  double * bufForLocalProblemDense = (storageType == NM_DENSE) ? (double*) malloc(pGMP->maxLocalSize * pGMP->maxLocalSize * sizeof(double)) : 0;
+
 #ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
-    printDenseMatrice("velocity", 0, velocity + posInX, curSize, 1);
+  numerics_printf("GenericMechanical compute_error BEGIN:\n");
 #endif
+  /*update localProblem->q and compute V = M*R+Q of the GMP */
+  while(curProblem)
+  {
+    gmp_compute_local_velocity(pGMP, curProblem, currentRowNumber, posInX, reaction, velocity, bufForLocalProblemDense);
     /*next*/
     posInX += curProblem->size;
     curProblem = curProblem->nextProblem;
@@ -123,92 +207,16 @@ int gmp_compute_error(GenericMechanicalProblem* pGMP, double *reaction, double *
   curProblem = pGMP->firstListElem;
   while(curProblem)
   {
-    curSize = curProblem->size;
-    double * Vl = velocity + posInX;
-    double * Rl = reaction + posInX;
-    for(ii = 0; ii < curSize; ii++)
-      if(isnan(Vl[ii]) || isnan(Rl[ii]))
-      {
-        *err = 10;
-        return 1;
-      }
-    switch(curProblem->type)
+    localError = gmp_compute_local_error(curProblem, reaction + posInX, velocity + posInX, options);
+    if(localError < 0.)
     {
-    case SICONOS_NUMERICS_PROBLEM_EQUALITY:
-    {
-      double * w = velocity + posInX;
-      localError = 0.;
-      for(ii = 0; ii < curSize; ii++)
-      {
-        if(fabs(w[ii]) > *err)
-          *err = fabs(w[ii]);
-        if(fabs(w[ii]) > localError)
-          localError = *err;
-
-      }
-#ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
-      numerics_printf("GenericMechanical_driver, localerror of linearSystem: %e\n", localError);
-#endif
-      break;
-    }
-    case SICONOS_NUMERICS_PROBLEM_LCP:
-    {
-      //LinearComplementarityProblem* lcpproblem = (LinearComplementarityProblem*) curProblem->problem;
-
-      lcp_compute_error_only(curSize, reaction + posInX, velocity + posInX, &localError);
-      localError = localError / (1 + cblas_dnrm2(curSize, curProblem->q, 1));
-      if(localError > *err)
-        *err = localError ;
-#ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
-      numerics_printf("GenericMechanical_driver, localerror of lcp: %e\n", localError);
-#endif
-      break;
-    }
-    case SICONOS_NUMERICS_PROBLEM_RELAY:
-    {
-      relay_compute_error((RelayProblem*) curProblem->problem,
-                          reaction + posInX, velocity + posInX,
-                          options->dparam[SICONOS_DPARAM_TOL], &localError);
-
-      localError = localError / (1 + cblas_dnrm2(curSize, curProblem->q, 1));
-      if(localError > *err)
-        *err = localError ;
-#ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
-      numerics_printf("GenericMechanical_driver, localerror of lcp: %e\n", localError);
-#endif
-      break;
-    }
-    case SICONOS_NUMERICS_PROBLEM_FC2D:
-    {
-      FrictionContactProblem * fcProblem = (FrictionContactProblem *)curProblem->problem;
-      localError = 0.;
-      double worktmp[2];
-      fc2d_unitary_compute_and_add_error(reaction + posInX, velocity + posInX, fcProblem->mu[0], &localError, worktmp);
-      localError = sqrt(localError) / (1 + cblas_dnrm2(curSize, curProblem->q, 1));
-      if(localError > *err)
-        *err = localError ;
-#ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
-      numerics_printf("GenericMechanical_driver FC2D, Local Velocity v_n=%e v_t1=%e v_t2=%e localerror=%e\n", *(velocity + posInX), *(velocity + posInX + 1),  localError);
-#endif
-      break;
-    }
-    case SICONOS_NUMERICS_PROBLEM_FC3D:
-    {
-      FrictionContactProblem * fcProblem = (FrictionContactProblem *)curProblem->problem;
-      localError = 0.;
-      double worktmp[3];
-      fc3d_unitary_compute_and_add_error(reaction + posInX, velocity + posInX, fcProblem->mu[0], &localError, worktmp);
-      localError = sqrt(localError) / (1 + cblas_dnrm2(curSize, curProblem->q, 1));
-      if(localError > *err)
-        *err = localError ;
-#ifdef GENERICMECHANICAL_DEBUG_COMPUTE_ERROR
-      numerics_printf("GenericMechanical_driver FC3D, Local Velocity v_n=%e v_t1=%e v_t2=%e localerror=%e\n", *(velocity + posInX), *(velocity + posInX + 1), *(velocity + posInX + 2), localError);
-#endif
-      break;
-    }
-    default:
-      numerics_printf("Numerics : gmp_gauss_seidel unknown problem type %d.\n", curProblem->type);
+      *err = 10;
+      if(storageType == NM_DENSE)
+        free(bufForLocalProblemDense);
+      return 1;
     }
+    if(localError > *err)
+      *err = localError ;
     /*next*/
     posInX += curProblem->size;
     curProblem = curProblem->nextProblem;
@@ -228,6 +236,347 @@ int gmp_compute_error(GenericMechanicalProblem* pGMP, double *reaction, double *
   else
     return 0;
 }
+
+/* Solve the local problem of the block currentRowNumber, the other blocks of
+ * reaction being fixed. Return the status of the local solver. */
+static int gmp_solve_local_problem(GenericMechanicalProblem* pGMP, listNumericsProblem * curProblem,
+                                   int currentRowNumber, int posInX, double * reaction, double * velocity,
+                                   SolverOptions** internalSolvers, double * bufForLocalProblemDense)
+{
+  NumericsMatrix* numMat = pGMP->M;
+  size_t curSize = curProblem->size;
+  int resLocalSolver = 0;
+  /*about the diagonal block:*/
+  double * diagBlock = 0;
+  if(numMat->storageType == NM_DENSE)  /*dense*/
+  {
+    NM_extract_diag_block(numMat, currentRowNumber, posInX, curSize, &bufForLocalProblemDense);
+    diagBlock = bufForLocalProblemDense;
+  }
+  else
+  {
+    NM_extract_diag_block(numMat, currentRowNumber, posInX, curSize, &diagBlock);
+
+  }
+
+  double * sol = reaction + posInX;
+  double * w = velocity + posInX;
+
+  switch(curProblem->type)
+  {
+  case SICONOS_NUMERICS_PROBLEM_EQUALITY:
+  {
+    numerics_printf_verbose(1, "solve SICONOS_NUMERICS_PROBLEM_EQUALITY");
+    NumericsMatrix M;
+    NM_fill(&M, NM_DENSE, curSize, curSize, diagBlock);
+
+    memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
+    NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, curProblem->q, NULL, 0);
+    for(size_t i = 0; i < curSize; ++i) sol[i] = -curProblem->q[i];
+
+    // resLocalSolver = NM_gesv(&M, sol, true);
+    resLocalSolver = NM_LU_solve(NM_preserve(&M), sol, 1);
+
+    M.matrix0 = NULL;
+    NM_clear(&M);
+    break;
+  }
+  case SICONOS_NUMERICS_PROBLEM_LCP:
+  {
+    numerics_printf_verbose(1, "solve SICONOS_NUMERICS_PROBLEM_LCP");
+    /*Mz*/
+    LinearComplementarityProblem* lcpProblem = (LinearComplementarityProblem*) curProblem->problem;
+    lcpProblem->M->matrix0 = diagBlock;
+    /*about q.*/
+    memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
+    NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, lcpProblem->q, NULL, 0);
+    resLocalSolver = linearComplementarity_driver(lcpProblem, sol, w, internalSolvers[0]);
+    break;
+  }
+  case SICONOS_NUMERICS_PROBLEM_RELAY:
+  {
+    numerics_printf_verbose(1, "solve SICONOS_NUMERICS_PROBLEM_RELAY");
+    /*Mz*/
+    RelayProblem* relayProblem = (RelayProblem*) curProblem->problem;
+    relayProblem->M->matrix0 = diagBlock;
+    /*about q.*/
+    memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
+    NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, relayProblem->q, NULL, 0);
+    resLocalSolver = relay_driver(relayProblem, sol, w, internalSolvers[2]);
+    break;
+  }
+  case SICONOS_NUMERICS_PROBLEM_FC3D:
+  {
+    numerics_printf_verbose(1, "solve SICONOS_NUMERICS_PROBLEM_FC3D");
+    FrictionContactProblem * fcProblem = (FrictionContactProblem *)curProblem->problem;
+    assert(fcProblem);
+    assert(fcProblem->M);
+    assert(fcProblem->q);
+    fcProblem->M->matrix0 = diagBlock;
+    memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
+
+    DEBUG_EXPR_WE(
+      NV_display(curProblem->q,3);
+      for(int i =0 ; i < 3; i++)
+        numerics_printf("curProblem->q[%i]= %12.8e,\t fcProblem->q[%i]= %12.8e,\n",i,curProblem->q[i],i,fcProblem->q[i]);
+      );
+
+    NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, fcProblem->q, NULL, 0);
+
+    DEBUG_EXPR_WE(
+      for(int i =0 ; i < 3; i++)
+        numerics_printf("reaction[%i]= %12.8e,\t fcProblem->q[%i]= %12.8e,\n",
+                        i,reaction[i],i,fcProblem->q[i]);
+      );
+
+    /* We call the generic driver (rather than the specific) since we may choose between various local solvers */
+    resLocalSolver = fc3d_driver(fcProblem, sol, w, internalSolvers[1]);
+    //resLocalSolver=fc3d_unitary_enumerative_solve(fcProblem,sol,&internalSolvers[1]);
+    break;
+  }
+  case SICONOS_NUMERICS_PROBLEM_FC2D:
+  {
+    numerics_printf_verbose(1, "solve SICONOS_NUMERICS_PROBLEM_FC2D");
+    FrictionContactProblem * fcProblem = (FrictionContactProblem *)curProblem->problem;
+    assert(fcProblem);
+    assert(fcProblem->M);
+    assert(fcProblem->q);
+    fcProblem->M->matrix0 = diagBlock;
+    memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
+
+    DEBUG_EXPR_WE(
+      NV_display(curProblem->q,2);
+      for(int i =0 ; i < 2; i++)
+        numerics_printf("curProblem->q[%i]= %12.8e,\t fcProblem->q[%i]= %12.8e,\n",i,curProblem->q[i],i,fcProblem->q[i]);
+      );
+
+    NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, fcProblem->q, NULL, 0);
+
+    DEBUG_EXPR_WE(
+      for(int i =0 ; i < 2; i++)
+        numerics_printf("reaction[%i]= %12.8e,\t fcProblem->q[%i]= %12.8e,\n",i,reaction[i],i,fcProblem->q[i]);
+      );
+
+    /* We call the generic driver (rather than the specific) since we may choose between various local solvers */
+    resLocalSolver = fc2d_driver(fcProblem, sol, w, internalSolvers[3]);
+    //resLocalSolver=fc3d_unitary_enumerative_solve(fcProblem,sol,&internalSolvers[1]);
+    break;
+  }
+  default:
+    numerics_printf("genericMechanical_GS Numerics : gmp_gauss_seidel unknown problem type %d.\n", curProblem->type);
+  }
+  return resLocalSolver;
+}
+
+static int gmp_find_root(int * parent, int i)
+{
+  while(parent[i] != i)
+  {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+/* Gauss-Seidel loop restricted to the blocks rows[0..nb-1] of one connected
+ * component, until its own error is below the tolerance. */
+static int gmp_gauss_seidel_component(GenericMechanicalProblem* pGMP, listNumericsProblem ** blocks,
+                                      int * positions, int * rows, int nb,
+                                      double * reaction, double * velocity, SolverOptions* options,
+                                      SolverOptions** internalSolvers, double * err, int * iter,
+                                      int * local_solver_error_occurred)
+{
+  int iterMax = options->iparam[SICONOS_IPARAM_MAX_ITER];
+  double tol = options->dparam[SICONOS_DPARAM_TOL];
+  int it = 0;
+  int tolViolate = 1;
+  double localError = 0.;
+  *err = 0.;
+  while(it < iterMax && tolViolate)
+  {
+    for(int k = 0; k < nb; k++)
+    {
+      int row = rows[k];
+      blocks[row]->error = 0;
+      if(gmp_solve_local_problem(pGMP, blocks[row], row, positions[row], reaction, velocity,
+                                 internalSolvers, NULL))
+      {
+        blocks[row]->error = 1;
+        *local_solver_error_occurred = 1;
+      }
+    }
+    /*compute the error of the component.*/
+    *err = 0.;
+    for(int k = 0; k < nb; k++)
+      gmp_compute_local_velocity(pGMP, blocks[rows[k]], rows[k], positions[rows[k]], reaction, velocity, NULL);
+    for(int k = 0; k < nb; k++)
+    {
+      int row = rows[k];
+      localError = gmp_compute_local_error(blocks[row], reaction + positions[row], velocity + positions[row], options);
+      if(localError < 0.)
+      {
+        *err = 10;
+        break;
+      }
+      if(localError > *err)
+        *err = localError;
+    }
+    tolViolate = (*err > tol);
+    it++;
+  }
+  *iter = it;
+  return tolViolate;
+}
+
+/* Gauss-Seidel on the connected components of the graph of the blocks: two
+ * blocks are connected if the block of M at their intersection is not null.
+ * The components are decoupled, they are solved one by one (or concurrently
+ * with OpenMP), each one with its own stopping criterion. */
+static void gmp_gauss_seidel_components(GenericMechanicalProblem* pGMP, double * reaction, double * velocity, int * info,
+                                        SolverOptions* options)
+{
+  SparseBlockStructuredMatrix* M = pGMP->M->matrix1;
+  int nbBlocks = (int) M->blocknumber0;
+  listNumericsProblem ** blocks = (listNumericsProblem **) malloc(nbBlocks * sizeof(listNumericsProblem *));
+  int * positions = (int *) malloc(nbBlocks * sizeof(int));
+  int * parent = (int *) malloc(nbBlocks * sizeof(int));
+  int * rows = (int *) malloc(nbBlocks * sizeof(int));
+  int * componentStart = (int *) calloc(nbBlocks + 1, sizeof(int));
+  int nbComponents = 0;
+
+  listNumericsProblem * curProblem = pGMP->firstListElem;
+  int posInX = 0;
+  for(int row = 0; row < nbBlocks; row++)
+  {
+    assert(curProblem);
+    blocks[row] = curProblem;
+    positions[row] = posInX;
+    parent[row] = row;
+    posInX += curProblem->size;
+    curProblem = curProblem->nextProblem;
+  }
+
+  /* union-find on the non null blocks */
+  for(int row = 0; row < nbBlocks; row++)
+  {
+    for(size_t k = M->index1_data[row]; k < M->index1_data[row + 1]; k++)
+    {
+      int rootRow = gmp_find_root(parent, row);
+      int rootCol = gmp_find_root(parent, (int) M->index2_data[k]);
+      if(rootRow < rootCol)
+        parent[rootCol] = rootRow;
+      else if(rootCol < rootRow)
+        parent[rootRow] = rootCol;
+    }
+  }
+
+  /* number the components, the roots are their smallest rows, and sort the
+     rows by component. The order of the rows is kept inside a component. */
+  for(int row = 0; row < nbBlocks; row++)
+    parent[row] = gmp_find_root(parent, row);
+  for(int row = 0; row < nbBlocks; row++)
+  {
+    int root = parent[row];
+    if(root == row)
+      parent[row] = -(++nbComponents);
+    else
+      parent[row] = parent[root];
+    componentStart[-parent[row]]++;
+  }
+  for(int c = 0; c < nbComponents; c++)
+    componentStart[c + 1] += componentStart[c];
+  for(int row = nbBlocks - 1; row >= 0; row--)
+    rows[--componentStart[-parent[row]]] = row;
+  /* componentStart[c+1] is now the first row of the component c */
+  memmove(componentStart, componentStart + 1, nbComponents * sizeof(int));
+  componentStart[nbComponents] = nbBlocks;
+  numerics_printf_verbose(1, "gmp_gauss_seidel: %d blocks in %d connected components", nbBlocks, nbComponents);
+
+  double * componentError = (double *) malloc(nbComponents * sizeof(double));
+  int * componentIter = (int *) malloc(nbComponents * sizeof(int));
+  int * componentInfo = (int *) malloc(nbComponents * sizeof(int));
+  int * componentLocalError = (int *) calloc(nbComponents, sizeof(int));
+
+  /* the indices of the diagonal blocks are computed on the first call */
+  SBM_diagonal_block_indices(M);
+
+#ifdef _OPENMP
+  int n_threads = options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_NUMBER_OF_THREADS];
+  if(n_threads < 0)
+    n_threads = omp_get_max_threads();
+  if(n_threads < 1)
+    n_threads = 1;
+  #pragma omp parallel num_threads(n_threads) if(n_threads > 1)
+#endif
+  {
+    SolverOptions ** internalSolvers = options->internalSolvers;
+#ifdef _OPENMP
+    /* the local solvers have their own working memory */
+    if(n_threads > 1)
+    {
+      internalSolvers = (SolverOptions **) malloc(options->numberOfInternalSolvers * sizeof(SolverOptions *));
+      for(size_t i = 0; i < options->numberOfInternalSolvers; i++)
+        internalSolvers[i] = solver_options_copy(options->internalSolvers[i]);
+    }
+#endif
+    #pragma omp for schedule(dynamic, 1)
+    for(int c = 0; c < nbComponents; c++)
+    {
+      componentInfo[c] = gmp_gauss_seidel_component(pGMP, blocks, positions, rows + componentStart[c],
+                                                    componentStart[c + 1] - componentStart[c],
+                                                    reaction, velocity, options, internalSolvers,
+                                                    &componentError[c], &componentIter[c],
+                                                    &componentLocalError[c]);
+    }
+#ifdef _OPENMP
+    if(n_threads > 1)
+    {
+      for(size_t i = 0; i < options->numberOfInternalSolvers; i++)
+        solver_options_delete(internalSolvers[i]);
+      free(internalSolvers);
+    }
+#endif
+  }
+
+  double * err = &(options->dparam[SICONOS_DPARAM_RESIDU]);
+  int it = 0;
+  int local_solver_error_occurred = 0;
+  *err = 0.;
+  *info = 0;
+  for(int c = 0; c < nbComponents; c++)
+  {
+    if(componentError[c] > *err)
+      *err = componentError[c];
+    if(componentIter[c] > it)
+      it = componentIter[c];
+    *info |= componentInfo[c];
+    local_solver_error_occurred |= componentLocalError[c];
+  }
+  options->iparam[SICONOS_IPARAM_ITER_DONE] = it;
+  if(*info && verbose > 0)
+    numerics_printf("gmp_gauss_seidel failed with Iteration %i Residual = %14.7e <= %7.3e\n", it, *err, options->dparam[SICONOS_DPARAM_TOL]);
+
+  if(local_solver_error_occurred)
+  {
+    for(int row = 0; row < nbBlocks; row++)
+    {
+      if(blocks[row]->error && verbose)
+        numerics_printf("genericMechanical_GS Numerics : Local solver FAILED row %d of type %s\n",
+                        row, ns_problem_id_to_name(blocks[row]->type));
+    }
+  }
+
+  free(componentError);
+  free(componentIter);
+  free(componentInfo);
+  free(componentLocalError);
+  free(blocks);
+  free(positions);
+  free(parent);
+  free(rows);
+  free(componentStart);
+}
+
 #ifdef GENERICMECHANICAL_DEBUG_CMP
 static int SScmp = 0;
 static int SScmpTotal = 0;
@@ -249,9 +598,16 @@ void gmp_gauss_seidel(GenericMechanicalProblem* pGMP, double * reaction, double
 #ifdef GENERICMECHANICAL_DEBUG_CMP
   SScmp++;
 #endif
+  if(options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_CONNECTED_COMPONENTS] &&
+      pGMP->M->storageType == NM_SPARSE_BLOCK &&
+      !options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_WITH_LINESEARCH])
+  {
+    gmp_gauss_seidel_components(pGMP, reaction, velocity, info, options);
+    DEBUG_END("gmp_gauss_seidel(...)\n");
+    return;
+  }
   listNumericsProblem * curProblem = 0;
   NM_types storageType = pGMP->M->storageType;
-  NumericsMatrix* numMat = pGMP->M;
   int iterMax = options->iparam[SICONOS_IPARAM_MAX_ITER];
   int it = 0;
   int currentRowNumber = 0;
@@ -261,8 +617,6 @@ void gmp_gauss_seidel(GenericMechanicalProblem* pGMP, double * reaction, double
   double * errLS = &(options->dparam[SICONOS_DPARAM_GMP_ERROR_LS]);
   int tolViolate = 1;
   int tolViolateLS = 1;
-  double * sol = 0;
-  double * w = 0;
   int resLocalSolver = 0;
   int local_solver_error_occurred = 0;
   //numerics_printf("gmp_gauss_seidel \n");
@@ -291,7 +645,6 @@ void gmp_gauss_seidel(GenericMechanicalProblem* pGMP, double * reaction, double
     currentRowNumber = 0;
     curProblem =  pGMP->firstListElem;
     int  posInX = 0;
-    size_t curSize = 0;
 
     DEBUG_PRINTF("GS it %d, initial value:\n", it);
     DEBUG_EXPR(
@@ -306,129 +659,9 @@ void gmp_gauss_seidel(GenericMechanicalProblem* pGMP, double * reaction, double
       //  posInX = m->blocksize0[currentRowNumber-1];
       //}
       //curSize=m->blocksize0[currentRowNumber] - posInX;
-      curSize = curProblem->size;
       curProblem->error = 0;
-      /*about the diagonal block:*/
-      //diagBlockNumber = NM_extract_diag_blockPos(m,currentRowNumber);
-      //diagBlockNumber = NM_extract_diag_blockPos(numMat,currentRowNumber,posInX,size);
-      double * diagBlock = 0;
-      if(storageType == NM_DENSE)  /*dense*/
-      {
-        NM_extract_diag_block(numMat, currentRowNumber, posInX, curSize, &bufForLocalProblemDense);
-        diagBlock = bufForLocalProblemDense;
-      }
-      else
-      {
-        NM_extract_diag_block(numMat, currentRowNumber, posInX, curSize, &diagBlock);
-
-      }
-
-      sol = reaction + posInX;
-      w = velocity + posInX;
-
-      switch(curProblem->type)
-      {
-      case SICONOS_NUMERICS_PROBLEM_EQUALITY:
-      {
-        numerics_printf_verbose(1, "solve SICONOS_NUMERICS_PROBLEM_EQUALITY");
-        NumericsMatrix M;
-        NM_fill(&M, NM_DENSE, curSize, curSize, diagBlock);
-
-        memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
-        NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, curProblem->q, NULL, 0);
-        for(size_t i = 0; i < curSize; ++i) sol[i] = -curProblem->q[i];
-
-        // resLocalSolver = NM_gesv(&M, sol, true);
-        resLocalSolver = NM_LU_solve(NM_preserve(&M), sol, 1);
-
-        M.matrix0 = NULL;
-        NM_clear(&M);
-        break;
-      }
-      case SICONOS_NUMERICS_PROBLEM_LCP:
-      {
-        numerics_printf_verbose(1, "solve SICONOS_NUMERICS_PROBLEM_LCP");
-        /*Mz*/
-        LinearComplementarityProblem* lcpProblem = (LinearComplementarityProblem*) curProblem->problem;
-        lcpProblem->M->matrix0 = diagBlock;
-        /*about q.*/
-        memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
-        NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, lcpProblem->q, NULL, 0);
-        resLocalSolver = linearComplementarity_driver(lcpProblem, sol, w, options->internalSolvers[0]);
-        break;
-      }
-      case SICONOS_NUMERICS_PROBLEM_RELAY:
-      {
-        numerics_printf_verbose(1, "solve SICONOS_NUMERICS_PROBLEM_RELAY");
-        /*Mz*/
-        RelayProblem* relayProblem = (RelayProblem*) curProblem->problem;
-        relayProblem->M->matrix0 = diagBlock;
-        /*about q.*/
-        memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
-        NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, relayProblem->q, NULL, 0);
-        resLocalSolver = relay_driver(relayProblem, sol, w, options->internalSolvers[2]);
-        break;
-      }
-      case SICONOS_NUMERICS_PROBLEM_FC3D:
-      {
-        numerics_printf_verbose(1, "solve SICONOS_NUMERICS_PROBLEM_FC3D");
-        FrictionContactProblem * fcProblem = (FrictionContactProblem *)curProblem->problem;
-        assert(fcProblem);
-        assert(fcProblem->M);
-        assert(fcProblem->q);
-        fcProblem->M->matrix0 = diagBlock;
-        memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
-
-        DEBUG_EXPR_WE(
-          NV_display(curProblem->q,3);
-          for(int i =0 ; i < 3; i++)
-            numerics_printf("curProblem->q[%i]= %12.8e,\t fcProblem->q[%i]= %12.8e,\n",i,curProblem->q[i],i,fcProblem->q[i]);
-          );
-
-        NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, fcProblem->q, NULL, 0);
-
-        DEBUG_EXPR_WE(
-          for(int i =0 ; i < 3; i++)
-            numerics_printf("reaction[%i]= %12.8e,\t fcProblem->q[%i]= %12.8e,\n",
-                            i,reaction[i],i,fcProblem->q[i]);
-          );
-
-        /* We call the generic driver (rather than the specific) since we may choose between various local solvers */
-        resLocalSolver = fc3d_driver(fcProblem, sol, w, options->internalSolvers[1]);
-        //resLocalSolver=fc3d_unitary_enumerative_solve(fcProblem,sol,&options->internalSolvers[1]);
-        break;
-      }
-      case SICONOS_NUMERICS_PROBLEM_FC2D:
-      {
-        numerics_printf_verbose(1, "solve SICONOS_NUMERICS_PROBLEM_FC2D");
-        FrictionContactProblem * fcProblem = (FrictionContactProblem *)curProblem->problem;
-        assert(fcProblem);
-        assert(fcProblem->M);
-        assert(fcProblem->q);
-        fcProblem->M->matrix0 = diagBlock;
-        memcpy(curProblem->q, &(pGMP->q[posInX]), curSize * sizeof(double));
-
-        DEBUG_EXPR_WE(
-          NV_display(curProblem->q,2);
-          for(int i =0 ; i < 2; i++)
-            numerics_printf("curProblem->q[%i]= %12.8e,\t fcProblem->q[%i]= %12.8e,\n",i,curProblem->q[i],i,fcProblem->q[i]);
-          );
-
-        NM_row_prod_no_diag(pGMP->size, curSize, currentRowNumber, posInX, numMat, reaction, fcProblem->q, NULL, 0);
-
-        DEBUG_EXPR_WE(
-          for(int i =0 ; i < 2; i++)
-            numerics_printf("reaction[%i]= %12.8e,\t fcProblem->q[%i]= %12.8e,\n",i,reaction[i],i,fcProblem->q[i]);
-          );
-
-        /* We call the generic driver (rather than the specific) since we may choose between various local solvers */
-        resLocalSolver = fc2d_driver(fcProblem, sol, w, options->internalSolvers[3]);
-        //resLocalSolver=fc3d_unitary_enumerative_solve(fcProblem,sol,&options->internalSolvers[1]);
-        break;
-      }
-      default:
-        numerics_printf("genericMechanical_GS Numerics : gmp_gauss_seidel unknown problem type %d.\n", curProblem->type);
-      }
+      resLocalSolver = gmp_solve_local_problem(pGMP, curProblem, currentRowNumber, posInX, reaction, velocity,
+                                               options->internalSolvers, bufForLocalProblemDense);
       if(resLocalSolver)
       {
         curProblem->error = 1;
@@ -584,6 +817,11 @@ int gmp_driver(GenericMechanicalProblem* problem, double *reaction, double *velo
       numerics_printf("gmp_driver : call of mlcp\n");
       gmp_as_mlcp(problem, reaction, velocity, &info, options);
     }
+    else if(options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_ISREDUCED] == SICONOS_GENERIC_MECHANICAL_SUBS_EQUALITIES_SPARSE)
+    {
+      numerics_printf("gmp_driver : call of gmp_reduced_sparse_solve\n");
+      gmp_reduced_sparse_solve(problem, reaction, velocity, &info, options);
+    }
     else
     {
       numerics_printf("gmp_driver error, options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_ISREDUCED] wrong value.\n");
@@ -615,6 +853,9 @@ void gmp_set_default(SolverOptions* options)
   options->dparam[SICONOS_DPARAM_TOL] = 1e-4;
   /*Useful parameter for LS*/
   options->dparam[SICONOS_DPARAM_GMP_COEFF_LS] = 1.0;
+  /*a single Gauss-Seidel loop on all the blocks*/
+  options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_CONNECTED_COMPONENTS] = 0;
+  options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_NUMBER_OF_THREADS] = 1;
 
   options->internalSolvers[0] = solver_options_create(SICONOS_LCP_LEMKE);
   options->internalSolvers[1] = solver_options_create(SICONOS_FRICTION_3D_ONECONTACT_QUARTIC);
@@ -0,0 +1,124 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The same GMPs solved by the Gauss-Seidel loop on all the blocks and by
+   the Gauss-Seidel on the connected components of the blocks (GMP3.dat has
+   two components), with one thread and with several ones. The components
+   are decoupled, and their rows are kept in the same order: the solutions
+   must be the same as the ones of the loop on all the blocks, up to
+   round-off errors. Without OpenMP, the number of threads is ignored. */
+
+#include <math.h>                          // for fabs
+#include <stdio.h>                         // for printf, fclose, fopen, FILE
+#include <stdlib.h>                        // for calloc, free
+#include "Friction_cst.h"                  // for SICONOS_FRICTION_3D_ONECON...
+#include "GenericMechanicalProblem.h"      // for GenericMechanicalProblem
+#include "GenericMechanical_Solvers.h"     // for gmp_driver, gmp_compute_error
+#include "GenericMechanical_cst.h"         // for SICONOS_GENERIC_MECHANICAL...
+#include "SolverOptions.h"                 // for SolverOptions, solver_opti...
+
+static int solve(GenericMechanicalProblem* problem, int components, int n_threads,
+                 double * reaction, double * velocity, double * error)
+{
+  SolverOptions * options = solver_options_create(SICONOS_GENERIC_MECHANICAL_NSGS);
+  options->dparam[SICONOS_DPARAM_TOL] = 1e-5;
+  options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+  options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_ISREDUCED] = SICONOS_GENERIC_MECHANICAL_GS_ON_ALLBLOCKS;
+  options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_CONNECTED_COMPONENTS] = components;
+  options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_NUMBER_OF_THREADS] = n_threads;
+  solver_options_update_internal(options, 1, SICONOS_FRICTION_3D_ONECONTACT_QUARTIC);
+  for(int i = 0; i < problem->size; i++)
+    reaction[i] = velocity[i] = 0.;
+  int info = gmp_driver(problem, reaction, velocity, options);
+  if(!info)
+    gmp_compute_error(problem, reaction, velocity, 1e-5, options, error);
+  solver_options_delete(options);
+  free(options);
+  return info;
+}
+
+int main(void)
+{
+  int info = 0;
+  const char * files[5] = {"./data/GMP0.dat", "./data/GMP1.dat", "./data/GMP2.dat",
+                           "./data/GMP3.dat", "./data/GMP4.dat"
+                          };
+  for(int k = 0; k < 5; k++)
+  {
+    FILE * file = fopen(files[k], "r");
+    if(!file)
+    {
+      printf("%s: cannot open the file\n", files[k]);
+      return 1;
+    }
+    GenericMechanicalProblem * problem = genericMechanical_newFromFile(file);
+    fclose(file);
+
+    int size = problem->size;
+    double * reaction_ref = (double *)calloc(size, sizeof(double));
+    double * velocity_ref = (double *)calloc(size, sizeof(double));
+    double * reaction = (double *)calloc(size, sizeof(double));
+    double * velocity = (double *)calloc(size, sizeof(double));
+    double error = 0.;
+
+    int info_ref = solve(problem, 0, 1, reaction_ref, velocity_ref, &error);
+    if(info_ref)
+    {
+      printf("%s: the loop on all the blocks failed\n", files[k]);
+      info++;
+    }
+    for(int n_threads = 1; n_threads <= 2; n_threads++)
+    {
+      int info_k = solve(problem, 1, n_threads, reaction, velocity, &error);
+      if(info_k)
+      {
+        printf("%s, %i threads: the loop on the components failed\n", files[k], n_threads);
+        info++;
+        continue;
+      }
+      if(error > 1e-5)
+      {
+        printf("%s, %i threads: wrong solution, error = %e\n", files[k], n_threads, error);
+        info++;
+      }
+      double diff = 0.;
+      for(int i = 0; i < size; i++)
+      {
+        if(fabs(reaction[i] - reaction_ref[i]) > diff)
+          diff = fabs(reaction[i] - reaction_ref[i]);
+        if(fabs(velocity[i] - velocity_ref[i]) > diff)
+          diff = fabs(velocity[i] - velocity_ref[i]);
+      }
+      if(diff > 1e-8)
+      {
+        printf("%s, %i threads: not the solution of the loop on all the blocks, diff = %e\n",
+               files[k], n_threads, diff);
+        info++;
+      }
+    }
+    printf("%s: info = %i\n", files[k], info_ref);
+    free(reaction_ref);
+    free(velocity_ref);
+    free(reaction);
+    free(velocity);
+    genericMechanicalProblem_free(problem, NUMERICS_GMP_FREE_MATRIX);
+    free(problem);
+  }
+  printf("End of test, info = %i\n", info);
+  return info;
+}
@@ -0,0 +1,123 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The same GMPs solved with the equalities substituted in dense storage
+   (gmp_reduced_solve) and in sparse storage (gmp_reduced_sparse_solve).
+   Both build the same reduced problem of the inequalities, up to round-off
+   errors, and solve it with the same Gauss-Seidel loop: the solutions must
+   be the same. The equality block of GMP3.dat is ill-conditioned and the
+   dense (LAPACK) and sparse (CSparse) LU give multipliers that differ by
+   a few 1e-7 relative: the reactions are compared relatively to their
+   size. GMP6.dat is not used, its reduced problem has several solutions. */
+
+#include <math.h>                          // for fabs
+#include <stdio.h>                         // for printf, fclose, fopen, FILE
+#include <stdlib.h>                        // for calloc, free
+#include "Friction_cst.h"                  // for SICONOS_FRICTION_3D_ONECON...
+#include "GenericMechanicalProblem.h"      // for GenericMechanicalProblem
+#include "GenericMechanical_Solvers.h"     // for gmp_driver, gmp_compute_error
+#include "GenericMechanical_cst.h"         // for SICONOS_GENERIC_MECHANICAL...
+#include "SolverOptions.h"                 // for SolverOptions, solver_opti...
+
+static int solve(GenericMechanicalProblem* problem, int reduced,
+                 double * reaction, double * velocity, double * error)
+{
+  SolverOptions * options = solver_options_create(SICONOS_GENERIC_MECHANICAL_NSGS);
+  options->dparam[SICONOS_DPARAM_TOL] = 1e-5;
+  options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000;
+  options->iparam[SICONOS_GENERIC_MECHANICAL_IPARAM_ISREDUCED] = reduced;
+  solver_options_update_internal(options, 1, SICONOS_FRICTION_3D_ONECONTACT_QUARTIC);
+  for(int i = 0; i < problem->size; i++)
+    reaction[i] = velocity[i] = 0.;
+  int info = gmp_driver(problem, reaction, velocity, options);
+  if(!info)
+    gmp_compute_error(problem, reaction, velocity, 1e-5, options, error);
+  solver_options_delete(options);
+  free(options);
+  return info;
+}
+
+int main(void)
+{
+  int info = 0;
+  const char * files[6] = {"./data/GMP0.dat", "./data/GMP1.dat", "./data/GMP2.dat",
+                           "./data/GMP3.dat", "./data/GMP4.dat", "./data/GMP5.dat"
+                          };
+  for(int k = 0; k < 6; k++)
+  {
+    FILE * file = fopen(files[k], "r");
+    if(!file)
+    {
+      printf("%s: cannot open the file\n", files[k]);
+      return 1;
+    }
+    GenericMechanicalProblem * problem = genericMechanical_newFromFile(file);
+    fclose(file);
+
+    int size = problem->size;
+    double * reaction_ref = (double *)calloc(size, sizeof(double));
+    double * velocity_ref = (double *)calloc(size, sizeof(double));
+    double * reaction = (double *)calloc(size, sizeof(double));
+    double * velocity = (double *)calloc(size, sizeof(double));
+    double error = 0.;
+
+    int info_ref = solve(problem, SICONOS_GENERIC_MECHANICAL_SUBS_EQUALITIES,
+                         reaction_ref, velocity_ref, &error);
+    int info_k = solve(problem, SICONOS_GENERIC_MECHANICAL_SUBS_EQUALITIES_SPARSE,
+                       reaction, velocity, &error);
+    if(info_k != info_ref)
+    {
+      printf("%s: info = %i with the sparse storage, %i with the dense one\n",
+             files[k], info_k, info_ref);
+      info++;
+    }
+    else if(!info_k)
+    {
+      if(error > 1e-5)
+      {
+        printf("%s: wrong solution, error = %e\n", files[k], error);
+        info++;
+      }
+      double diff_r = 0., diff_v = 0., norm_r = 0.;
+      for(int i = 0; i < size; i++)
+      {
+        if(fabs(reaction_ref[i]) > norm_r)
+          norm_r = fabs(reaction_ref[i]);
+        if(fabs(reaction[i] - reaction_ref[i]) > diff_r)
+          diff_r = fabs(reaction[i] - reaction_ref[i]);
+        if(fabs(velocity[i] - velocity_ref[i]) > diff_v)
+          diff_v = fabs(velocity[i] - velocity_ref[i]);
+      }
+      if(diff_r > 1e-6 * (1. + norm_r) || diff_v > 1e-8)
+      {
+        printf("%s: not the solution of the dense substitution, diff = %e (reaction), %e (velocity)\n",
+               files[k], diff_r, diff_v);
+        info++;
+      }
+    }
+    printf("%s: info = %i\n", files[k], info_ref);
+    free(reaction_ref);
+    free(velocity_ref);
+    free(reaction);
+    free(velocity);
+    genericMechanicalProblem_free(problem, NUMERICS_GMP_FREE_MATRIX);
+    free(problem);
+  }
+  printf("End of test, info = %i\n", info);
+  return info;
+}
@@ -176,9 +176,8 @@ int lcp_driver_DenseMatrix(LinearComplementarityProblem* problem, double *z, dou
     // trivial solution : size-1 LCP
     if(n == 1)
     {
-      double *M = problem->M->matrix0;
       w[0] = 0.;
-      z[0] = -q[0] / M[0];
+      z[0] = -q[0] / NM_get_value(problem->M, 0, 0);
       info = 0;
       options->dparam[SICONOS_DPARAM_RESIDU] = 0.0; /* Error */
       numerics_printf_verbose(1,"LCP_driver_DenseMatrix: found trivial solution for the LCP (problem of size 1). \n");
@@ -73,6 +73,15 @@ enum SICONOS_LCP_IPARAM
    SICONOS_LCP_IPARAM_ENUM_USE_DGELS =10,
    /** index in iparam to store to activate multiple solutions search */
    SICONOS_LCP_IPARAM_ENUM_MULTIPLE_SOLUTIONS =11,
+   /** index in iparam to store the number of threads of the enumeration
+       (needs OpenMP, 0 or 1 for the serial one, negative for the OpenMP default) */
+   SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_THREADS =12,
+   /** index in iparam to activate the deterministic parallel enumeration:
+       the solution with the lowest index is returned, as in the serial case */
+   SICONOS_LCP_IPARAM_ENUM_DETERMINISTIC =13,
+   /** index in iparam to store the maximum number of basis changes between
+       two factorizations in the pivot method with BLU updates */
+   SICONOS_LCP_IPARAM_PIVOT_LUMOD_MAXMOD =14,
   };
 
 enum SICONOS_LCP_DPARAM
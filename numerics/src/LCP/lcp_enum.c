@@ -30,6 +30,9 @@
 #include "lcp_cst.h"                       // for SICONOS_LCP_IPARAM_ENUM_US...
 #include "numerics_verbose.h"              // for numerics_printf, verbose
 #include "enum_tool.h"
+#ifdef _OPENMP
+#include <omp.h>                           // for omp_get_max_threads
+#endif
 
 
 static void lcp_buildM(int * zw,
@@ -120,6 +123,151 @@ void lcp_enum_reset(LinearComplementarityProblem* problem, SolverOptions* option
 }
 
 
+/* Solve the linear system of the complementarity pattern zw_indices.
+   Return 1 if its solution, stored in q_linear_system, lies in the cone. */
+static int lcp_enum_try(LinearComplementarityProblem* problem, int * zw_indices,
+                        double * M_linear_system, double * q_linear_system,
+                        double * q_linear_systemref, double * column_of_zero,
+                        lapack_int * ipiv, int useDGELS, double tol)
+{
+  int size = problem->size;
+  int NRHS = 1;
+  lapack_int LAinfo = 0;
+
+  lcp_buildM(zw_indices,  M_linear_system, problem->M->matrix0, size, column_of_zero);
+  memcpy(q_linear_system, q_linear_systemref, (size)*sizeof(double));
+  /*     if (verbose) */
+  /*       printCurrentSystem(); */
+  if(useDGELS)
+  {
+    /* if (verbose) */
+    /*   { */
+    /*     numerics_printf("call dgels on ||AX-B||\n"); */
+    /*     numerics_printf("A\n"); */
+    /*     NM_dense_display( M_linear_system,sSize,sSize,0); */
+    /*     numerics_printf("B\n"); */
+    /*     NM_dense_display(q_linear_system,sSize,1,0); */
+    /*   } */
+
+    DGELS(LA_NOTRANS, size, size, NRHS,  M_linear_system, size, q_linear_system, size, &LAinfo);
+    if(verbose)
+    {
+      numerics_printf("Solution of dgels (info=%i)", LAinfo);
+      NM_dense_display(q_linear_system, size, 1, 0);
+    }
+  }
+  else
+  {
+    DGESV(size, NRHS,  M_linear_system, size, ipiv, q_linear_system, size, &LAinfo);
+  }
+  if(LAinfo)
+    return 0;
+
+  if(useDGELS)
+  {
+    numerics_printf("DGELS LAInfo=%i", LAinfo);
+    for(int ii = 0; ii < size; ii++)
+    {
+      if(isnan(q_linear_system[ii]) || isinf(q_linear_system[ii]))
+      {
+        numerics_printf("DGELS FAILED");
+        return 0;
+      }
+    }
+  }
+
+  if(verbose)
+  {
+    numerics_printf("lcp_enum LU factorization succeeded:");
+  }
+
+  for(int row  = 0 ; row < size; row++)
+  {
+    if(q_linear_system[row] < - tol)
+    {
+      return 0;/*out of the cone!*/
+    }
+  }
+  return 1;
+}
+
+#ifdef _OPENMP
+/* The cases are shared between n_threads workers, each one with its own
+   linear system. As soon as a solution is found, the other cases are
+   skipped, except in the deterministic mode where the cases with a lower
+   index than the best solution found so far are still tried. */
+static int lcp_enum_parallel(LinearComplementarityProblem* problem, double *z, double *w,
+                             SolverOptions* options, double * q_linear_systemref,
+                             double * column_of_zero, int n_threads)
+{
+  int size = problem->size;
+  double tol = options->dparam[SICONOS_DPARAM_TOL];
+  int useDGELS = options->iparam[SICONOS_LCP_IPARAM_ENUM_USE_DGELS];
+  int deterministic = options->iparam[SICONOS_LCP_IPARAM_ENUM_DETERMINISTIC];
+  unsigned long long int nb_cases = enum_compute_nb_cases(size);
+  unsigned long long int seed = (unsigned long long int)options->iparam[SICONOS_LCP_IPARAM_ENUM_SEED];
+  unsigned long long int best = nb_cases;
+  double * solution = (double *)malloc(size * sizeof(double));
+  int * zw_solution = (int *)malloc(size * sizeof(int));
+  long long int nb = (long long int)nb_cases;
+
+  if(seed >= nb_cases)
+    seed = 0;
+
+  #pragma omp parallel num_threads(n_threads)
+  {
+    double * M_linear_system = (double *)malloc(size * size * sizeof(double));
+    double * q_linear_system = (double *)malloc(size * sizeof(double));
+    int * zw_indices = (int *)malloc(size * sizeof(int));
+    lapack_int * ipiv = (lapack_int *)malloc(size * sizeof(lapack_int));
+    long long int k;
+
+    #pragma omp for schedule(dynamic, 16)
+    for(k = 0; k < nb; k++)
+    {
+      unsigned long long int found;
+      #pragma omp atomic read
+      found = best;
+      if(deterministic ? (unsigned long long int)k > found : found < nb_cases)
+        continue;
+      enum_set_zw(zw_indices, size, (seed + k) % nb_cases);
+      if(lcp_enum_try(problem, zw_indices, M_linear_system, q_linear_system,
+                      q_linear_systemref, column_of_zero, ipiv, useDGELS, tol))
+      {
+        #pragma omp critical(lcp_enum_solution)
+        {
+          if((unsigned long long int)k < best)
+          {
+            memcpy(solution, q_linear_system, size * sizeof(double));
+            memcpy(zw_solution, zw_indices, size * sizeof(int));
+            #pragma omp atomic write
+            best = k;
+          }
+        }
+      }
+    }
+    free(M_linear_system);
+    free(q_linear_system);
+    free(zw_indices);
+    free(ipiv);
+  }
+
+  int info = 1;
+  if(best < nb_cases)
+  {
+    info = 0;
+    lcp_fillSolution(z, w, size, zw_solution, solution);
+    options->iparam[SICONOS_LCP_IPARAM_ENUM_CURRENT_ENUM] = (int)((seed + best) % nb_cases);
+    options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_SOLUTIONS] = 1;
+    if(verbose)
+      numerics_printf("lcp_enum find a solution with scurrent = %ld!", (long)((seed + best) % nb_cases));
+  }
+  free(solution);
+  free(zw_solution);
+  return info;
+}
+#endif
+
 void lcp_enum(LinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options)
 {
   *info = 1;
@@ -132,10 +280,7 @@ void lcp_enum(LinearComplementarityProblem* problem, double *z, double *w, int *
   int * workingInt = options->iWork;
 
   int size = problem->size;
-  int NRHS = 1;
   lapack_int * ipiv;
-  int check;
-  lapack_int LAinfo = 0;
   int useDGELS = options->iparam[SICONOS_LCP_IPARAM_ENUM_USE_DGELS];
 
   /*OUTPUT param*/
@@ -164,6 +309,20 @@ void lcp_enum(LinearComplementarityProblem* problem, double *z, double *w, int *
     q_linear_systemref[row] =  - problem->q[row];
     column_of_zero[row] = 0;
   }
+
+#ifdef _OPENMP
+  int n_threads = options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_THREADS];
+  if(n_threads < 0)
+    n_threads = omp_get_max_threads();
+  if(n_threads > 1 && !multipleSolutions)
+  {
+    *info = lcp_enum_parallel(problem, z, w, options, q_linear_systemref, column_of_zero, n_threads);
+    if(*info && verbose)
+      numerics_printf("lcp_enum has not found a solution!\n");
+    return;
+  }
+#endif
+
   //sWZ = workingInt;
   int * zw_indices  =  workingInt;
   ipiv = zw_indices + size;
@@ -172,83 +331,25 @@ void lcp_enum(LinearComplementarityProblem* problem, double *z, double *w, int *
   enum_struct->current = options->iparam[SICONOS_LCP_IPARAM_ENUM_SEED];
   while(enum_next(zw_indices, size, enum_struct))
   {
-    lcp_buildM(zw_indices,  M_linear_system, problem->M->matrix0, size, column_of_zero);
-    memcpy(q_linear_system, q_linear_systemref, (size)*sizeof(double));
-    /*     if (verbose) */
-    /*       printCurrentSystem(); */
-    if(useDGELS)
+    if(!lcp_enum_try(problem, zw_indices, M_linear_system, q_linear_system,
+                     q_linear_systemref, column_of_zero, ipiv, useDGELS, tol))
+      continue;
+    numberofSolutions++;
+    if(verbose || multipleSolutions)
     {
-      /* if (verbose) */
-      /*   { */
-      /*     numerics_printf("call dgels on ||AX-B||\n"); */
-      /*     numerics_printf("A\n"); */
-      /*     NM_dense_display( M_linear_system,sSize,sSize,0); */
-      /*     numerics_printf("B\n"); */
-      /*     NM_dense_display(q_linear_system,sSize,1,0); */
-      /*   } */
-
-      DGELS(LA_NOTRANS, size, size, NRHS,  M_linear_system, size, q_linear_system, size, &LAinfo);
-      if(verbose)
-      {
-        numerics_printf("Solution of dgels (info=%i)", LAinfo);
-        NM_dense_display(q_linear_system, size, 1, 0);
-      }
+      numerics_printf("lcp_enum find %i solution with scurrent = %ld!", numberofSolutions, enum_struct->current - 1);
     }
-    else
+    *info = 0;
+    lcp_fillSolution(z, w, size, zw_indices, q_linear_system);
+    options->iparam[SICONOS_LCP_IPARAM_ENUM_CURRENT_ENUM ] = (int) enum_struct->current - 1;
+    options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_SOLUTIONS] = numberofSolutions;
+    if(!multipleSolutions)
     {
-      DGESV(size, NRHS,  M_linear_system, size, ipiv, q_linear_system, size, &LAinfo);
-    }
-    if(!LAinfo)
-    {
-      if(useDGELS)
-      {
-        int cc = 0;
-        int ii;
-        numerics_printf("DGELS LAInfo=%i", LAinfo);
-        for(ii = 0; ii < size; ii++)
-        {
-          if(isnan(q_linear_system[ii]) || isinf(q_linear_system[ii]))
-          {
-            numerics_printf("DGELS FAILED");
-            cc = 1;
-            break;
-          }
-        }
-        if(cc)
-          continue;
-      }
-
-      if(verbose)
-      {
-        numerics_printf("lcp_enum LU factorization succeeded:");
-      }
-
-      check = 1;
-      for(int row  = 0 ; row < size; row++)
-      {
-        if(q_linear_system[row] < - tol)
-        {
-          check = 0;
-          break;/*out of the cone!*/
-        }
-      }
-      if(!check)
-        continue;
-      else
-      {
-        numberofSolutions++;
-        if(verbose || multipleSolutions)
-        {
-          numerics_printf("lcp_enum find %i solution with scurrent = %ld!", numberofSolutions, enum_struct->current - 1);
-        }
-        *info = 0;
-        lcp_fillSolution(z, w, size, zw_indices, q_linear_system);
-        options->iparam[SICONOS_LCP_IPARAM_ENUM_CURRENT_ENUM ] = (int) enum_struct->current - 1;
-        options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_SOLUTIONS] = numberofSolutions;
-        if(!multipleSolutions)  return;
-      }
+      free(enum_struct);
+      return;
     }
   }
+  free(enum_struct);
   *info = 1;
   if(verbose)
     numerics_printf("lcp_enum has not found a solution!\n");
@@ -259,6 +360,8 @@ void lcp_enum_set_default(SolverOptions* options)
   options->iparam[SICONOS_LCP_IPARAM_ENUM_USE_DGELS] = 0;
   options->iparam[SICONOS_LCP_IPARAM_ENUM_SEED] = 0;
   options->iparam[SICONOS_LCP_IPARAM_ENUM_MULTIPLE_SOLUTIONS] = 0;
+  options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_THREADS] = 1;
+  options->iparam[SICONOS_LCP_IPARAM_ENUM_DETERMINISTIC] = 0;
   // SICONOS_LCP_IPARAM_ENUM_CURRENT_ENUM (out)
   // SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_SOLUTIONS (out)
 
@@ -30,7 +30,8 @@
 #include "LCP_Solvers.h"                   // for lcp_compute_error, lcp_piv...
 #include "LinearComplementarityProblem.h"  // for LinearComplementarityProblem
 #include "NumericsFwd.h"                   // for LinearComplementarityProblem
-#include "NumericsMatrix.h"                // for NumericsMatrix
+#include "CSparseMatrix_internal.h"        // for CSparseMatrix, CS_INT
+#include "NumericsMatrix.h"                // for NumericsMatrix, NM_csc
 #include "SolverOptions.h"                 // for SolverOptions, SICONOS_IPA...
 //#define DEBUG_STDOUT
 //#define DEBUG_MESSAGES
@@ -57,6 +58,17 @@ inline static double* get_driving_col(double* mat, unsigned n)
   return &mat[n];
 }
 
+/* Without the lexicographic matrix, only one column of the inverse of the
+ * basis is needed at a time for the lexicographic ordering */
+inline static unsigned get_lexico_size(unsigned n)
+{
+#ifndef NO_LEXICO_MAT
+  return n*n;
+#else
+  return n;
+#endif
+}
+
 inline static double* get_lexico_mat(double* mat, unsigned n)
 {
   return &mat[2*n];
@@ -64,13 +76,58 @@ inline static double* get_lexico_mat(double* mat, unsigned n)
 
 inline static double* get_col_tilde(double* mat, unsigned n)
 {
-  return &mat[(n+2)*n];
+  return &mat[2*n + get_lexico_size(n)];
 }
 
 inline static double* get_cov_vec(double* mat, unsigned n)
 {
-  return &mat[(n+3)*n];
+  return &mat[3*n + get_lexico_size(n)];
+}
+
+/* Copy the column of M associated with z_indx into col. For a sparse M,
+ * the column is scattered from the csc storage. */
+inline static void get_M_col(NumericsMatrix* M, unsigned z_indx, double* col)
+{
+  unsigned n = M->size0;
+  if(M->storageType == NM_DENSE)
+  {
+    cblas_dcopy(n, &M->matrix0[n*z_indx], 1, col, 1);
+  }
+  else
+  {
+    CSparseMatrix* Mcsc = NM_csc(M);
+    memset(col, 0, n*sizeof(double));
+    for(CS_INT p = Mcsc->p[z_indx]; p < Mcsc->p[z_indx+1]; ++p)
+    {
+      col[Mcsc->i[p]] += Mcsc->x[p];
+    }
+  }
+}
+
+#ifdef NO_LEXICO_MAT
+/* Initial pivot, when the basis is made of all the w variables: the matrix
+ * for the lexicographic ordering is then the identity and among the
+ * candidates with the same ratio, the one with the largest index is the
+ * lexicomin. */
+static int pivot_selection_lemke_init(unsigned n, double* restrict cov_vec, double* restrict q)
+{
+  int block = -1;
+  double ratio = INFINITY;
+  for(unsigned i = 0 ; i < n ; ++i)
+  {
+    if(cov_vec[i] > 0.)
+    {
+      double candidate_ratio = q[i] / cov_vec[i];
+      if(candidate_ratio <= ratio)
+      {
+        ratio = candidate_ratio;
+        block = i;
+      }
+    }
+  }
+  return block;
 }
+#endif
 
 void lcp_pivot_lumod(LinearComplementarityProblem* problem, double* u, double* s, int *info, SolverOptions* options)
 {
@@ -83,8 +140,7 @@ void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, doub
   /* matrix M of the LCP */
   assert(problem);
   assert(problem->M);
-  double* M = problem->M->matrix0;
-  assert(M);
+  assert(problem->M->storageType != NM_DENSE || problem->M->matrix0);
   assert(problem->q);
 
 
@@ -130,9 +186,9 @@ void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, doub
   double* t_stack = NULL;
 #endif
   /* This matrix contains q, the solution to the linear system Hk x = driving_col,
-   * the matrix for the lexicographic ordering and the solution to the linear
-   * system H x = driving_col. */
-  double* mat = (double*) calloc((dim+4)*dim, sizeof(double)); /* XXX memory save */
+   * the matrix (or column) for the lexicographic ordering, the solution to the
+   * linear system H x = driving_col and the covering vector. */
+  double* mat = (double*) calloc(4*dim + get_lexico_size(dim), sizeof(double));
   assert(problem->q);
   cblas_dcopy(dim, problem->q, 1, get_q_tilde(mat, dim), 1);
 
@@ -146,14 +202,20 @@ void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, doub
     for(unsigned i = 0; i < dim; ++i) d[i] = 1.;
   }
 
+#ifndef NO_LEXICO_MAT
   /* Init the lexicographic mat */
   double* lexico_mat = get_lexico_mat(mat, dim);
   for(unsigned i = 0; i < dim*dim; i += dim+1) lexico_mat[i] = 1.;
   DEBUG_PRINT_MAT_ROW_MAJOR_NCOLS_SMALL_STR("lexico_mat", lexico_mat, dim, dim, dim);
+#else
+  /* The lexicographic ordering is done with the LU factors of the basis */
+  double* lexico_mat = NULL;
+#endif
 
-  /* Maximum number of columns changed in the matrix */
-  /* TODO: user settable and should not be bigger than the size of the matrix? */
-  unsigned maxmod = 50;
+  /* Maximum number of columns changed in the matrix before a refactorization */
+  unsigned maxmod = options->iparam[SICONOS_LCP_IPARAM_PIVOT_LUMOD_MAXMOD] > 0 ?
+                    options->iparam[SICONOS_LCP_IPARAM_PIVOT_LUMOD_MAXMOD] : 50;
+  if(maxmod > dim) maxmod = dim;
 
   *info = 0;
 
@@ -161,7 +223,10 @@ void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, doub
   options->iparam[SICONOS_IPARAM_ITER_DONE] = 0;
 
   /* Allocation */
-  SN_lumod_dense_data* lumod_data = SN_lumod_dense_allocate(dim, maxmod);
+  /* With a sparse M, the basis is factorized in sparse format */
+  SN_lumod_dense_data* lumod_data = problem->M->storageType == NM_DENSE ?
+                                    SN_lumod_dense_allocate(dim, maxmod) :
+                                    SN_lumod_sparse_allocate(dim, maxmod);
 
   /*   switch (pivot_selection_rule) */
   /*   { */
@@ -201,7 +266,11 @@ void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, doub
   case SICONOS_LCP_PIVOT_LEMKE:
   default:
 //      block = pivot_init_lemke(get_q_tilde(mat, dim), dim);
+#ifndef NO_LEXICO_MAT
     block = pivot_selection_lemke2(dim, get_cov_vec(mat, dim), get_q_tilde(mat, dim), get_lexico_mat(mat, dim), INT_MAX, LEXICO_TOL);
+#else
+    block = pivot_selection_lemke_init(dim, get_cov_vec(mat, dim), get_q_tilde(mat, dim));
+#endif
   }
 
   if(block < 0)
@@ -280,7 +349,11 @@ void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, doub
         break;*/
   case SICONOS_LCP_PIVOT_LEMKE:
   default:
-    SN_lumod_factorize(lumod_data, basis, problem->M, get_cov_vec(mat, dim));
+    if(SN_lumod_factorize(lumod_data, basis, problem->M, get_cov_vec(mat, dim)))
+    {
+      *info = LCP_PIVOT_LUMOD_FAILED;
+      goto exit_lcp_pivot;
+    }
     pivot = get_cov_vec(mat, dim)[block];
   }
   DEBUG_PRINT("lcp_pivot: init done, starting resolution\n");
@@ -304,6 +377,7 @@ void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, doub
     cblas_daxpy(dim, theta, get_cov_vec(mat, dim), 1, q, 1);
     q[block] = theta;
 
+#ifndef NO_LEXICO_MAT
     unsigned block_row_indx = block*dim;
     for(unsigned i = 0, j = 0; i < dim; ++i, j += dim)
     {
@@ -312,6 +386,7 @@ void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, doub
     }
     cblas_dscal(dim, -1./pivot, &lexico_mat[block_row_indx], 1);
     DEBUG_PRINT_MAT_ROW_MAJOR_NCOLS_SMALL2_STR("lexico_mat", lexico_mat, dim, dim, dim, get_cov_vec(mat, dim));
+#endif
   }
   DEBUG_PRINT_VEC(get_q_tilde(mat, dim), dim);
 
@@ -327,12 +402,23 @@ void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, doub
   {
 
     ++nb_iter;
+    /* Periodic refactorization: the BLU part is full and the next pivot may
+     * add a row and a column to it */
+    if(lumod_data->k >= maxmod)
+    {
+      DEBUG_PRINT("Refactorizing, maxmod reached!\n");
+      if(SN_lumod_factorize(lumod_data, basis, problem->M, get_cov_vec(mat, dim)))
+      {
+        *info = LCP_PIVOT_LUMOD_FAILED;
+        goto exit_lcp_pivot;
+      }
+    }
     /*  Prepare the search for leaving variable */
     double* driving_col = get_driving_col(mat, dim);
     if(leaving < dim + BASIS_OFFSET)  /* the leaving variable is w_i -> the driving variable is z_i */
     {
       drive = leaving + dim + BASIS_OFFSET;
-      cblas_dcopy(dim, &M[dim*(leaving-BASIS_OFFSET)], 1, driving_col, 1);
+      get_M_col(problem->M, leaving-BASIS_OFFSET, driving_col);
     }
     else if(leaving > dim + BASIS_OFFSET)  /*  the leaving variable is z_i -> the driving variable is w_i */
     {
@@ -358,7 +444,7 @@ void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, doub
       if(leaving < dim + BASIS_OFFSET)  /* the leaving variable is w_i -> the driving variable is z_i */
       {
         drive = leaving + dim + BASIS_OFFSET;
-        cblas_dcopy(dim, &M[dim*(leaving-BASIS_OFFSET)], 1, driving_col, 1);
+        get_M_col(problem->M, leaving-BASIS_OFFSET, driving_col);
       }
       else if(leaving > dim + BASIS_OFFSET)  /*  the leaving variable is z_i -> the driving variable is w_i */
       {
@@ -499,7 +585,7 @@ void lcp_pivot_lumod_covering_vector(LinearComplementarityProblem* problem, doub
     case SICONOS_LCP_PIVOT_LEMKE:
     case SICONOS_LCP_PIVOT_PATHSEARCH:
     default:
-      do_pivot_lumod(lumod_data, problem->M, get_q_tilde(mat, dim), get_lexico_mat(mat, dim), get_driving_col(mat, dim), get_col_tilde(mat, dim), basis, block, drive);
+      do_pivot_lumod(lumod_data, problem->M, get_q_tilde(mat, dim), lexico_mat, get_driving_col(mat, dim), get_col_tilde(mat, dim), basis, block, drive);
     }
     DEBUG_PRINT_VEC(get_q_tilde(mat, dim), dim);
 
@@ -636,4 +722,5 @@ exit_lcp_pivot:
 void lcp_pivot_lumod_set_default(SolverOptions* options)
 {
   options->iparam[SICONOS_LCP_IPARAM_PIVOTING_METHOD_TYPE] = SICONOS_LCP_PIVOT_LEMKE;
+  options->iparam[SICONOS_LCP_IPARAM_PIVOT_LUMOD_MAXMOD] = 50;
 }
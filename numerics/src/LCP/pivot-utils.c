@@ -917,8 +917,9 @@ void do_pivot_lumod(SN_lumod_dense_data* restrict lumod_data, NumericsMatrix* re
   cblas_daxpy(n, -theta, col_drive, 1, q_tilde, 1);
   q_tilde[block] = theta;
 
-  /* Update the lexico_mat
+  /* Update the lexico_mat, if any
    * XXX check if this is correct. The value of the pivot may be wrong --xhub */
+  if(!lexico_mat) return;
   double pivot = col_drive[block];
   unsigned block_row_indx = block*n;
 
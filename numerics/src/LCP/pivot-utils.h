@@ -151,7 +151,8 @@ void do_pivot(double* mat, unsigned int dim, unsigned int dim2, unsigned int blo
  * \param lumod_data lumod data
  * \param M the LCP matrix
  * \param q_tilde the modified q vector: it is the current of the variables currently in the basis
- * \param lexico_mat matrix for the lexicographic ordering
+ * \param lexico_mat matrix for the lexicographic ordering (NULL if the
+ * lexicographic ordering is done with the LU factors of the basis)
  * \param col_drive column of the driving variable
  * \param col_tilde Solution to H x = col
  * \param basis current basis
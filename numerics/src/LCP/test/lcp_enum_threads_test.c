@@ -0,0 +1,108 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The same LCPs solved by the serial enumeration and with several threads.
+   With the deterministic option, the solution must be the one of the serial
+   enumeration; without it, any solution found must be a solution of the
+   LCP. Without OpenMP, the number of threads is ignored and all the solves
+   are serial. */
+
+#include <math.h>                         // for fabs
+#include <stdio.h>                        // for printf
+#include <stdlib.h>                       // for calloc, free, malloc
+#include "LCP_Solvers.h"                  // for lcp_compute_error
+#include "LinearComplementarityProblem.h" // for LinearComplementarityProblem
+#include "NonSmoothDrivers.h"             // for linearComplementarity_driver
+#include "SolverOptions.h"                // for SolverOptions, solver_opti...
+#include "lcp_cst.h"                      // for SICONOS_LCP_ENUM, SICONOS_...
+
+static int solve(LinearComplementarityProblem* problem, int n_threads, int deterministic,
+                 double * z, double * w)
+{
+  SolverOptions * options = solver_options_create(SICONOS_LCP_ENUM);
+  options->dparam[SICONOS_DPARAM_TOL] = 1e-12;
+  options->iparam[SICONOS_LCP_IPARAM_ENUM_NUMBER_OF_THREADS] = n_threads;
+  options->iparam[SICONOS_LCP_IPARAM_ENUM_DETERMINISTIC] = deterministic;
+  for(int i = 0; i < problem->size; i++)
+    z[i] = w[i] = 0.;
+  int info = linearComplementarity_driver(problem, z, w, options);
+  lcp_enum_reset(problem, options, 1);
+  solver_options_delete(options);
+  return info;
+}
+
+int main(void)
+{
+  int info = 0;
+  const char * files[5] = {"./data/lcp_deudeu.dat", "./data/lcp_ortiz.dat",
+                           "./data/lcp_CPS_3.dat", "./data/lcp_exp_murty.dat",
+                           "./data/lcp_enum_fails.dat"
+                          };
+  for(int k = 0; k < 5; k++)
+  {
+    LinearComplementarityProblem* problem =
+      (LinearComplementarityProblem *)malloc(sizeof(LinearComplementarityProblem));
+    linearComplementarity_newFromFilename(problem, files[k]);
+    int size = problem->size;
+    double * zref = (double *)calloc(size, sizeof(double));
+    double * wref = (double *)calloc(size, sizeof(double));
+    double * z = (double *)calloc(size, sizeof(double));
+    double * w = (double *)calloc(size, sizeof(double));
+
+    int info_ref = solve(problem, 1, 0, zref, wref);
+    for(int n_threads = 2; n_threads <= 4; n_threads++)
+    {
+      for(int deterministic = 0; deterministic < 2; deterministic++)
+      {
+        int info_k = solve(problem, n_threads, deterministic, z, w);
+        double error = 0.;
+        if(info_k != info_ref)
+        {
+          printf("%s, %i threads: info %i instead of %i\n", files[k], n_threads, info_k, info_ref);
+          info++;
+        }
+        else if(!info_k && lcp_compute_error(problem, z, w, 1e-10, &error))
+        {
+          printf("%s, %i threads: wrong solution, error = %e\n", files[k], n_threads, error);
+          info++;
+        }
+        else if(!info_k && deterministic)
+        {
+          for(int i = 0; i < size; i++)
+          {
+            if(fabs(z[i] - zref[i]) > 1e-12 || fabs(w[i] - wref[i]) > 1e-12)
+            {
+              printf("%s, %i threads: not the solution of the serial enumeration\n",
+                     files[k], n_threads);
+              info++;
+              break;
+            }
+          }
+        }
+      }
+    }
+    printf("%s: info = %i\n", files[k], info_ref);
+    free(zref);
+    free(wref);
+    free(z);
+    free(w);
+    freeLinearComplementarityProblem(problem);
+  }
+  printf("End of test, info = %i\n", info);
+  return info;
+}
@@ -0,0 +1,97 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The same LCP with a tridiagonal matrix is solved with SICONOS_LCP_PIVOT_LUMOD
+   from a dense and from a sparse matrix. The size of the problem is larger than
+   the maximum number of basis changes, hence the basis has to be refactorized
+   during the pivots. Both solutions must be the same. */
+
+#include <math.h>                          // for fabs
+#include <stdio.h>                         // for printf
+#include <stdlib.h>                        // for calloc, free, malloc
+#include "LCP_Solvers.h"                   // for lcp_compute_error
+#include "LinearComplementarityProblem.h"  // for LinearComplementarityProblem
+#include "NonSmoothDrivers.h"              // for linearComplementarity_driver
+#include "NumericsMatrix.h"                // for NM_create, NM_zentry, NM_...
+#include "SolverOptions.h"                 // for SolverOptions, solver_opt...
+#include "lcp_cst.h"                       // for SICONOS_LCP_PIVOT_LUMOD
+
+static LinearComplementarityProblem* tridiagonal_lcp(int n, NM_types storage)
+{
+  LinearComplementarityProblem* problem = newLCP();
+  problem->size = n;
+  problem->M = NM_create(storage, n, n);
+  if(storage == NM_SPARSE)
+    NM_triplet_alloc(problem->M, 3*n);
+  else
+    for(int i = 0; i < n*n; i++) problem->M->matrix0[i] = 0.;
+  problem->q = (double *)malloc(n * sizeof(double));
+  for(int i = 0; i < n; i++)
+  {
+    NM_zentry(problem->M, i, i, 4., 0.);
+    if(i > 0) NM_zentry(problem->M, i, i-1, -1., 0.);
+    if(i < n-1) NM_zentry(problem->M, i, i+1, -2., 0.);
+    problem->q[i] = (i % 3) - 1.5;
+  }
+  return problem;
+}
+
+static int solve(LinearComplementarityProblem* problem, double * z, double * w)
+{
+  double error = 0.;
+  SolverOptions* options = solver_options_create(SICONOS_LCP_PIVOT_LUMOD);
+  options->iparam[SICONOS_LCP_IPARAM_PIVOT_LUMOD_MAXMOD] = 20;
+  int info = linearComplementarity_driver(problem, z, w, options);
+  printf("storage %i: info = %i, %i pivots\n", problem->M->storageType, info,
+         options->iparam[SICONOS_IPARAM_ITER_DONE]);
+  solver_options_delete(options);
+  if(info)
+    return info;
+  return lcp_compute_error(problem, z, w, 1e-10, &error);
+}
+
+int main(void)
+{
+  int n = 200;
+  int info = 0;
+  LinearComplementarityProblem* dense = tridiagonal_lcp(n, NM_DENSE);
+  LinearComplementarityProblem* sparse = tridiagonal_lcp(n, NM_SPARSE);
+  double * z = (double *)calloc(4*n, sizeof(double));
+  double * w = z + n;
+  double * zs = z + 2*n;
+  double * ws = z + 3*n;
+
+  info += solve(dense, z, w);
+  info += solve(sparse, zs, ws);
+
+  for(int i = 0; i < n; i++)
+  {
+    if(fabs(z[i] - zs[i]) > 1e-10 || fabs(w[i] - ws[i]) > 1e-10)
+    {
+      printf("the dense and sparse solutions differ at %i: %e vs %e\n", i, z[i], zs[i]);
+      info++;
+      break;
+    }
+  }
+
+  freeLinearComplementarityProblem(dense);
+  freeLinearComplementarityProblem(sparse);
+  free(z);
+  printf("End of test, info = %i\n", info);
+  return info;
+}
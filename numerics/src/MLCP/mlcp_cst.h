@@ -28,6 +28,8 @@ enum SICONOS_IPARAM_MLCP
    SICONOS_IPARAM_MLCP_ENUM_USE_DGELS = 4, // activate to use dgels rather than dgesv in mlcp driver (enum only indeed)
    SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS = 5, // number of possible configurations
    SICONOS_IPARAM_MLCP_UPDATE_REQUIRED = 8, // true if the problem needs update
+   SICONOS_IPARAM_MLCP_ENUM_NUMBER_OF_THREADS = 9, // number of threads of the enumeration (needs OpenMP, 0 or 1 for the serial one, negative for the OpenMP default)
+   SICONOS_IPARAM_MLCP_ENUM_DETERMINISTIC = 10, // parallel enumeration returns the lowest index solution, as in the serial case
   };
 
 enum SICONOS_DPARAM_MLCP
@@ -31,6 +31,18 @@ dim(v)=nn
 * 1) The complementarity constraints hold --> Success.
 * 2) The complementarity constraints don't hold --> Failed.
 *
+* The configurations (which components of v are active) already met are
+* kept in a cache owned by the SolverOptions (options->solverData):
+* - they are chained in least recently used order, the last one that
+*   solved the problem being tried first, the oldest one being recycled
+*   when the cache is full;
+* - a hash table on the zw pattern gives the configuration matching the
+*   initial guess, and avoids storing twice the same configuration;
+* - the factorized linear system of each configuration is stored, and only
+*   recomputed when the matrix of the problem has changed.
+* The cache does not rely on any static data, hence two problems solved
+* with two different SolverOptions do not interfere.
+*
 **************************************************************************/
 
 #include "mlcp_direct.h"
@@ -39,6 +51,7 @@ dim(v)=nn
 #endif
 #include <stdio.h>                              // for printf
 #include <stdlib.h>                             // for malloc, exit, free
+#include <string.h>                             // for memcmp, memcpy
 #include "MLCP_Solvers.h"                       // for mlcp_direct, mlcp_dir...
 #include "MixedLinearComplementarityProblem.h"  // for MixedLinearComplement...
 #include "NumericsMatrix.h"                     // for NM_dense_display, Num...
@@ -56,346 +69,409 @@ dim(v)=nn
 
 
 #define DIRECT_SOLVER_USE_DGETRI
-double * sVBuf;
 
-struct dataComplementarityConf
+typedef struct mlcp_direct_config
 {
   int * zw; /*zw[i] == 0 means w null and z >=0*/
-  double * M;
-  struct dataComplementarityConf * next;
-  struct dataComplementarityConf * prev;
-  int Usable;
-  int used;
-  lapack_int* IPV;
-};
-
-static double * sp_curDouble = 0;
-static int * sp_curInt = 0;
-static double * sQ = 0;
-static int s_numberOfCC = 0;
-static int s_maxNumberOfCC = 0;
-static struct dataComplementarityConf * spFirstCC = 0;
-static struct dataComplementarityConf * sp_curCC = 0;
-static double sTolneg = 0;
-static double sTolpos = 0;
-static int s_n;
-static int s_m;
-static int s_nbLines;
-static int s_npM;
-static int* spIntBuf;
-static int sProblemChanged = 0;
-
-static double * mydMalloc(int n);
-static int * myiMalloc(int n);
-static int internalPrecompute(MixedLinearComplementarityProblem* problem);
-static int internalAddConfig(MixedLinearComplementarityProblem* problem, int * zw, int init);
-static int solveWithCurConfig(MixedLinearComplementarityProblem* problem);
-//static int nbConfig(struct dataComplementarityConf * pC);
-
-double * mydMalloc(int n)
+  double * M; /* factorized (or inverted) matrix of the configuration */
+  lapack_int * IPV;
+  unsigned int hash;
+  int usable;
+  unsigned long stamp; /* version of the problem matrix used to compute M */
+  struct mlcp_direct_config * next; /* less recently used */
+  struct mlcp_direct_config * prev; /* more recently used */
+  struct mlcp_direct_config * chain; /* next configuration in the same hash bucket */
+} mlcp_direct_config;
+
+typedef struct
 {
-  double * aux = sp_curDouble;
-  sp_curDouble = sp_curDouble + n;
-  return aux;
-}
-int * myiMalloc(int n)
+  int n;
+  int m;
+  int npM;
+  int capacity;
+  int size;
+  double tolneg;
+  double tolpos;
+  int check_update;
+  unsigned long version; /* incremented each time the problem matrix changes */
+  double * Mref; /* copy of the problem matrix, to detect changes */
+  double * Q;
+  double * sol;
+  int * zw;
+  mlcp_direct_config * first;
+  mlcp_direct_config * last;
+  mlcp_direct_config ** buckets;
+  unsigned int nbuckets; /* a power of 2 */
+} mlcp_direct_cache;
+
+/* FNV-1a hash of a complementarity pattern */
+static unsigned int mlcp_direct_hash(int * zw, int m)
 {
-  int * aux = sp_curInt;
-  sp_curInt = sp_curInt + n;
-  return aux;
+  unsigned int h = 2166136261u;
+  for(int i = 0; i < m; i++)
+  {
+    h ^= (unsigned int)(zw[i] != 0);
+    h *= 16777619u;
+  }
+  return h;
 }
-// XXX this is going to fail
-static lapack_int * myiMalloc2(int n)
+
+static mlcp_direct_config * mlcp_direct_find(mlcp_direct_cache * cache, int * zw, unsigned int hash)
 {
-  lapack_int * aux = (lapack_int*)sp_curInt;
-  sp_curInt = (int*)&aux[n];
-  return aux;
+  mlcp_direct_config * c = cache->buckets[hash & (cache->nbuckets - 1)];
+  for(; c; c = c->chain)
+  {
+    if(c->hash == hash && !memcmp(c->zw, zw, cache->m * sizeof(int)))
+      return c;
+  }
+  return NULL;
 }
 
-int mlcp_direct_getNbIWork(MixedLinearComplementarityProblem* problem, SolverOptions* options)
+static void mlcp_direct_hash_remove(mlcp_direct_cache * cache, mlcp_direct_config * cfg)
 {
-  return (problem->n + problem->m) * (options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS] + 1)
-    + options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS] * problem->m;
+  mlcp_direct_config ** c = &cache->buckets[cfg->hash & (cache->nbuckets - 1)];
+  while(*c != cfg)
+    c = &(*c)->chain;
+  *c = cfg->chain;
+  cfg->chain = NULL;
 }
 
-int mlcp_direct_getNbDWork(MixedLinearComplementarityProblem* problem, SolverOptions* options)
+static void mlcp_direct_hash_insert(mlcp_direct_cache * cache, mlcp_direct_config * cfg)
 {
-  return  problem->n + problem->m
-    + (options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS]) * ((problem->n + problem->m) * (problem->n + problem->m))
-    + (problem->n + problem->m);
+  mlcp_direct_config ** b = &cache->buckets[cfg->hash & (cache->nbuckets - 1)];
+  cfg->chain = *b;
+  *b = cfg;
 }
 
-void mlcp_direct_init(MixedLinearComplementarityProblem* problem, SolverOptions* options)
+static void mlcp_direct_unlink(mlcp_direct_cache * cache, mlcp_direct_config * cfg)
 {
-  sp_curDouble = options->dWork;
-  sp_curInt = options->iWork;
-  s_maxNumberOfCC = options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS];
-  sTolneg = options->dparam[SICONOS_DPARAM_MLCP_SIGN_TOL_NEG];
-  sTolpos = options->dparam[SICONOS_DPARAM_MLCP_SIGN_TOL_POS];
-  options->iparam[7] = 0;
-  sProblemChanged = options->iparam[SICONOS_IPARAM_MLCP_UPDATE_REQUIRED];
-  s_n = problem->n;
-  s_m = problem->m;
-  s_nbLines = problem->n + problem->m;
-  if(problem->M->size0 != s_nbLines)
-  {
-    printf("mlcp_direct_init : M rectangular, not yet managed\n");
-    exit(1);
-  }
-
-  if(verbose)
-    printf("n= %d  m= %d /n sTolneg= %lf sTolpos= %lf \n", s_n, s_m, sTolneg, sTolpos);
+  if(cfg->prev)
+    cfg->prev->next = cfg->next;
+  else
+    cache->first = cfg->next;
+  if(cfg->next)
+    cfg->next->prev = cfg->prev;
+  else
+    cache->last = cfg->prev;
+  cfg->prev = cfg->next = NULL;
+}
 
-  s_npM = s_n + s_m;
+static void mlcp_direct_push_front(mlcp_direct_cache * cache, mlcp_direct_config * cfg)
+{
+  cfg->prev = NULL;
+  cfg->next = cache->first;
+  if(cache->first)
+    cache->first->prev = cfg;
+  else
+    cache->last = cfg;
+  cache->first = cfg;
+}
 
-  // If the problem comes from the kernel (dynamical systems)
-  // Then update is needed but no reset of the previous solutions
-  // (This avoids some memory loss by the way)
-  if(options->iparam[SICONOS_IPARAM_MLCP_UPDATE_REQUIRED]==0)
+static void mlcp_direct_cache_clear(mlcp_direct_cache * cache)
+{
+  mlcp_direct_config * c = cache->first;
+  while(c)
   {
-    sp_curCC = 0;
-    spFirstCC = 0;
-    s_numberOfCC = 0;
+    mlcp_direct_config * aux = c->next;
+    free(c->zw);
+    free(c->M);
+    free(c->IPV);
+    free(c);
+    c = aux;
   }
+  cache->first = cache->last = NULL;
+  cache->size = 0;
+  for(unsigned int b = 0; b < cache->nbuckets; b++)
+    cache->buckets[b] = NULL;
+}
 
-  sQ = mydMalloc(s_npM);
-  sVBuf = mydMalloc(s_npM);
-  spIntBuf = myiMalloc(s_npM);
+static void mlcp_direct_cache_free(mlcp_direct_cache * cache)
+{
+  mlcp_direct_cache_clear(cache);
+  free(cache->buckets);
+  free(cache->Mref);
+  free(cache->Q);
+  free(cache->sol);
+  free(cache->zw);
+  free(cache);
 }
 
-void mlcp_direct_reset()
+static mlcp_direct_cache * mlcp_direct_cache_new(int n, int m, int capacity)
 {
-  struct dataComplementarityConf * aux;
-  while(spFirstCC)
+  mlcp_direct_cache * cache = (mlcp_direct_cache *)calloc(1, sizeof(mlcp_direct_cache));
+  cache->n = n;
+  cache->m = m;
+  cache->npM = n + m;
+  cache->capacity = capacity;
+  cache->nbuckets = 8;
+  while(cache->nbuckets < 2 * (unsigned int)capacity)
+    cache->nbuckets *= 2;
+  cache->buckets = (mlcp_direct_config **)calloc(cache->nbuckets, sizeof(mlcp_direct_config *));
+  cache->Mref = (double *)malloc(cache->npM * cache->npM * sizeof(double));
+  cache->Q = (double *)malloc(cache->npM * sizeof(double));
+  cache->sol = (double *)malloc(cache->npM * sizeof(double));
+  cache->zw = (int *)malloc((m > 0 ? m : 1) * sizeof(int));
+  return cache;
+}
+
+/* Keep track of the changes of the problem matrix: the stored
+   factorizations are only recomputed when it has been modified. */
+static void mlcp_direct_check_matrix(mlcp_direct_cache * cache, MixedLinearComplementarityProblem* problem)
+{
+  size_t size = (size_t)cache->npM * cache->npM;
+  if(memcmp(cache->Mref, problem->M->matrix0, size * sizeof(double)))
   {
-    aux = spFirstCC;
-    spFirstCC = spFirstCC->next;
-    free(aux);
+    memcpy(cache->Mref, problem->M->matrix0, size * sizeof(double));
+    cache->version++;
   }
 }
 
-int internalPrecompute(MixedLinearComplementarityProblem* problem)
+static int mlcp_direct_factorize(mlcp_direct_cache * cache, mlcp_direct_config * cfg, MixedLinearComplementarityProblem* problem)
 {
   lapack_int INFO = 0;
-  mlcp_enum_build_M(spFirstCC->zw, spFirstCC->M, problem->M->matrix0, s_n, s_m, s_nbLines);
+  int npM = cache->npM;
+  cfg->stamp = cache->version;
+  cfg->usable = 1;
+  mlcp_enum_build_M(cfg->zw, cfg->M, problem->M->matrix0, cache->n, cache->m, npM);
   if(verbose)
   {
     printf("mlcp_direct, precomputed M :\n");
-    NM_dense_display(spFirstCC->M, s_npM, s_npM, 0);
+    NM_dense_display(cfg->M, npM, npM, 0);
   }
-  if(!(spFirstCC->Usable))
-    return 0;
-  DGETRF(s_npM, s_npM, spFirstCC->M, s_npM, spFirstCC->IPV, &INFO);
+  DGETRF(npM, npM, cfg->M, npM, cfg->IPV, &INFO);
   if(INFO)
   {
-    spFirstCC->Usable = 0;
-    printf("mlcp_direct, internalPrecompute  error, LU impossible\n");
+    cfg->usable = 0;
+    numerics_printf_verbose(1, "mlcp_direct, factorization error, LU impossible");
     return 0;
   }
 #ifdef DIRECT_SOLVER_USE_DGETRI
-  DGETRI(s_npM, spFirstCC->M, s_npM, spFirstCC->IPV, &INFO);
+  DGETRI(npM, cfg->M, npM, cfg->IPV, &INFO);
   if(INFO)
   {
-    spFirstCC->Usable = 1;
-    printf("mlcp_direct error, internalPrecompute  DGETRI impossible\n");
+    cfg->usable = 0;
+    numerics_printf_verbose(1, "mlcp_direct, factorization error, DGETRI impossible");
     return 0;
   }
 #endif
   return 1;
 }
 
-/*memory management about floatWorkingMem and intWorkingMem*/
-int internalAddConfig(MixedLinearComplementarityProblem* problem, int * zw, int init)
+int mlcp_direct_getNbIWork(MixedLinearComplementarityProblem* problem, SolverOptions* options)
 {
-  if(verbose)
+  /* the configuration cache owns its memory */
+  return 0;
+}
+
+int mlcp_direct_getNbDWork(MixedLinearComplementarityProblem* problem, SolverOptions* options)
+{
+  /* the configuration cache owns its memory */
+  return 0;
+}
+
+void mlcp_direct_init(MixedLinearComplementarityProblem* problem, SolverOptions* options)
+{
+  int n = problem->n;
+  int m = problem->m;
+  int capacity = options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS];
+  mlcp_direct_cache * cache = (mlcp_direct_cache *)options->solverData;
+
+  options->iparam[7] = 0;
+  if(problem->M->size0 != n + m)
   {
-    printf("mlcp_direct internalAddConfig\n");
-    printf("---------\n");
-    for(int i = 0; i < problem->m; i++)
-      printf("zw[%d]=%d\t", i, zw[i]);
-    printf("\n");
+    printf("mlcp_direct_init : M rectangular, not yet managed\n");
+    exit(1);
+  }
+  if(capacity < 1)
+    capacity = 1;
+
+  // If the problem comes from the kernel (dynamical systems)
+  // Then update is needed but no reset of the previous solutions,
+  // unless the size of the problem has changed.
+  if(cache && (!options->iparam[SICONOS_IPARAM_MLCP_UPDATE_REQUIRED]
+               || cache->n != n || cache->m != m || cache->capacity != capacity))
+  {
+    mlcp_direct_cache_free(cache);
+    cache = NULL;
   }
-  if(init)
+  if(!cache)
   {
-    spFirstCC->zw = myiMalloc(s_m);
-    spFirstCC->IPV = myiMalloc2(s_npM);
-    spFirstCC->M = mydMalloc(s_npM * s_npM);
+    cache = mlcp_direct_cache_new(n, m, capacity);
+    options->solverData = cache;
   }
-  for(int i = 0; i < s_m; i++)
+  cache->tolneg = options->dparam[SICONOS_DPARAM_MLCP_SIGN_TOL_NEG];
+  cache->tolpos = options->dparam[SICONOS_DPARAM_MLCP_SIGN_TOL_POS];
+  cache->check_update = options->iparam[SICONOS_IPARAM_MLCP_UPDATE_REQUIRED];
+  mlcp_direct_check_matrix(cache, problem);
+
+  if(verbose)
+    printf("n= %d  m= %d /n sTolneg= %lf sTolpos= %lf \n", n, m, cache->tolneg, cache->tolpos);
+}
+
+void mlcp_direct_reset(SolverOptions* options)
+{
+  if(options->solverData)
   {
-    spFirstCC->zw[i] = zw[i];
+    mlcp_direct_cache_free((mlcp_direct_cache *)options->solverData);
+    options->solverData = NULL;
   }
-  return internalPrecompute(problem);
 }
-/*memory management about dataComplementarityConf*/
-void mlcp_direct_addConfig(MixedLinearComplementarityProblem* problem, int * zw)
+
+void mlcp_direct_addConfig(MixedLinearComplementarityProblem* problem, int * zw, SolverOptions* options)
 {
-  if(s_numberOfCC < s_maxNumberOfCC)  /*Add a configuration*/
+  mlcp_direct_cache * cache = (mlcp_direct_cache *)options->solverData;
+  mlcp_direct_config * cfg;
+  int npM;
+  unsigned int hash;
+  if(!cache)
+    return;
+  npM = cache->npM;
+  if(verbose)
   {
-    s_numberOfCC++;
-    if(spFirstCC == 0)  /*first add*/
-    {
-      spFirstCC = (struct dataComplementarityConf *) malloc(sizeof(struct dataComplementarityConf));
-      spFirstCC->Usable = 1;
-      sp_curCC = spFirstCC;
-      spFirstCC->prev = 0;
-      spFirstCC->next = 0;
-    }
-    else
-    {
-      spFirstCC->prev = (struct dataComplementarityConf *) malloc(sizeof(struct dataComplementarityConf));
-      spFirstCC->prev->Usable = 1;
-      spFirstCC->prev->next = spFirstCC;
-      spFirstCC = spFirstCC->prev;
-      spFirstCC->prev = 0;
-    }
-    internalAddConfig(problem, zw, 1);
+    printf("mlcp_direct addConfig\n");
+    printf("---------\n");
+    for(int i = 0; i < cache->m; i++)
+      printf("zw[%d]=%d\t", i, zw[i]);
+    printf("\n");
   }
-  else /*Replace an old one*/
+  hash = mlcp_direct_hash(zw, cache->m);
+  cfg = mlcp_direct_find(cache, zw, hash);
+  if(cfg)  /*Already known: becomes the most recently used*/
   {
-    struct dataComplementarityConf * aux = spFirstCC;
-    while(aux->next) aux = aux->next;
-    if(aux->prev)
-    {
-      aux->prev->next = 0;
-      spFirstCC->prev = aux;
-      aux->prev = 0;
-      aux->next = spFirstCC;
-      spFirstCC = aux;
-      spFirstCC->Usable = 1;
-    }
-    internalAddConfig(problem, zw, 0);
+    mlcp_direct_unlink(cache, cfg);
+    mlcp_direct_push_front(cache, cfg);
+    if(cfg->stamp != cache->version)
+      mlcp_direct_factorize(cache, cfg, problem);
+    return;
   }
+  if(cache->size < cache->capacity)  /*Add a configuration*/
+  {
+    cfg = (mlcp_direct_config *)calloc(1, sizeof(mlcp_direct_config));
+    cfg->zw = (int *)malloc((cache->m > 0 ? cache->m : 1) * sizeof(int));
+    cfg->M = (double *)malloc(npM * npM * sizeof(double));
+    cfg->IPV = (lapack_int *)malloc(npM * sizeof(lapack_int));
+    cache->size++;
+  }
+  else /*Replace the least recently used one*/
+  {
+    cfg = cache->last;
+    mlcp_direct_unlink(cache, cfg);
+    mlcp_direct_hash_remove(cache, cfg);
+  }
+  for(int i = 0; i < cache->m; i++)
+    cfg->zw[i] = zw[i] ? 1 : 0;
+  cfg->hash = hash;
+  mlcp_direct_hash_insert(cache, cfg);
+  mlcp_direct_push_front(cache, cfg);
+  mlcp_direct_factorize(cache, cfg, problem);
 }
-void mlcp_direct_addConfigFromWSolution(MixedLinearComplementarityProblem* problem, double * wSol)
-{
-  int i;
 
-  for(i = 0; i < s_m; i++)
+/* Fill cache->zw with the complementarity pattern of w */
+static void mlcp_direct_pattern(mlcp_direct_cache * cache, double * w)
+{
+  for(int i = 0; i < cache->m; i++)
   {
-    if(wSol[i] > sTolpos)
-      spIntBuf[i] = 1;
+    if(w[i] > cache->tolpos)
+      cache->zw[i] = 1;
     else
-      spIntBuf[i] = 0;
+      cache->zw[i] = 0;
   }
-  mlcp_direct_addConfig(problem, spIntBuf);
 }
 
+void mlcp_direct_addConfigFromWSolution(MixedLinearComplementarityProblem* problem, double * wSol, SolverOptions* options)
+{
+  mlcp_direct_cache * cache = (mlcp_direct_cache *)options->solverData;
+  if(!cache)
+    return;
+  mlcp_direct_pattern(cache, wSol);
+  mlcp_direct_addConfig(problem, cache->zw, options);
+}
 
-
-int solveWithCurConfig(MixedLinearComplementarityProblem* problem)
+static int solveWithConfig(mlcp_direct_cache * cache, mlcp_direct_config * cfg, MixedLinearComplementarityProblem* problem)
 {
   int lin;
   lapack_int INFO = 0;
-  double ALPHA = 1;
-  double BETA = 0;
-  int INCX = 1;
-  int INCY = 1;
-  double * solTest = 0;
-  /*  printf("cur config ");
-  for (int i=0;i<s_m;i++)
-    if (sp_curCC->zw[i])
-      printf("1");
-    else
-      printf("0");
-      printf("\n");*/
-  if(sProblemChanged)
-    internalPrecompute(problem);
-  if(!sp_curCC->Usable)
+  int npM = cache->npM;
+  if(cfg->stamp != cache->version)
+    mlcp_direct_factorize(cache, cfg, problem);
+  if(!cfg->usable)
   {
     if(verbose)
-      printf("solveWithCurConfig not usable\n");
+      printf("solveWithConfig not usable\n");
     return 0;
   }
 #ifdef DIRECT_SOLVER_USE_DGETRI
-  cblas_dgemv(CblasColMajor,CblasNoTrans, s_npM, s_npM, ALPHA, sp_curCC->M, s_npM, sQ, INCX, BETA, sVBuf, INCY);
-  solTest = sVBuf;
+  cblas_dgemv(CblasColMajor,CblasNoTrans, npM, npM, 1.0, cfg->M, npM, cache->Q, 1, 0.0, cache->sol, 1);
 #else
-  for(lin = 0; lin < s_npM; lin++)
-    sQ[lin] =  - problem->q[lin];
-  DGETRS(LA_NOTRANS, s_npM, one, sp_curCC->M, s_npM, sp_curCC->IPV, sQ, s_npM, &INFO);
-  solTest = sQ;
+  for(lin = 0; lin < npM; lin++)
+    cache->sol[lin] = cache->Q[lin];
+  DGETRS(LA_NOTRANS, npM, 1, cfg->M, npM, cfg->IPV, cache->sol, npM, &INFO);
 #endif
   if(INFO)
   {
     if(verbose)
-      printf("solveWithCurConfig DGETRS failed\n");
+      printf("solveWithConfig DGETRS failed\n");
     return 0;
   }
-  else
+  for(lin = 0 ; lin < cache->m; lin++)
   {
-    for(lin = 0 ; lin < s_m; lin++)
+    if(cache->sol[cache->n + lin] < - cache->tolneg)
     {
-      if(solTest[s_n + lin] < - sTolneg)
-      {
-        if(verbose)
-          printf("solveWithCurConfig Sol not in the positive cone because %lf\n", solTest[s_n + lin]);
-        return 0;
-      }
+      if(verbose)
+        printf("solveWithConfig Sol not in the positive cone because %lf\n", cache->sol[cache->n + lin]);
+      return 0;
     }
   }
-  /*  if (verbose)
-      printf("solveWithCurConfig Success\n");*/
   return 1;
 }
 
 void mlcp_direct(MixedLinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options)
 {
+  mlcp_direct_cache * cache = (mlcp_direct_cache *)options->solverData;
+  mlcp_direct_config * guess = NULL;
+  mlcp_direct_config * cfg;
   int find = 0;
-  int lin = 0;
-  if(!spFirstCC)
+  if(!cache || !cache->first)
   {
     (*info) = 1;
+    return;
   }
-  else
-  {
-    sp_curCC = spFirstCC;
-#ifdef DIRECT_SOLVER_USE_DGETRI
-    for(lin = 0; lin < s_npM; lin++)
-      sQ[lin] =  - problem->q[lin];
-#endif
-    do
-    {
-      find = solveWithCurConfig(problem);
-      if(find)
-      {
-#ifdef DIRECT_SOLVER_USE_DGETRI
-        mlcp_enum_fill_solution(z, z + s_n, w, w + s_n, s_n, s_m, s_nbLines, sp_curCC->zw, sVBuf);
-#else
-        mlcp_enum_fill_solution(z, z + s_n, w, w + s_n, s_n, s_m, s_nbLines, sp_curCC->zw, sQ);
-#endif
-        /*Current becomes first for the next step.*/
-        if(sp_curCC != spFirstCC)
-        {
-          /*    nbConfig(spFirstCC);
-          nbConfig(sp_curCC);
-          printf("bidouille pour devenir 1\n");*/
-          sp_curCC->prev->next = sp_curCC->next;
-          if(sp_curCC->next)
-            sp_curCC->next->prev = sp_curCC->prev;
-          spFirstCC->prev = sp_curCC;
-          sp_curCC->next = spFirstCC;
-          spFirstCC = sp_curCC;
-          spFirstCC->prev = 0;
-          /*    nbConfig(spFirstCC);*/
-        }
-      }
-      else
-      {
-        sp_curCC = sp_curCC->next;
-      }
-    }
-    while(sp_curCC && !find);
+  if(cache->check_update)
+    mlcp_direct_check_matrix(cache, problem);
+
+  for(int lin = 0; lin < cache->npM; lin++)
+    cache->Q[lin] =  - problem->q[lin];
 
+  /*The configuration of the initial guess is tried first, then the
+    others from the most to the least recently used.*/
+  mlcp_direct_pattern(cache, w + cache->n);
+  guess = mlcp_direct_find(cache, cache->zw, mlcp_direct_hash(cache->zw, cache->m));
+  cfg = guess ? guess : cache->first;
+  while(cfg)
+  {
+    find = solveWithConfig(cache, cfg, problem);
     if(find)
+      break;
+    cfg = (cfg == guess) ? cache->first : cfg->next;
+    if(cfg && cfg == guess)
+      cfg = cfg->next;
+  }
+
+  if(find)
+  {
+    mlcp_enum_fill_solution(z, z + cache->n, w, w + cache->n, cache->n, cache->m, cache->npM, cfg->zw, cache->sol);
+    /*Current becomes first for the next step.*/
+    if(cfg != cache->first)
     {
-      *info = 0;
-    }
-    else
-    {
-      options->iparam[7]++;
-      *info = 1;
+      mlcp_direct_unlink(cache, cfg);
+      mlcp_direct_push_front(cache, cfg);
     }
+    *info = 0;
+  }
+  else
+  {
+    options->iparam[7]++;
+    *info = 1;
   }
 }
 
@@ -8,14 +8,17 @@
  * add configuration with mlcp_direct_addConfigFromWSolution to add configuration.
  * mlcp_direct_reset
  *
+ * The configurations are stored in a cache attached to options->solverData,
+ * of size options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS].
+ * It is released by mlcp_direct_reset, or by solver_options_delete.
  */
 
 #include "NumericsFwd.h"  // for MixedLinearComplementarityProblem, SolverOp...
 
-void mlcp_direct_addConfig(MixedLinearComplementarityProblem* problem, int * zw);
-void mlcp_direct_addConfigFromWSolution(MixedLinearComplementarityProblem* problem, double * wSol);
+void mlcp_direct_addConfig(MixedLinearComplementarityProblem* problem, int * zw, SolverOptions* options);
+void mlcp_direct_addConfigFromWSolution(MixedLinearComplementarityProblem* problem, double * wSol, SolverOptions* options);
 void mlcp_direct_init(MixedLinearComplementarityProblem* problem, SolverOptions* options);
-void mlcp_direct_reset(void);
+void mlcp_direct_reset(SolverOptions* options);
 
 int mlcp_direct_getNbIWork(MixedLinearComplementarityProblem* problem, SolverOptions* options);
 int mlcp_direct_getNbDWork(MixedLinearComplementarityProblem* problem, SolverOptions* options);
@@ -33,8 +33,6 @@ dim(v)=nn
 #include "mlcp_FB.h"                            // for mlcp_FB_getNbDWork
 #include "mlcp_direct.h"                        // for mlcp_direct_getNbDWork
 
-static int sN;
-static int sM;
 
 static int * siWorkFB = 0;
 static int * siWorkDirect = 0;
@@ -55,8 +53,6 @@ int mlcp_direct_FB_getNbDWork(MixedLinearComplementarityProblem* problem, Solver
 
 void mlcp_direct_FB_init(MixedLinearComplementarityProblem* problem, SolverOptions* options)
 {
-  sN = problem->n;
-  sM = problem->m;
   int iOffset = mlcp_direct_getNbIWork(problem, options);
   int dOffset = mlcp_direct_getNbDWork(problem, options);
   siWorkFB = options->iWork + iOffset;
@@ -74,9 +70,9 @@ void mlcp_direct_FB_init(MixedLinearComplementarityProblem* problem, SolverOptio
 
 
 }
-void mlcp_direct_FB_reset()
+void mlcp_direct_FB_reset(SolverOptions* options)
 {
-  mlcp_direct_reset();
+  mlcp_direct_reset(options);
   mlcp_FB_reset();
 }
 
@@ -93,7 +89,7 @@ void mlcp_direct_FB(MixedLinearComplementarityProblem* problem, double *z, doubl
       /*       for (i=0;i<problem->n+problem->m;i++){ */
       /*  printf("w[%d]=%f z[%d]=%f\t",i,w[i],i,z[i]);  */
       /*       } */
-      mlcp_direct_addConfigFromWSolution(problem, w + sN);
+      mlcp_direct_addConfigFromWSolution(problem, w + problem->n, options);
     }
   }
 }
@@ -41,63 +41,44 @@ dim(v)=nn
 /* #define DEBUG_MESSAGES */
 #include "siconos_debug.h"
 
-static int sN;
-static int sM;
-
-static int * siWorkEnum = 0;
-static int * siWorkDirect = 0;
-static double * sdWorkEnum = 0;
-static double * sdWorkDirect = 0;
 
 void mlcp_direct_enum_init(MixedLinearComplementarityProblem* problem, SolverOptions* options)
 {
-  sN = problem->n;
-  sM = problem->m;
-  int iOffset = mlcp_direct_getNbIWork(problem, options);
-  int dOffset = mlcp_direct_getNbDWork(problem, options);
-  siWorkEnum = options->iWork + iOffset;
-  siWorkDirect = options->iWork;
-  sdWorkEnum = options->dWork + dOffset;
-  sdWorkDirect = options->dWork;
   mlcp_direct_init(problem, options);
-
 }
-void mlcp_direct_enum_reset()
+void mlcp_direct_enum_reset(SolverOptions* options)
 {
-  mlcp_direct_reset();
-  siWorkEnum = 0;
-  siWorkDirect = 0;
-  sdWorkEnum = 0;
-  sdWorkDirect = 0;
+  mlcp_direct_reset(options);
 }
 
 void mlcp_direct_enum(MixedLinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options)
 {
   DEBUG_BEGIN("mlcp_direct_enum(...)\n");
   DEBUG_PRINTF("options->iWork = %p\n",  options->iWork);
-  if(!siWorkEnum)
+  if(!options->solverData)
   {
     *info = 1;
     numerics_printf_verbose(0,"MLCP_DIRECT_ENUM error, call a non initialised method!!!!!!!!!!!!!!!!!!!!!\n");
     return;
   }
   /*First, try direct solver*/
-  options->dWork = sdWorkDirect;
-  options->iWork = siWorkDirect;
   mlcp_direct(problem, z, w, info, options);
   if(*info)
   {
     DEBUG_PRINT("Solver direct failed, so run the enum solver\n");
-    options->dWork = sdWorkEnum;
-    options->iWork = siWorkEnum;
+    /* The enum solver works after the memory of the direct solver */
+    double * dWorkDirect = options->dWork;
+    int * iWorkDirect = options->iWork;
+    options->dWork = dWorkDirect + mlcp_direct_getNbDWork(problem, options);
+    options->iWork = iWorkDirect + mlcp_direct_getNbIWork(problem, options);
     mlcp_enum(problem, z, w, info, options);
     if(!(*info))
     {
-      mlcp_direct_addConfigFromWSolution(problem, w + sN);
+      mlcp_direct_addConfigFromWSolution(problem, w + problem->n, options);
     }
     /* Come back to previous memory adress to ensure correct freeing */
-    options->dWork = sdWorkDirect;
-    options->iWork = siWorkDirect;
+    options->dWork = dWorkDirect;
+    options->iWork = iWorkDirect;
   }
   DEBUG_PRINTF("options->iWork = %p\n",  options->iWork);
   DEBUG_END("mlcp_direct_enum(...)\n");
@@ -110,6 +91,8 @@ void mlcp_direct_enum_set_default(SolverOptions* options)
   options->dparam[SICONOS_DPARAM_MLCP_SIGN_TOL_NEG] = 1e-12;
   options->iparam[SICONOS_IPARAM_MLCP_NUMBER_OF_CONFIGURATIONS] = 3;
   options->iparam[SICONOS_IPARAM_MLCP_UPDATE_REQUIRED] = 0;
+  options->iparam[SICONOS_IPARAM_MLCP_ENUM_NUMBER_OF_THREADS] = 1;
+  options->iparam[SICONOS_IPARAM_MLCP_ENUM_DETERMINISTIC] = 0;
   options->filterOn = false;
 
 }
@@ -21,21 +21,17 @@
 #include "MixedLinearComplementarityProblem.h"  // for MixedLinearComplement...
 #include "mlcp_direct.h"                        // for mlcp_direct_addConfig...
 
-static int sN;
-static int sM;
 
 
 void mlcp_direct_path_init(MixedLinearComplementarityProblem* problem, SolverOptions* options)
 {
-  sN = problem->n;
-  sM = problem->m;
   mlcp_direct_init(problem, options);
   //mlcp_path_init(problem, options);
 
 }
-void mlcp_direct_path_reset()
+void mlcp_direct_path_reset(SolverOptions* options)
 {
-  mlcp_direct_reset();
+  mlcp_direct_reset(options);
   //mlcp_path_reset();
 }
 
@@ -52,7 +48,7 @@ void mlcp_direct_path(MixedLinearComplementarityProblem* problem, double *z, dou
       /*       for (i=0;i<problem->n+problem->m;i++){ */
       /*  printf("w[%d]=%f z[%d]=%f\t",i,w[i],i,z[i]);  */
       /*       } */
-      mlcp_direct_addConfigFromWSolution(problem, w + sN);
+      mlcp_direct_addConfigFromWSolution(problem, w + problem->n, options);
     }
   }
 }
@@ -33,8 +33,6 @@ dim(v)=nn
 #include "mlcp_direct.h"                        // for mlcp_direct_getNbDWork
 #include "mlcp_path_enum.h"                     // for mlcp_path_enum, mlcp_...
 
-static int sN;
-static int sM;
 
 static int * siWorkPathEnum = 0;
 static int * siWorkDirect = 0;
@@ -43,8 +41,6 @@ static double * sdWorkDirect = 0;
 
 void mlcp_direct_path_enum_init(MixedLinearComplementarityProblem* problem, SolverOptions* options)
 {
-  sN = problem->n;
-  sM = problem->m;
   int iOffset = mlcp_direct_getNbIWork(problem, options);
   int dOffset = mlcp_direct_getNbDWork(problem, options);
   siWorkPathEnum = options->iWork + iOffset;
@@ -57,9 +53,9 @@ void mlcp_direct_path_enum_init(MixedLinearComplementarityProblem* problem, Solv
   mlcp_path_enum_init(problem, options);
 
 }
-void mlcp_direct_path_enum_reset()
+void mlcp_direct_path_enum_reset(SolverOptions* options)
 {
-  mlcp_direct_reset();
+  mlcp_direct_reset(options);
   mlcp_path_enum_reset();
   siWorkPathEnum = 0;
   siWorkDirect = 0;
@@ -87,7 +83,7 @@ void mlcp_direct_path_enum(MixedLinearComplementarityProblem* problem, double *z
     mlcp_path_enum(problem, z, w, info, options);
     if(!(*info))
     {
-      mlcp_direct_addConfigFromWSolution(problem, w + sN);
+      mlcp_direct_addConfigFromWSolution(problem, w + problem->n, options);
     }
   }
 }
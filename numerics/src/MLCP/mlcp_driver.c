@@ -174,22 +174,22 @@ void mlcp_driver_reset(MixedLinearComplementarityProblem* problem, SolverOptions
   switch(options->solverId)
   {
   case SICONOS_MLCP_DIRECT_ENUM :
-    mlcp_direct_enum_reset();
+    mlcp_direct_enum_reset(options);
     break;
   case SICONOS_MLCP_DIRECT_PATH_ENUM :
-    mlcp_direct_path_enum_reset();
+    mlcp_direct_path_enum_reset(options);
     break;
   case SICONOS_MLCP_PATH_ENUM :
     mlcp_path_enum_reset();
     break;
   case SICONOS_MLCP_DIRECT_SIMPLEX :
-    mlcp_direct_simplex_reset();
+    mlcp_direct_simplex_reset(options);
     break;
   case SICONOS_MLCP_DIRECT_PATH :
-    mlcp_direct_path_reset();
+    mlcp_direct_path_reset(options);
     break;
   case SICONOS_MLCP_DIRECT_FB :
-    mlcp_direct_FB_reset();
+    mlcp_direct_FB_reset(options);
     break;
   case SICONOS_MLCP_SIMPLEX :
     mlcp_simplex_reset();
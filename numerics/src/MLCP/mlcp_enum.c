@@ -33,7 +33,11 @@ dim(v)=nn
 #include <stdbool.h>                       // for false
 #endif
 #include <stdio.h>                              // for printf
+#include <stdlib.h>                             // for malloc, free
 #include <string.h>                             // for memcpy
+#ifdef _OPENMP
+#include <omp.h>                                // for omp_get_max_threads
+#endif
 
 #include "MLCP_Solvers.h"                       // for mlcp_compute_error
 #include "MixedLinearComplementarityProblem.h"  // for MixedLinearComplement...
@@ -235,6 +239,7 @@ static void mlcp_enum_block(MixedLinearComplementarityProblem* problem, double *
         // options->iparam[1]=scurrent-1;
         numerics_printf_verbose(1,"mlcp_enum_block END");
         options->dparam[SICONOS_DPARAM_RESIDU] = err;
+        free(enum_struct);
         return;
       }
     }
@@ -246,6 +251,7 @@ static void mlcp_enum_block(MixedLinearComplementarityProblem* problem, double *
     }
   }
   *info = 1;
+  free(enum_struct);
   numerics_printf_verbose(1,"mlcp_enum_block failed!\n");
   DEBUG_END(" mlcp_enum_block(...)\n");
 }
@@ -277,10 +283,191 @@ int mlcp_enum_getNbDWork(MixedLinearComplementarityProblem* problem, SolverOptio
   return LWORK + 3 * (problem->M->size0) + (problem->n + problem->m) * (problem->M->size0);
 }
 
+/* Solve the linear system of the complementarity pattern zw_indices, and
+   if its solution lies in the cone, fill (z, w) with it.
+   Return 1 if (z, w) is a solution of the problem. */
+static int mlcp_enum_try(MixedLinearComplementarityProblem* problem, int * zw_indices,
+                         double * M_linear_system, double * q_linear_system,
+                         double * q_linear_system_ref, lapack_int * ipiv,
+                         int useDGELS, double tol, double * z, double * w)
+{
+  int npm = (problem->n) + (problem->m);
+  int n_row = problem->M->size0;
+  int n  = problem->n;
+  int m = problem->m;
+  int NRHS = 1;
+  lapack_int LAinfo = 0;
+
+  mlcp_enum_build_M(zw_indices, M_linear_system, problem->M->matrix0, n, m, n_row);
+
+  /* copy q_ref in q */
+  memcpy(q_linear_system, q_linear_system_ref, n_row * sizeof(double));
+
+  if(verbose > 1)
+    print_current_system(problem, M_linear_system, q_linear_system);
+
+  if(useDGELS)
+  {
+    DGELS(LA_NOTRANS,n_row, npm, NRHS, M_linear_system, n_row, q_linear_system, n_row, &LAinfo);
+    numerics_printf_verbose(1,"Solution of dgels\n");
+    if(verbose > 1)
+    {
+      NM_dense_display(q_linear_system, n_row, 1, 0);
+    }
+  }
+  else
+  {
+    DGESV(npm, NRHS, M_linear_system, npm, ipiv, q_linear_system, npm, &LAinfo);
+    numerics_printf_verbose(1,"Solution of dgesv\n");
+    if(verbose > 1)
+    {
+      NM_dense_display(q_linear_system, n_row, 1, 0);
+    }
+  }
+  if(LAinfo)
+  {
+    numerics_printf_verbose(1,"LU factorization failed:\n");
+    return 0;
+  }
+  if(useDGELS)
+  {
+    for(int ii = 0; ii < npm; ii++)
+    {
+      if(isnan(q_linear_system[ii]) || isinf(q_linear_system[ii]))
+      {
+        numerics_printf_verbose(1,"DGELS FAILED\n");
+        return 0;
+      }
+    }
+
+    if(n_row > npm)
+    {
+      double residual = cblas_dnrm2(n_row - npm, q_linear_system + npm, 1);
+
+      if(residual > tol || isnan(residual) || isinf(residual))
+      {
+        numerics_printf_verbose(1,"DGELS, optimal point doesn't satisfy AX=b, residual = %e\n", residual);
+        return 0;
+      }
+      numerics_printf_verbose(1,"DGELS, optimal point residual = %e\n", residual);
+    }
+  }
+
+  numerics_printf_verbose(1,"Solving linear system success, solution in cone?\n");
+  if(verbose > 1)
+  {
+    NM_dense_display(q_linear_system, n_row, 1, 0);
+  }
+
+  for(int row = 0 ; row < m; row++)
+  {
+    if(q_linear_system[n + row] < - tol)
+    {
+      return 0;/*out of the cone!*/
+    }
+  }
+
+  double err;
+  mlcp_enum_fill_solution(z, z + n, w, w + (n_row - m), n, m, n_row, zw_indices, q_linear_system);
+  mlcp_compute_error(problem, z, w, tol, &err);
+  /*because it happens the LU leads to an wrong solution witout raise any error.*/
+  if(err > 10 * tol)
+  {
+    numerics_printf_verbose(1,"LU no-error, but mlcp_compute_error out of tol: %e!\n", err);
+    return 0;
+  }
+  numerics_printf_verbose(1,"mlcp_enum find a solution, err=%e !\n", err);
+  return 1;
+}
+
+#ifdef _OPENMP
+/* The cases are shared between n_threads workers, each one with its own
+   linear system and its own copy of (z, w). As soon as a solution is found,
+   the other cases are skipped, except in the deterministic mode where the
+   cases with a lower index than the best solution found so far are still
+   tried. */
+static int mlcp_enum_parallel(MixedLinearComplementarityProblem* problem, double *z, double *w,
+                              SolverOptions* options, double * q_linear_system_ref,
+                              int n_threads)
+{
+  int npm = (problem->n) + (problem->m);
+  int n_row = problem->M->size0;
+  int m = problem->m;
+  int size_zw = (npm > n_row) ? npm : n_row;
+  double tol = options->dparam[SICONOS_DPARAM_TOL];
+  int itermax = options->iparam[SICONOS_IPARAM_MAX_ITER];
+  int useDGELS = options->iparam[SICONOS_IPARAM_MLCP_ENUM_USE_DGELS];
+  int deterministic = options->iparam[SICONOS_IPARAM_MLCP_ENUM_DETERMINISTIC];
+  unsigned long long int nb_cases = enum_compute_nb_cases(m);
+  unsigned long long int best;
+  double * z_solution = (double *)malloc(size_zw * sizeof(double));
+  double * w_solution = (double *)malloc(size_zw * sizeof(double));
+
+  if(itermax < 0)
+    itermax = 0;
+  if((unsigned long long int)itermax < nb_cases)
+    nb_cases = (unsigned long long int)itermax;
+  best = nb_cases;
+  long long int nb = (long long int)nb_cases;
+
+  #pragma omp parallel num_threads(n_threads)
+  {
+    double * M_linear_system = (double *)malloc(npm * n_row * sizeof(double));
+    double * q_linear_system = (double *)malloc(n_row * sizeof(double));
+    double * z_local = (double *)calloc(size_zw, sizeof(double));
+    double * w_local = (double *)calloc(size_zw, sizeof(double));
+    int * zw_indices = (int *)malloc((m > 0 ? m : 1) * sizeof(int));
+    lapack_int * ipiv = (lapack_int *)malloc(npm * sizeof(lapack_int));
+    long long int k;
+
+    #pragma omp for schedule(dynamic, 16)
+    for(k = 0; k < nb; k++)
+    {
+      unsigned long long int found;
+      #pragma omp atomic read
+      found = best;
+      if(deterministic ? (unsigned long long int)k > found : found < nb_cases)
+        continue;
+      enum_set_zw(zw_indices, m, (unsigned long long int)k);
+      if(mlcp_enum_try(problem, zw_indices, M_linear_system, q_linear_system,
+                       q_linear_system_ref, ipiv, useDGELS, tol, z_local, w_local))
+      {
+        #pragma omp critical(mlcp_enum_solution)
+        {
+          if((unsigned long long int)k < best)
+          {
+            memcpy(z_solution, z_local, size_zw * sizeof(double));
+            memcpy(w_solution, w_local, size_zw * sizeof(double));
+            #pragma omp atomic write
+            best = k;
+          }
+        }
+      }
+    }
+    free(M_linear_system);
+    free(q_linear_system);
+    free(z_local);
+    free(w_local);
+    free(zw_indices);
+    free(ipiv);
+  }
+
+  int info = 1;
+  if(best < nb_cases)
+  {
+    info = 0;
+    memcpy(z, z_solution, npm * sizeof(double));
+    memcpy(w, w_solution, n_row * sizeof(double));
+  }
+  free(z_solution);
+  free(w_solution);
+  return info;
+}
+#endif
+
 void mlcp_enum(MixedLinearComplementarityProblem* problem, double *z, double *w, int *info, SolverOptions* options)
 {
   /* verbose=1; */
-  int nbSol = 0;
   if(problem->blocksRows)
   {
     mlcp_enum_block(problem, z, w, info, options);
@@ -288,11 +475,7 @@ void mlcp_enum(MixedLinearComplementarityProblem* problem, double *z, double *w,
   }
 
   int * workingInt = options->iWork;
-  int npm = (problem->n) + (problem->m);
-  int NRHS = 1;
   lapack_int * ipiv;
-  int check;
-  lapack_int LAinfo = 0;
   *info = 0;
 
   /* sizes of the problem */
@@ -305,13 +488,6 @@ void mlcp_enum(MixedLinearComplementarityProblem* problem, double *z, double *w,
   int itermax = options->iparam[SICONOS_IPARAM_MAX_ITER];
   int useDGELS = options->iparam[SICONOS_IPARAM_MLCP_ENUM_USE_DGELS];
 
-
-  /*OUTPUT param*/
-  double * w_e = w;
-  double * w_i = w + (n_row - problem->m); /*sW2 size :m */
-  double * u = z;
-  double * v = z + problem->n;
-
   /*  LWORK = 2*npm; LWORK >= max( 1, MN + max( MN, NRHS ) ) where MN = min(M,N)*/
   //  verbose=1;
   numerics_printf_verbose(1,"mlcp_enum BEGIN, n %d m %d tol %lf\n", n, m, tol);
@@ -327,120 +503,47 @@ void mlcp_enum(MixedLinearComplementarityProblem* problem, double *z, double *w,
   for(int row = 0; row < n_row; row++)
     q_linear_system_ref[row] =  - problem->q[row];
 
+#ifdef _OPENMP
+  int n_threads = options->iparam[SICONOS_IPARAM_MLCP_ENUM_NUMBER_OF_THREADS];
+  if(n_threads < 0)
+    n_threads = omp_get_max_threads();
+  if(n_threads > 1)
+  {
+    *info = mlcp_enum_parallel(problem, z, w, options, q_linear_system_ref, n_threads);
+    numerics_printf_verbose(1,"mlcp_enum END, info=%i\n", *info);
+    return;
+  }
+#endif
+
   int * zw_indices = workingInt;
   ipiv = zw_indices + m;
   EnumerationStruct * enum_struct = enum_init(problem->m);
 
   while(enum_next(zw_indices, problem->m, enum_struct) && itermax-- > 0)
   {
-    mlcp_enum_build_M(zw_indices, M_linear_system, problem->M->matrix0, n, m, n_row);
-
-    /* copy q_ref in q */
-    memcpy(q_linear_system, q_linear_system_ref, n_row * sizeof(double));
-
-    if(verbose > 1)
-      print_current_system(problem, M_linear_system, q_linear_system);
-
-    if(useDGELS)
-    {
-      DGELS(LA_NOTRANS,n_row, npm, NRHS, M_linear_system, n_row, q_linear_system, n_row, &LAinfo);
-      numerics_printf_verbose(1,"Solution of dgels\n");
-      if(verbose > 1)
-      {
-        NM_dense_display(q_linear_system, n_row, 1, 0);
-      }
-    }
-    else
+    if(mlcp_enum_try(problem, zw_indices, M_linear_system, q_linear_system,
+                     q_linear_system_ref, ipiv, useDGELS, tol, z, w))
     {
-      DGESV(npm, NRHS, M_linear_system, npm, ipiv, q_linear_system, npm, &LAinfo);
-      numerics_printf_verbose(1,"Solution of dgesv\n");
-      if(verbose > 1)
+      if(verbose >1)
       {
-        NM_dense_display(q_linear_system, n_row, 1, 0);
+        mlcp_enum_display_solution(z, z + n, w, w + (n_row - m), n, m, n_row);
       }
-    }
-    if(!LAinfo)
-    {
-      if(useDGELS)
-      {
-        int cc = 0;
-        int ii;
-        for(ii = 0; ii < npm; ii++)
-        {
-          if(isnan(q_linear_system[ii]) || isinf(q_linear_system[ii]))
-          {
-            numerics_printf_verbose(1,"DGELS FAILED\n");
-            cc = 1;
-            break;
-          }
-        }
-        if(cc)
-          continue;
-
-        if(n_row > npm)
-        {
-          double residual = cblas_dnrm2(n_row - npm, q_linear_system + npm, 1);
-
-          if(residual > tol || isnan(residual) || isinf(residual))
-          {
-            numerics_printf_verbose(1,"DGELS, optimal point doesn't satisfy AX=b, residual = %e\n", residual);
-            continue;
-          }
-          numerics_printf_verbose(1,"DGELS, optimal point residual = %e\n", residual);
-        }
-      }
-
-      numerics_printf_verbose(1,"Solving linear system success, solution in cone?\n");
-      if(verbose > 1)
-      {
-        NM_dense_display(q_linear_system, n_row, 1, 0);
-      }
-
-      check = 1;
-      for(int row = 0 ; row < m; row++)
-      {
-        if(q_linear_system[n + row] < - tol)
-        {
-          check = 0;
-          break;/*out of the cone!*/
-        }
-      }
-      if(!check)
-        continue;
-      else
-      {
-        double err;
-        mlcp_enum_fill_solution(u, v, w_e, w_i, n, m, n_row, zw_indices, q_linear_system);
-        mlcp_compute_error(problem, z, w, tol, &err);
-        /*because it happens the LU leads to an wrong solution witout raise any error.*/
-        if(err > 10 * tol)
-        {
-          numerics_printf_verbose(1,"LU no-error, but mlcp_compute_error out of tol: %e!\n", err);
-          continue;
-        }
-        nbSol++;
-        numerics_printf_verbose(1,"mlcp_enum find a solution, err=%e !\n", err);
-        if(verbose >1)
-        {
-          mlcp_enum_display_solution(u, v, w_e, w_i, n, m, n_row);
-        }
-        numerics_printf_verbose(1,"mlcp_enum END");
-        return;
-      }
-    }
-    else
-    {
-      numerics_printf_verbose(1,"LU factorization failed:\n");
+      numerics_printf_verbose(1,"mlcp_enum END");
+      free(enum_struct);
+      return;
     }
   }
+  free(enum_struct);
   *info = 1;
-  numerics_printf_verbose(1,"mlcp_enum failed nbSol=%i!\n", nbSol);
+  numerics_printf_verbose(1,"mlcp_enum failed!\n");
 }
 
 void mlcp_enum_set_default(SolverOptions* options)
 {
   options->iparam[SICONOS_IPARAM_MAX_ITER] = 10000000;
   options->dparam[SICONOS_IPARAM_MLCP_ENUM_USE_DGELS] = 0;
+  options->iparam[SICONOS_IPARAM_MLCP_ENUM_NUMBER_OF_THREADS] = 1;
+  options->iparam[SICONOS_IPARAM_MLCP_ENUM_DETERMINISTIC] = 0;
   options->filterOn = false;
 
 }
@@ -0,0 +1,111 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Two problems solved alternately with MLCP_DIRECT_ENUM, each with its own
+   SolverOptions: once a configuration has been found by the enum solver,
+   the next solves must be done by the direct solver from the cache of the
+   problem, including when the matrix is modified between two calls. */
+
+#include <stdio.h>                              // for printf
+#include <stdlib.h>                             // for calloc, free, malloc
+#include "MLCP_Solvers.h"                       // for mlcp_driver_init, mlc...
+#include "MixedLinearComplementarityProblem.h"  // for MixedLinearComplement...
+#include "NonSmoothDrivers.h"                   // for mlcp_driver
+#include "NumericsMatrix.h"                     // for NumericsMatrix
+#include "SolverOptions.h"                      // for SolverOptions, solve...
+#include "mlcp_cst.h"                           // for SICONOS_MLCP_DIRECT_ENUM
+
+static int solve(MixedLinearComplementarityProblem* problem, SolverOptions* options,
+                 double * z, double * w)
+{
+  double error = 0.;
+  int size = problem->n + problem->m;
+  /* no initial guess, the direct solver must find the configuration by itself */
+  for(int i = 0; i < size; i++)
+    z[i] = w[i] = 0.;
+  int info = mlcp_driver(problem, z, w, options);
+  if(info)
+    return info;
+  return mlcp_compute_error(problem, z, w, 1e-10, &error);
+}
+
+int main(void)
+{
+  int info = 0;
+  const char * files[2] = {"./data/RLCD_mlcp.dat", "./data/diodeBridge_mlcp.dat"};
+  MixedLinearComplementarityProblem* problems[2];
+  SolverOptions* options[2];
+  double * z[2];
+  double * w[2];
+
+  for(int k = 0; k < 2; k++)
+  {
+    problems[k] = (MixedLinearComplementarityProblem *)malloc(sizeof(MixedLinearComplementarityProblem));
+    if(mixedLinearComplementarity_newFromFilename(problems[k], files[k]))
+    {
+      printf("issue in loading the mlcp problem %s\n", files[k]);
+      return 1;
+    }
+    int size = problems[k]->n + problems[k]->m;
+    z[k] = (double *)calloc(size, sizeof(double));
+    w[k] = (double *)calloc(size, sizeof(double));
+    options[k] = solver_options_create(SICONOS_MLCP_DIRECT_ENUM);
+    options[k]->iparam[SICONOS_IPARAM_MLCP_UPDATE_REQUIRED] = 1;
+    mlcp_driver_init(problems[k], options[k]);
+  }
+
+  /* first pass: the configurations are found by the enum solver */
+  for(int k = 0; k < 2; k++)
+    info += solve(problems[k], options[k], z[k], w[k]);
+
+  /* second pass: both problems must be solved by their own cache */
+  for(int k = 0; k < 2; k++)
+  {
+    info += solve(problems[k], options[k], z[k], w[k]);
+    if(options[k]->iparam[7])
+    {
+      printf("%s: the direct solver failed with a cached configuration\n", files[k]);
+      info++;
+    }
+  }
+
+  /* the matrix changes, the active set does not: the factorization of the
+     cached configuration must be updated */
+  NumericsMatrix * M = problems[0]->M;
+  for(int i = 0; i < M->size0 * M->size1; i++)
+    M->matrix0[i] *= 2.;
+  info += solve(problems[0], options[0], z[0], w[0]);
+  if(options[0]->iparam[7])
+  {
+    printf("%s: the direct solver failed after a change of M\n", files[0]);
+    info++;
+  }
+
+  /* the cache of the second problem is left to solver_options_delete */
+  mlcp_driver_reset(problems[0], options[0]);
+  for(int k = 0; k < 2; k++)
+  {
+    solver_options_delete(options[k]);
+    free(options[k]);
+    mixedLinearComplementarity_free(problems[k]);
+    free(z[k]);
+    free(w[k]);
+  }
+  printf("End of test, info = %i\n", info);
+  return info;
+}
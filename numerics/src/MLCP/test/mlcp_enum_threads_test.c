@@ -0,0 +1,113 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The same MLCPs solved by the serial enumeration and with several threads.
+   With the deterministic option, the solution must be the one of the serial
+   enumeration; without it, any solution found must be a solution of the
+   MLCP. Without OpenMP, the number of threads is ignored and all the solves
+   are serial. */
+
+#include <math.h>                               // for fabs
+#include <stdio.h>                              // for printf
+#include <stdlib.h>                             // for calloc, free, malloc
+#include "MLCP_Solvers.h"                       // for mlcp_driver_init, mlc...
+#include "MixedLinearComplementarityProblem.h"  // for MixedLinearComplement...
+#include "NonSmoothDrivers.h"                   // for mlcp_driver
+#include "SolverOptions.h"                      // for SolverOptions, solve...
+#include "mlcp_cst.h"                           // for SICONOS_MLCP_ENUM
+
+static int solve(MixedLinearComplementarityProblem* problem, int n_threads, int deterministic,
+                 double * z, double * w)
+{
+  SolverOptions * options = solver_options_create(SICONOS_MLCP_ENUM);
+  options->dparam[SICONOS_DPARAM_TOL] = 1e-12;
+  options->iparam[SICONOS_IPARAM_MLCP_ENUM_NUMBER_OF_THREADS] = n_threads;
+  options->iparam[SICONOS_IPARAM_MLCP_ENUM_DETERMINISTIC] = deterministic;
+  int size = problem->n + problem->m;
+  for(int i = 0; i < size; i++)
+    z[i] = w[i] = 0.;
+  mlcp_driver_init(problem, options);
+  int info = mlcp_driver(problem, z, w, options);
+  mlcp_driver_reset(problem, options);
+  solver_options_delete(options);
+  return info;
+}
+
+int main(void)
+{
+  int info = 0;
+  const char * files[4] = {"./data/RLCD_mlcp.dat", "./data/diodeBridge_mlcp.dat",
+                           "./data/m2n1_mlcp.dat", "./data/relay2_mlcp.dat"
+                          };
+  for(int k = 0; k < 4; k++)
+  {
+    MixedLinearComplementarityProblem* problem =
+      (MixedLinearComplementarityProblem *)malloc(sizeof(MixedLinearComplementarityProblem));
+    if(mixedLinearComplementarity_newFromFilename(problem, files[k]))
+    {
+      printf("issue in loading the mlcp problem %s\n", files[k]);
+      return 1;
+    }
+    int size = problem->n + problem->m;
+    double * zref = (double *)calloc(size, sizeof(double));
+    double * wref = (double *)calloc(size, sizeof(double));
+    double * z = (double *)calloc(size, sizeof(double));
+    double * w = (double *)calloc(size, sizeof(double));
+
+    int info_ref = solve(problem, 1, 0, zref, wref);
+    for(int n_threads = 2; n_threads <= 4; n_threads++)
+    {
+      for(int deterministic = 0; deterministic < 2; deterministic++)
+      {
+        int info_k = solve(problem, n_threads, deterministic, z, w);
+        double error = 0.;
+        if(info_k != info_ref)
+        {
+          printf("%s, %i threads: info %i instead of %i\n", files[k], n_threads, info_k, info_ref);
+          info++;
+        }
+        else if(!info_k && mlcp_compute_error(problem, z, w, 1e-10, &error))
+        {
+          printf("%s, %i threads: wrong solution, error = %e\n", files[k], n_threads, error);
+          info++;
+        }
+        else if(!info_k && deterministic)
+        {
+          for(int i = 0; i < size; i++)
+          {
+            if(fabs(z[i] - zref[i]) > 1e-12 || fabs(w[i] - wref[i]) > 1e-12)
+            {
+              printf("%s, %i threads: not the solution of the serial enumeration\n",
+                     files[k], n_threads);
+              info++;
+              break;
+            }
+          }
+        }
+      }
+    }
+    printf("%s: info = %i\n", files[k], info_ref);
+    free(zref);
+    free(wref);
+    free(z);
+    free(w);
+    mixedLinearComplementarity_free(problem);
+  }
+  printf("End of test, info = %i\n", info);
+  return info;
+}
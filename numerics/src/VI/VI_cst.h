@@ -48,6 +48,11 @@ enum SICONOS_VI_IPARAM
    SICONOS_VI_IPARAM_LS_MAX_ITER = 9,
    /** activate the update in the loop (0:false default choice) */
    SICONOS_VI_IPARAM_ACTIVATE_UPDATE = 10,
+   /** index in iparam to store the acceleration strategy of FPP
+       (a value of SICONOS_FIXED_POINT_ACCELERATION_ENUM) */
+   SICONOS_VI_IPARAM_ACCELERATION = 11,
+   /** index in iparam to store the memory of the Anderson acceleration */
+   SICONOS_VI_IPARAM_ACCELERATION_MEMORY = 12,
   };
 
 /** Allowed values for iparam[SICONOS_VI_IPARAM_LINESEARCH_METHOD]   
@@ -76,6 +81,8 @@ enum SICONOS_VI_DPARAM
   SICONOS_VI_DPARAM_LS_LMIN = 7,
   /** index in dparam to store the sigma coeff (HP) */
   SICONOS_VI_DPARAM_SIGMA = 8,
+  /** index in dparam to store the maximum omega of the SOR acceleration */
+  SICONOS_VI_DPARAM_ACCELERATION_OMEGA_MAX = 10,
 };
 
 
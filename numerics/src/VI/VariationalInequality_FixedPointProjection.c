@@ -26,6 +26,7 @@
 #include "VariationalInequality.h"               // for VariationalInequality
 #include "VariationalInequality_Solvers.h"       // for variationalInequalit...
 #include "VariationalInequality_computeError.h"  // for variationalInequalit...
+#include "fixed_point_acceleration.h"            // for fixed_point_accelera...
 #include "siconos_debug.h"                               // for DEBUG_PRINTF, DEBUG_...
 #include "numerics_verbose.h"                    // for verbose, numerics_error
 
@@ -130,6 +131,15 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
   double * xtmp = (double *)calloc(n, sizeof(double));
   double * wtmp = (double *)calloc(n, sizeof(double));
 
+  /* acceleration of the fixed point iterations (NULL if none) */
+  fixed_point_acceleration* acceleration =
+    fixed_point_acceleration_new(iparam[SICONOS_VI_IPARAM_ACCELERATION], n,
+                                 iparam[SICONOS_VI_IPARAM_ACCELERATION_MEMORY],
+                                 dparam[SICONOS_VI_DPARAM_ACCELERATION_OMEGA_MAX],
+                                 problem->ProjectionOnX, problem);
+  if(acceleration)
+    fixed_point_acceleration_initialize(acceleration, x);
+
   double rho = 0.0, rho_k =0.0;
   int isVariable = 0;
 
@@ -204,6 +214,9 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
             error, NULL);
       }
 
+      if(acceleration && hasNotConverged > 0 && iter < itermax)
+        fixed_point_acceleration_apply(acceleration, x, error);
+
     }
   }
   else if(isVariable)
@@ -294,6 +307,9 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
         hasNotConverged = determine_convergence(error, &tolerance, iter, options,
                                                 problem, x, w, rho);
 
+        if(acceleration && hasNotConverged > 0 && iter < itermax)
+          fixed_point_acceleration_apply(acceleration, x, error);
+
         DEBUG_EXPR_WE(
           if((error < error_k))
       {
@@ -400,6 +416,9 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
 
         hasNotConverged = determine_convergence(error, &tolerance, iter, options,
                                                 problem, x, w, rho);
+
+        if(acceleration && hasNotConverged > 0 && iter < itermax)
+          fixed_point_acceleration_apply(acceleration, x, error);
         DEBUG_EXPR_WE(
           if((error < error_k))
       {
@@ -505,6 +524,9 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
         hasNotConverged = determine_convergence(error, &tolerance, iter, options,
                                                 problem, x, w, rho);
 
+        if(acceleration && hasNotConverged > 0 && iter < itermax)
+          fixed_point_acceleration_apply(acceleration, x, error);
+
         DEBUG_EXPR_WE(
           if((error < error_k))
       {
@@ -548,6 +570,7 @@ void variationalInequality_FixedPointProjection(VariationalInequality* problem,
   iparam[SICONOS_IPARAM_ITER_DONE] = iter;
   free(xtmp);
   free(wtmp);
+  fixed_point_acceleration_free(acceleration);
 
 }
 
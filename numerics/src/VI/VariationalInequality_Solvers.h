@@ -82,6 +82,11 @@ extern "C"
      dparam[SICONOS_VI_DPARAM_LS_TAUINV] = 3.0/2.0;  tauinv
      dparam[SICONOS_VI_DPARAM_LS_L] = 0.9;   L
      dparam[SICONOS_VI_DPARAM_LS_MIN] = 0.3;   Lmin
+
+     iparam[SICONOS_VI_IPARAM_ACCELERATION] : acceleration of the iterations,
+     see SICONOS_FIXED_POINT_ACCELERATION_ENUM (none by default)
+     iparam[SICONOS_VI_IPARAM_ACCELERATION_MEMORY] : memory of the Anderson acceleration
+     dparam[SICONOS_VI_DPARAM_ACCELERATION_OMEGA_MAX] : maximum omega of the SOR acceleration
   */
   void variationalInequality_FixedPointProjection(VariationalInequality* problem, double *x, double *w, int* info, SolverOptions* options);
 
@@ -255,83 +255,208 @@ int CSparseMatrix_lu_factorization(CS_INT order, const cs *A, double tol, CSpars
 int CSparseMatrix_chol_factorization(CS_INT order, const cs *A,  CSparseMatrix_factors * cs_chol_A)
 {
   assert(A);
-  cs_chol_A->n = A->n;
+  CSparseMatrix_symbolic* sym = CSparseMatrix_chol_analyze(order, A);
+  int info = 0;
+  if(sym)
+  {
+    info = CSparseMatrix_chol_numeric(A, sym, cs_chol_A);
+  }
+  else
+  {
+    cs_chol_A->n = A->n;
+    cs_chol_A->S = NULL;
+    cs_chol_A->N = NULL;
+  }
+  CSparseMatrix_symbolic_free(sym);
+  return info;
+}
+int CSparseMatrix_ldlt_factorization(CS_INT order, const cs *A,  CSparseMatrix_factors * cs_ldlt_A)
+{
+  assert(A);
+  CSparseMatrix_symbolic* sym = CSparseMatrix_ldlt_analyze(order, A);
+  int info = 0;
+  if(sym)
+  {
+    info = CSparseMatrix_ldlt_numeric(A, sym, cs_ldlt_A);
+  }
+  else
+  {
+    cs_ldlt_A->n = A->n;
+    cs_ldlt_A->S = NULL;
+    cs_ldlt_A->N = NULL;
+  }
+  CSparseMatrix_symbolic_free(sym);
+  return info;
+}
+
+static CS_INT* CSparseMatrix_int_copy(const CS_INT* src, CS_INT size)
+{
+  if(!src) return NULL;
+  CS_INT* dest = cs_malloc(size, sizeof(CS_INT));
+  if(dest) memcpy(dest, src, (size_t)size * sizeof(CS_INT));
+  return dest;
+}
+
+/* copy of the parts of a symbolic analysis used by a Cholesky or LDLT
+ * factorization and the corresponding solves */
+static css* CSparseMatrix_css_copy(const css* S, CS_INT n)
+{
+  css* C = cs_calloc(1, sizeof(css));
+  if(!C) return NULL;
+  C->pinv = CSparseMatrix_int_copy(S->pinv, n);
+  C->q = CSparseMatrix_int_copy(S->q, n);
+  C->parent = CSparseMatrix_int_copy(S->parent, n);
+  C->cp = CSparseMatrix_int_copy(S->cp, n+1);
+  C->m2 = S->m2;
+  C->lnz = S->lnz;
+  C->unz = S->unz;
+  return C;
+}
+
+static CSparseMatrix_symbolic* CSparseMatrix_symbolic_new(CSparseMatrix_symbolic_kind kind,
+                                                          const cs *A, css* S)
+{
+  CSparseMatrix_symbolic* sym = (CSparseMatrix_symbolic*) malloc(sizeof(CSparseMatrix_symbolic));
+  sym->kind = kind;
+  sym->n = A->n;
+  sym->p = CSparseMatrix_int_copy(A->p, A->n+1);
+  sym->i = CSparseMatrix_int_copy(A->i, A->p[A->n]);
+  sym->S = S;
+  return sym;
+}
+
+CSparseMatrix_symbolic* CSparseMatrix_chol_analyze(CS_INT order, const cs *A)
+{
+  assert(A);
+  assert(CS_CSC(A));
   css* S = cs_schol(order, A);
-  cs_chol_A->S = S;
-  cs_chol_A->N = cs_chol(A, S);
+  if(!S) return NULL;
+  return CSparseMatrix_symbolic_new(CSPARSE_SYMBOLIC_CHOL, A, S);
+}
+
+CSparseMatrix_symbolic* CSparseMatrix_ldlt_analyze(CS_INT order, const cs *A)
+{
+  assert(A);
+  assert(CS_CSC(A));
+  CS_INT n = A->n;
+
+  /* the LDL symbolic factorization is stored in a css:
+   * q = Perm, pinv = PermInv, parent = Parent, cp = Lp */
+  css* S = cs_calloc (1, sizeof (css)) ;
+  if(!S) return NULL;
+
+  /* ordering with amd */
+  CS_INT * Perm = cs_amd (order, A) ;
+  CS_INT * PermInv = Perm ? cs_malloc (n, sizeof (CS_INT)) : NULL;
+  CS_INT * Parent = cs_malloc (n+1, sizeof (CS_INT)) ;
+  CS_INT * Lp = cs_malloc (n+1, sizeof (CS_INT)) ;
+  S->q = Perm;
+  S->pinv = PermInv;
+  S->parent = Parent;
+  S->cp = Lp;
+
+  CS_INT* Lnz = cs_malloc (n, sizeof (CS_INT)) ;
+  CS_INT* Flag =  cs_malloc (n, sizeof (CS_INT)) ;
+
+  DEBUG_EXPR(if (Perm) {for (int k =0; k< n; k++){printf("%li\t", (long) Perm[k]);}printf("\n");});
+
+  /* symbolic factorization to get Lp, Parent, Lnz, and Pinv */
+  LDL_symbolic (n, A->p, A->i, Lp, Parent, Lnz, Flag, Perm, PermInv) ;
+  S->lnz = Lp[n];
+  DEBUG_EXPR(for (int k =0; k< n+1; k++){printf("%li\t", (long) Lp[k]);}printf("\n"););
 
-  return (S && cs_chol_A->N);
+  cs_free(Lnz);
+  cs_free(Flag);
+
+  return CSparseMatrix_symbolic_new(CSPARSE_SYMBOLIC_LDLT, A, S);
 }
-int CSparseMatrix_ldlt_factorization(CS_INT order, const cs *A,  CSparseMatrix_factors * cs_ldlt_A)
+
+int CSparseMatrix_symbolic_match(const CSparseMatrix_symbolic* sym,
+                                 CSparseMatrix_symbolic_kind kind,
+                                 const cs *A)
+{
+  if(!sym || !A || !CS_CSC(A)) return 0;
+  if(sym->kind != kind || sym->n != A->n || A->m != A->n) return 0;
+  if(memcmp(sym->p, A->p, (size_t)(A->n+1) * sizeof(CS_INT))) return 0;
+  return !memcmp(sym->i, A->i, (size_t)A->p[A->n] * sizeof(CS_INT));
+}
+
+CSparseMatrix_symbolic* CSparseMatrix_symbolic_free(CSparseMatrix_symbolic* sym)
+{
+  if(sym)
+  {
+    cs_sfree(sym->S);
+    cs_free(sym->p);
+    cs_free(sym->i);
+    free(sym);
+  }
+  return NULL;
+}
+
+int CSparseMatrix_chol_numeric(const cs *A, const CSparseMatrix_symbolic* sym,
+                               CSparseMatrix_factors * cs_chol_A)
+{
+  assert(A);
+  assert(sym && sym->kind == CSPARSE_SYMBOLIC_CHOL);
+  cs_chol_A->n = A->n;
+  cs_chol_A->S = CSparseMatrix_css_copy(sym->S, A->n);
+  cs_chol_A->N = cs_chol(A, sym->S);
+
+  return (cs_chol_A->S && cs_chol_A->N);
+}
+
+int CSparseMatrix_ldlt_numeric(const cs *A, const CSparseMatrix_symbolic* sym,
+                               CSparseMatrix_factors * cs_ldlt_A)
 {
   assert(A);
+  assert(sym && sym->kind == CSPARSE_SYMBOLIC_LDLT);
 
-  CS_INT *Ap, *Ai, *Lp, *Li;
-  CS_INT *Parent;
-  CS_ENTRY *Ax, *Lx;
-  css *S;
+  CS_INT *Li;
+  CS_ENTRY *Lx;
   csn *N;
   CS_INT n, lnz;
   DEBUG_EXPR(cs_print(A,1););
-  Ap=A->p;
-  Ai=A->i;
-  Ax=A->x;
 
   cs_ldlt_A->n = n =  A->n;
+  cs_ldlt_A->S = CSparseMatrix_css_copy(sym->S, n);
 
-  /* could be good to good cs_spalloc */
+  CS_INT * Perm = sym->S->q;
+  CS_INT * PermInv = sym->S->pinv;
+  CS_INT * Parent = sym->S->parent;
+  lnz = sym->S->cp[n];
 
   cs_ldlt_A->N = N        =  cs_calloc (1, sizeof (csn)) ;       /* allocate result N */
   cs_ldlt_A->N->L         = cs_calloc (1, sizeof (cs)) ;         /* allocate the cs struct */
   cs_ldlt_A->N->L->m =n;
   cs_ldlt_A->N->L->n =n;
   cs_ldlt_A->N->L->nz =-1;
-  cs_ldlt_A->N->L->p = Lp = cs_malloc (n+1, sizeof (CS_INT)) ;
-
-
-  cs_ldlt_A->S = S = cs_calloc (1, sizeof (css)) ;              /* allocate result S */
-  cs_ldlt_A->S->parent = Parent = cs_malloc (n+1, sizeof (CS_INT)) ;
-
-  CS_INT* Lnz = cs_malloc (n, sizeof (CS_INT)) ;
-  CS_INT* Flag =  cs_malloc (n, sizeof (CS_INT)) ;
-
-  /* ordering with amd */
-  CS_INT * Perm, *PermInv;
-  cs_ldlt_A->N->pinv = Perm  = cs_amd (order, A) ;  /* We used pinv to store Perm !! */
-  PermInv = cs_malloc (n, sizeof (CS_INT)) ;
-
-
-  DEBUG_EXPR(for (int k =0; k< n+1; k++){printf("%li\t", Perm[k]);}printf("\n"););
-
-  /* symbolic factorization to get Lp, Parent, Lnz, and Pinv */
-  LDL_symbolic (n, Ap, Ai, Lp, Parent, Lnz, Flag, Perm, PermInv) ;
-  DEBUG_EXPR(for (int k =0; k< n+1; k++){printf("%li\t", Lp[k]);}printf("\n"););
-  DEBUG_EXPR(for (int k =0; k< n; k++){printf("%li\t", Flag[k]);}printf("\n"););
+  cs_ldlt_A->N->L->nzmax =lnz;
+  cs_ldlt_A->N->L->p = CSparseMatrix_int_copy(sym->S->cp, n+1);
+  cs_ldlt_A->N->pinv = CSparseMatrix_int_copy(Perm, n);  /* We used pinv to store Perm !! */
 
   /* factorization */
-  lnz = Lp [n] ;
-  DEBUG_PRINTF("Lp[n] = %ld\n", Lp[n]);
+  DEBUG_PRINTF("Lp[n] = %ld\n", (long) lnz);
   cs_ldlt_A->N->L->i = Li = cs_malloc (lnz, sizeof (CS_INT)) ;
   cs_ldlt_A->N->L->x = Lx = cs_malloc (lnz, sizeof (CS_ENTRY)) ;
 
+  CS_INT* Lnz = cs_malloc (n, sizeof (CS_INT)) ;
+  CS_INT* Flag =  cs_malloc (n, sizeof (CS_INT)) ;
   CS_INT *Pattern =  cs_malloc (n, sizeof (CS_INT)) ;
   CS_ENTRY* D;
   cs_ldlt_A->N->B = D= cs_malloc (n, sizeof (CS_ENTRY)) ; /* We use cs_ldlt_A->N->B  for storing D !! */
   CS_ENTRY* Y = cs_malloc (n, sizeof (CS_ENTRY)) ;
-  LDL_numeric (n, Ap, Ai, Ax, Lp, Parent, Lnz, Li, Lx, D,
+  LDL_numeric (n, A->p, A->i, A->x, cs_ldlt_A->N->L->p, Parent, Lnz, Li, Lx, D,
                Y, Flag, Pattern, Perm, PermInv) ;
 
   DEBUG_EXPR(cs_print(cs_ldlt_A->N->L,1););
   DEBUG_EXPR(NV_display(D,n));
 
-
   cs_free(Lnz);
   cs_free(Flag);
-  cs_free(PermInv);
   cs_free(Pattern);
   cs_free(Y);
 
-  return (S && cs_ldlt_A->N);
+  return (cs_ldlt_A->S && cs_ldlt_A->N);
 }
 
 void CSparseMatrix_free_lu_factors(CSparseMatrix_factors* cs_lu_A)
@@ -160,6 +160,77 @@ extern "C"
    */
   int CSparseMatrix_ldlt_factorization(CS_INT order, const CSparseMatrix *A,  CSparseMatrix_factors * cs_ldlt_A);
 
+  /** \enum CSparseMatrix_symbolic_kind CSparseMatrix.h
+   * factorization a symbolic analysis has been computed for */
+  typedef enum { CSPARSE_SYMBOLIC_CHOL, CSPARSE_SYMBOLIC_LDLT } CSparseMatrix_symbolic_kind;
+
+  /** Symbolic analysis (fill-reducing ordering, elimination tree and
+   *  column counts) of a Cholesky or LDLT factorization, together with
+   *  the sparsity pattern it has been computed for. It may be reused to
+   *  factorize any matrix with the same pattern.
+   */
+  typedef struct {
+    CSparseMatrix_symbolic_kind kind; /**< factorization kind */
+    CS_INT n;    /**< size of the matrix */
+    CS_INT* p;   /**< column pointers of the analyzed pattern (size n+1) */
+    CS_INT* i;   /**< row indices of the analyzed pattern (size p[n]) */
+    css* S;      /**< symbolic analysis */
+  } CSparseMatrix_symbolic;
+
+  /** compute the symbolic analysis of a Cholesky factorization of A
+   *
+   *  \param order control if ordering is used
+   *  \param A the sparse matrix (csc)
+   *  \return the symbolic analysis or NULL if it failed
+   */
+  CSparseMatrix_symbolic* CSparseMatrix_chol_analyze(CS_INT order, const CSparseMatrix *A);
+
+  /** compute the symbolic analysis of a LDLT factorization of A
+   *
+   *  \param order control if ordering is used
+   *  \param A the sparse matrix (csc)
+   *  \return the symbolic analysis or NULL if it failed
+   */
+  CSparseMatrix_symbolic* CSparseMatrix_ldlt_analyze(CS_INT order, const CSparseMatrix *A);
+
+  /** check that a symbolic analysis can be used to factorize A
+   *
+   *  \param sym the symbolic analysis
+   *  \param kind the factorization kind
+   *  \param A the sparse matrix (csc)
+   *  \return 1 if A has the analyzed pattern, 0 otherwise
+   */
+  int CSparseMatrix_symbolic_match(const CSparseMatrix_symbolic* sym,
+                                   CSparseMatrix_symbolic_kind kind,
+                                   const CSparseMatrix *A);
+
+  /** free a symbolic analysis
+   *
+   *  \param sym the structure to free
+   *  \return NULL
+   */
+  CSparseMatrix_symbolic* CSparseMatrix_symbolic_free(CSparseMatrix_symbolic* sym);
+
+  /** compute a Cholesky factorization of A with a given symbolic analysis
+   *
+   *  \param A the sparse matrix, with the pattern analyzed in sym
+   *  \param sym the symbolic analysis, from CSparseMatrix_chol_analyze
+   *  \param cs_chol_A the parameter structure that eventually holds the factors
+   *  \return 1 if the factorization was successful, 0 otherwise
+   */
+  int CSparseMatrix_chol_numeric(const CSparseMatrix *A, const CSparseMatrix_symbolic* sym,
+                                 CSparseMatrix_factors * cs_chol_A);
+
+  /** compute a LDLT factorization of A with a given symbolic analysis
+   *
+   *  \param A the sparse matrix, with the pattern analyzed in sym
+   *  \param sym the symbolic analysis, from CSparseMatrix_ldlt_analyze
+   *  \param cs_ldlt_A the parameter structure that eventually holds the factors
+   *  \return 1 if the factorization was successful, 0 otherwise
+   */
+  int CSparseMatrix_ldlt_numeric(const CSparseMatrix *A, const CSparseMatrix_symbolic* sym,
+                                 CSparseMatrix_factors * cs_ldlt_A);
+
   /** reuse a LU factorization (stored in the cs_lu_A) to solve a linear system Ax = b
    *
    *  \param cs_lu_A contains the LU factors of A, permutation information
@@ -33,7 +33,7 @@ MPI_Comm NM_MPI_comm(NumericsMatrix* A)
     }
     NM_internalData(A)->mpi_comm = MPI_COMM_WORLD;
   }
-  return NM_internalData(A)->mpi_comm = MPI_COMM_WORLD;
+  return NM_internalData(A)->mpi_comm;
 }
 
 void NM_MPI_set_comm(NumericsMatrix* A, MPI_Comm comm)
@@ -89,6 +89,7 @@ void NM_internalData_new(NumericsMatrix* M)
   M->internalData->isLUfactorized = false ;
   M->internalData->isCholeskyfactorized = false ;
   M->internalData->isLDLTfactorized = false ;
+  M->internalData->symbolic = NULL;
 #ifdef SICONOS_HAS_MPI
   M->internalData->mpi_comm = MPI_COMM_NULL;
 #endif
@@ -753,6 +754,7 @@ void NM_internalData_free(NumericsMatrix* m)
       free(m->internalData->dWork);
     }
     m->internalData->dWork = NULL;
+    m->internalData->symbolic = CSparseMatrix_symbolic_free(m->internalData->symbolic);
     free(m->internalData);
     m->internalData = NULL;
   }
@@ -5831,6 +5833,26 @@ bool NM_equal_values_sha1(NumericsMatrix* A, NumericsMatrix* B)
 #endif
 
 
+/* Symbolic analysis kept in the internal data of Ao for the pattern of
+ * the csc matrix A (the csc part of Ao or of its destructible copy). It is
+ * computed again only if the pattern has changed since the last call. */
+static CSparseMatrix_symbolic* NM_csparse_symbolic(NumericsMatrix* Ao,
+                                                   CSparseMatrix_symbolic_kind kind,
+                                                   CSparseMatrix* A)
+{
+  NumericsMatrixInternalData* data = NM_internalData(Ao);
+  if (!CSparseMatrix_symbolic_match(data->symbolic, kind, A))
+  {
+    numerics_printf_verbose(2, "NM_csparse_symbolic, new symbolic analysis");
+    data->symbolic = CSparseMatrix_symbolic_free(data->symbolic);
+    if (kind == CSPARSE_SYMBOLIC_CHOL)
+      data->symbolic = CSparseMatrix_chol_analyze(1, A);
+    else
+      data->symbolic = CSparseMatrix_ldlt_analyze(1, A);
+  }
+  return data->symbolic;
+}
+
 int NM_Cholesky_factorize(NumericsMatrix* Ao)
 {
   DEBUG_BEGIN("int NM_Cholesky_factorize(NumericsMatrix* Ao) \n");
@@ -5904,9 +5926,10 @@ int NM_Cholesky_factorize(NumericsMatrix* Ao)
           p->dWorkSize = A->size1;
         };
 
-        CSparseMatrix_factors* cs_chol_A = (CSparseMatrix_factors*) malloc(sizeof(CSparseMatrix_factors));
+        CSparseMatrix_factors* cs_chol_A = (CSparseMatrix_factors*) calloc(1, sizeof(CSparseMatrix_factors));
 
-        info = !CSparseMatrix_chol_factorization(1, NM_csc(A),  cs_chol_A);
+        CSparseMatrix_symbolic* sym = NM_csparse_symbolic(Ao, CSPARSE_SYMBOLIC_CHOL, NM_csc(A));
+        info = !(sym && CSparseMatrix_chol_numeric(NM_csc(A), sym, cs_chol_A));
 
         if (info)
         {
@@ -6317,9 +6340,10 @@ int NM_LDLT_factorize(NumericsMatrix* Ao)
           p->dWorkSize = A->size1;
         };
 
-        CSparseMatrix_factors* cs_ldlt_A = (CSparseMatrix_factors*) malloc(sizeof(CSparseMatrix_factors));
+        CSparseMatrix_factors* cs_ldlt_A = (CSparseMatrix_factors*) calloc(1, sizeof(CSparseMatrix_factors));
 
-        info = !CSparseMatrix_ldlt_factorization(1, NM_csc(A),  cs_ldlt_A);
+        CSparseMatrix_symbolic* sym = NM_csparse_symbolic(Ao, CSPARSE_SYMBOLIC_LDLT, NM_csc(A));
+        info = !(sym && CSparseMatrix_ldlt_numeric(NM_csc(A), sym, cs_ldlt_A));
 
         if (info)
         {
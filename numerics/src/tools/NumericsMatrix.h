@@ -54,6 +54,9 @@ typedef struct
   bool isCholeskyfactorized; /**<  true if the matrix has already been Cholesky factorized */
   bool isLDLTfactorized; /**<  true if the matrix has already been LDLT factorized */
   bool isInversed; /**<  true if the matrix contains its inverse (in place inversion) */
+  CSparseMatrix_symbolic* symbolic; /**< symbolic analysis of the last sparse Cholesky
+                                     * or LDLT factorization, reused as long as
+                                     * the pattern of the matrix is unchanged */
 #ifdef SICONOS_HAS_MPI
   MPI_Comm mpi_comm; /**< optional mpi communicator */
 #endif
@@ -47,6 +47,7 @@
 #include "grfc3d_Solvers.h"      // for grfc3d_IPM_set_default
 #include "lcp_cst.h"                        // for SICONOS_LCP_AVI_CAOFERRIS...
 #include "mlcp_cst.h"                       // for SICONOS_MLCP_DIRECT_ENUM_STR
+#include "mlcp_direct.h"                    // for mlcp_direct_reset
 #include "numerics_verbose.h"               // for numerics_printf, numerics...
 #include "relay_cst.h"                      // for SICONOS_RELAY_AVI_CAOFERR...
 #include "rolling_fc_Solvers.h"           // for rfc3d_poc_set_default
@@ -187,6 +188,25 @@ void solver_options_print(SolverOptions* options)
 
 
 
+/* solverData of the solvers that keep more than a single block in it */
+static void solver_options_free_solverData(SolverOptions* op)
+{
+  switch(op->solverId)
+  {
+  case SICONOS_MLCP_DIRECT_ENUM:
+  case SICONOS_MLCP_DIRECT_SIMPLEX:
+  case SICONOS_MLCP_DIRECT_PATH:
+  case SICONOS_MLCP_DIRECT_PATH_ENUM:
+  case SICONOS_MLCP_DIRECT_FB:
+    // the cache of configurations, see mlcp_direct.c
+    mlcp_direct_reset(op);
+    break;
+  default:
+    free(op->solverData);
+  }
+  op->solverData = NULL;
+}
+
 void solver_options_delete(SolverOptions* op)
 {
   if(op)
@@ -200,8 +220,7 @@ void solver_options_delete(SolverOptions* op)
     op->solverParameters = NULL;
 
     if(op->solverData)
-      free(op->solverData);
-    op->solverData = NULL;
+      solver_options_free_solverData(op);
 
     // Clear callback
     if(op->callback)
@@ -248,11 +267,12 @@ SolverOptions * solver_options_copy(SolverOptions* source)
   // Create a new solver options, with default setup
   SolverOptions * options = solver_options_create(source->solverId);
 
-  for(size_t i=0; i < OPTIONS_PARAM_SIZE; ++i)
-  {
+  // iparam and dparam have iSize and dSize elements (less than
+  // OPTIONS_PARAM_SIZE)
+  for(int i=0; i < options->iSize && i < source->iSize; ++i)
     options->iparam[i] = source->iparam[i];
+  for(int i=0; i < options->dSize && i < source->dSize; ++i)
     options->dparam[i] = source->dparam[i];
-  }
 
   if(source->dWork)
   {
@@ -1594,6 +1594,50 @@ void SBM_row_prod_no_diag_3x3(unsigned int sizeX, unsigned int sizeY, unsigned i
     }
   }
 }
+float* SBM_new_float_blocks_3x3(const SparseBlockStructuredMatrix* const A)
+{
+  assert(A);
+  float* blocks = (float*)malloc(9 * A->nbblocks * sizeof(float));
+  for(unsigned int blockNum = 0; blockNum < A->nbblocks; ++blockNum)
+  {
+    const double* block = A->block[blockNum];
+    float* fblock = &blocks[9 * blockNum];
+    for(int i = 0; i < 9; ++i)
+      fblock[i] = (float)block[i];
+  }
+  return blocks;
+}
+
+void SBM_row_prod_no_diag_3x3_float(unsigned int currentRowNumber,
+                                    const SparseBlockStructuredMatrix* const A,
+                                    const float* const blocks,
+                                    const double* const x, double* y)
+{
+  assert(A);
+  assert(blocks);
+  assert(x);
+  assert(y);
+  assert(currentRowNumber <= A->blocknumber0);
+
+  for(size_t blockNum = A->index1_data[currentRowNumber];
+      blockNum < A->index1_data[currentRowNumber + 1];
+      ++blockNum)
+  {
+    size_t colNumber = A->index2_data[blockNum];
+
+    /* Computes product only for extra diagonal blocks */
+    if(colNumber != currentRowNumber)
+    {
+      assert(A->blocksize1[colNumber] == 3 * (colNumber + 1));
+      const float* block = &blocks[9 * blockNum];
+      const double* xj = &x[3 * colNumber];
+      y[0] += block[0] * xj[0] + block[3] * xj[1] + block[6] * xj[2];
+      y[1] += block[1] * xj[0] + block[4] * xj[1] + block[7] * xj[2];
+      y[2] += block[2] * xj[0] + block[5] * xj[1] + block[8] * xj[2];
+    }
+  }
+}
+
 void SBM_row_prod_no_diag_2x2(unsigned int sizeX, unsigned int sizeY, unsigned int currentRowNumber, const SparseBlockStructuredMatrix* const A, double* const x, double* y)
 {
   /*
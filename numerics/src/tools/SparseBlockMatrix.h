@@ -351,6 +351,31 @@ extern "C"
      \param[in,out] y the resulting vector
   */
   void SBM_row_prod_no_diag_3x3(unsigned int sizeX, unsigned int sizeY, unsigned int currentRowNumber, const SparseBlockStructuredMatrix* const A, double* const x, double* y);
+  /**
+     Single precision copy of the blocks of a matrix made of 3x3 blocks,
+     for products streaming less memory, see SBM_row_prod_no_diag_3x3_float.
+
+     \param[in] A the matrix
+     \return a contiguous array of 9*A->nbblocks floats (column-major
+     blocks, in the order of A->block), to be freed by the caller
+  */
+  float* SBM_new_float_blocks_3x3(const SparseBlockStructuredMatrix* const A);
+
+  /**
+     Same as SBM_row_prod_no_diag_3x3 (y += rowA*x, without the diagonal
+     block) with the single precision blocks of A. The accumulation is
+     done in double precision.
+
+     \param[in] currentRowNumber number of the required row of blocks
+     \param[in] A the matrix giving the block structure
+     \param[in] blocks the blocks of A given by SBM_new_float_blocks_3x3
+     \param[in] x the vector to be multiplied
+     \param[in,out] y the resulting vector
+  */
+  void SBM_row_prod_no_diag_3x3_float(unsigned int currentRowNumber,
+                                      const SparseBlockStructuredMatrix* const A,
+                                      const float* const blocks,
+                                      const double* const x, double* y);
   void SBM_row_prod_no_diag_2x2(unsigned int sizeX, unsigned int sizeY, unsigned int currentRowNumber, const SparseBlockStructuredMatrix* const A, double* const x, double* y);
   void SBM_row_prod_no_diag_1x1(unsigned int sizeX, unsigned int sizeY, unsigned int currentRowNumber, const SparseBlockStructuredMatrix* const A, double* const x, double* y);
 
@@ -28,14 +28,18 @@ EnumerationStruct * enum_init(int M)
   return enum_struct;
 }
 
-static void enum_affect_zw(int * zw, int size, EnumerationStruct * enum_struct)
+void enum_set_zw(int * zw, int size, unsigned long long int index)
 {
-  unsigned long  int aux = enum_struct->current;
   for(int i = 0; i < size; i++)
   {
-    zw[i] = aux & 1;
-    aux = aux >> 1;
+    zw[i] = index & 1;
+    index = index >> 1;
   }
+}
+
+static void enum_affect_zw(int * zw, int size, EnumerationStruct * enum_struct)
+{
+  enum_set_zw(zw, size, enum_struct->current);
 
   if(verbose > 1)
   {
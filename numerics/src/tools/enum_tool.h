@@ -31,6 +31,15 @@ typedef struct EnumerationStruct
 EnumerationStruct * enum_init(int M);
 int enum_next(int * zw, int size, EnumerationStruct * enum_struct);
 
+/** Set the complementarity pattern of a given case of the enumeration,
+ *  as enum_next does, without any state. Used to split the cases between
+ *  several workers.
+ * \param[out] zw the pattern, zw[i] = bit i of index
+ * \param size the size of the MCLP problem.
+ * \param index the number of the case
+ */
+void enum_set_zw(int * zw, int size, unsigned long long int index);
+
 
 
 /** Compute the total number of cases that should be enumerated
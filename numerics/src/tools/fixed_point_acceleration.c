@@ -0,0 +1,281 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#include "fixed_point_acceleration.h"
+#include <float.h>             // for DBL_MAX
+#include <math.h>              // for sqrt, fmin
+#include <stdlib.h>            // for calloc, free, malloc
+#include "SiconosBlas.h"       // for cblas_dcopy, cblas_daxpy, cblas_ddot
+#include "numerics_verbose.h"  // for numerics_error, numerics_printf_verbose
+
+/* relative regularization of the least-squares problem of Anderson mixing */
+#define ANDERSON_REGULARIZATION 1e-10
+/* growth factor of omega after an accepted step (SOR) */
+#define SOR_OMEGA_GROWTH 1.1
+
+fixed_point_acceleration* fixed_point_acceleration_new(int type, int n, int memory,
+                                                       double omega_max,
+                                                       fixed_point_acceleration_projection_ptr projection,
+                                                       void* env)
+{
+  if(type == SICONOS_FIXED_POINT_ACCELERATION_NONE)
+    return NULL;
+
+  if(!(type == SICONOS_FIXED_POINT_ACCELERATION_ANDERSON
+       || type == SICONOS_FIXED_POINT_ACCELERATION_NESTEROV
+       || type == SICONOS_FIXED_POINT_ACCELERATION_SOR))
+  {
+    numerics_error("fixed_point_acceleration_new",
+                   "the acceleration type must be equal to "
+                   "SICONOS_FIXED_POINT_ACCELERATION_NONE (0), "
+                   "SICONOS_FIXED_POINT_ACCELERATION_ANDERSON (1), "
+                   "SICONOS_FIXED_POINT_ACCELERATION_NESTEROV (2) or "
+                   "SICONOS_FIXED_POINT_ACCELERATION_SOR (3)");
+    return NULL;
+  }
+
+  fixed_point_acceleration* acc = (fixed_point_acceleration*)calloc(1, sizeof(fixed_point_acceleration));
+  acc->type = type;
+  acc->n = n;
+  acc->memory = (memory > 0) ? memory : 5;
+  acc->omega_max = (omega_max > 1.0) ? omega_max : 1.9;
+  acc->projection = projection;
+  acc->env = env;
+
+  acc->x = (double*)calloc(n, sizeof(double));
+  acc->g_previous = (double*)calloc(n, sizeof(double));
+  acc->work = (double*)calloc(n, sizeof(double));
+  if(type == SICONOS_FIXED_POINT_ACCELERATION_ANDERSON)
+  {
+    acc->f_previous = (double*)calloc(n, sizeof(double));
+    acc->dF = (double*)calloc(acc->memory * n, sizeof(double));
+    acc->dG = (double*)calloc(acc->memory * n, sizeof(double));
+    acc->H = (double*)calloc(acc->memory * acc->memory, sizeof(double));
+    acc->gamma = (double*)calloc(acc->memory, sizeof(double));
+  }
+  fixed_point_acceleration_initialize(acc, acc->x);
+  return acc;
+}
+
+static void fixed_point_acceleration_reset(fixed_point_acceleration* acc)
+{
+  acc->m = 0;
+  acc->head = 0;
+  acc->has_previous = 0;
+  acc->accelerated = 0;
+  acc->t = 1.0;
+  acc->omega = 1.0;
+}
+
+void fixed_point_acceleration_initialize(fixed_point_acceleration* acc, const double* x0)
+{
+  if(x0 != acc->x)
+    cblas_dcopy(acc->n, x0, 1, acc->x, 1);
+  fixed_point_acceleration_reset(acc);
+  acc->merit_previous = DBL_MAX;
+  acc->restarts = 0;
+}
+
+/* Solve H gamma = b by a Cholesky factorization of the (small) symmetric
+ * positive definite matrix H, stored column-major. Return 0 on success. */
+static int fixed_point_acceleration_cholesky_solve(int m, double* H, double* b)
+{
+  for(int j = 0; j < m; ++j)
+  {
+    double d = H[j + j * m];
+    for(int k = 0; k < j; ++k)
+      d -= H[j + k * m] * H[j + k * m];
+    if(!(d > 0.0))
+      return 1;
+    d = sqrt(d);
+    H[j + j * m] = d;
+    for(int i = j + 1; i < m; ++i)
+    {
+      double s = H[i + j * m];
+      for(int k = 0; k < j; ++k)
+        s -= H[i + k * m] * H[j + k * m];
+      H[i + j * m] = s / d;
+    }
+  }
+  for(int i = 0; i < m; ++i)
+  {
+    for(int k = 0; k < i; ++k)
+      b[i] -= H[i + k * m] * b[k];
+    b[i] /= H[i + i * m];
+  }
+  for(int i = m - 1; i >= 0; --i)
+  {
+    for(int k = i + 1; k < m; ++k)
+      b[i] -= H[k + i * m] * b[k];
+    b[i] /= H[i + i * m];
+  }
+  return 0;
+}
+
+/* Anderson mixing: x_{k+1} = G(x_k) - dG gamma, where gamma minimizes
+ * || f_k - dF gamma || with f = G(x) - x */
+static void fixed_point_acceleration_anderson(fixed_point_acceleration* acc, double* x)
+{
+  int n = acc->n;
+  int memory = acc->memory;
+  double* f = acc->work;
+
+  /* f <- G(x_k) - x_k */
+  cblas_dcopy(n, x, 1, f, 1);
+  cblas_daxpy(n, -1.0, acc->x, 1, f, 1);
+
+  if(acc->has_previous)
+  {
+    double* dF = &acc->dF[acc->head * n];
+    double* dG = &acc->dG[acc->head * n];
+    cblas_dcopy(n, f, 1, dF, 1);
+    cblas_daxpy(n, -1.0, acc->f_previous, 1, dF, 1);
+    cblas_dcopy(n, x, 1, dG, 1);
+    cblas_daxpy(n, -1.0, acc->g_previous, 1, dG, 1);
+    acc->head = (acc->head + 1) % memory;
+    if(acc->m < memory) acc->m++;
+  }
+  cblas_dcopy(n, f, 1, acc->f_previous, 1);
+  cblas_dcopy(n, x, 1, acc->g_previous, 1);
+
+  int m = acc->m;
+  if(m == 0)
+    return;
+
+  double diag_max = 0.0;
+  for(int i = 0; i < m; ++i)
+  {
+    for(int j = 0; j <= i; ++j)
+    {
+      double h = cblas_ddot(n, &acc->dF[i * n], 1, &acc->dF[j * n], 1);
+      acc->H[i + j * m] = h;
+      acc->H[j + i * m] = h;
+    }
+    acc->gamma[i] = cblas_ddot(n, &acc->dF[i * n], 1, f, 1);
+    diag_max = fmax(diag_max, acc->H[i + i * m]);
+  }
+  if(!(diag_max > 0.0))
+    return;
+  for(int i = 0; i < m; ++i)
+    acc->H[i + i * m] += ANDERSON_REGULARIZATION * diag_max;
+
+  if(fixed_point_acceleration_cholesky_solve(m, acc->H, acc->gamma))
+  {
+    /* the differences are (numerically) dependent: forget them */
+    acc->m = 0;
+    acc->head = 0;
+    return;
+  }
+
+  for(int i = 0; i < m; ++i)
+    cblas_daxpy(n, -acc->gamma[i], &acc->dG[i * n], 1, x, 1);
+  acc->accelerated = 1;
+}
+
+/* Nesterov: x_{k+1} = G(x_k) + beta_k (G(x_k) - G(x_{k-1})) */
+static void fixed_point_acceleration_nesterov(fixed_point_acceleration* acc, double* x)
+{
+  int n = acc->n;
+  double t_next = 0.5 * (1.0 + sqrt(1.0 + 4.0 * acc->t * acc->t));
+  double beta = (acc->t - 1.0) / t_next;
+  acc->t = t_next;
+
+  /* work <- G(x_k) - G(x_{k-1}) */
+  cblas_dcopy(n, x, 1, acc->work, 1);
+  cblas_daxpy(n, -1.0, acc->g_previous, 1, acc->work, 1);
+  cblas_dcopy(n, x, 1, acc->g_previous, 1);
+
+  if(acc->has_previous && beta > 0.0)
+  {
+    cblas_daxpy(n, beta, acc->work, 1, x, 1);
+    acc->accelerated = 1;
+  }
+}
+
+/* over-relaxation: x_{k+1} = x_k + omega (G(x_k) - x_k) */
+static void fixed_point_acceleration_sor(fixed_point_acceleration* acc, double* x)
+{
+  int n = acc->n;
+  cblas_dcopy(n, x, 1, acc->g_previous, 1);
+
+  if(acc->omega > 1.0)
+  {
+    cblas_dscal(n, acc->omega, x, 1);
+    cblas_daxpy(n, 1.0 - acc->omega, acc->x, 1, x, 1);
+    acc->accelerated = 1;
+  }
+  acc->omega = fmin(SOR_OMEGA_GROWTH * acc->omega, acc->omega_max);
+}
+
+void fixed_point_acceleration_apply(fixed_point_acceleration* acc, double* x, double merit)
+{
+  int n = acc->n;
+
+  /* safeguard: the merit increases after an accelerated step, the step is
+   * rejected and we restart from the last accepted G(x) */
+  if(acc->accelerated && merit > acc->merit_previous)
+  {
+    numerics_printf_verbose(2, "fixed_point_acceleration. restart, merit = %e > %e",
+                            merit, acc->merit_previous);
+    cblas_dcopy(n, acc->g_previous, 1, x, 1);
+    cblas_dcopy(n, x, 1, acc->x, 1);
+    fixed_point_acceleration_reset(acc);
+    acc->restarts++;
+    return;
+  }
+
+  acc->merit_previous = merit;
+  acc->accelerated = 0;
+
+  switch(acc->type)
+  {
+  case SICONOS_FIXED_POINT_ACCELERATION_ANDERSON:
+    fixed_point_acceleration_anderson(acc, x);
+    break;
+  case SICONOS_FIXED_POINT_ACCELERATION_NESTEROV:
+    fixed_point_acceleration_nesterov(acc, x);
+    break;
+  case SICONOS_FIXED_POINT_ACCELERATION_SOR:
+    fixed_point_acceleration_sor(acc, x);
+    break;
+  }
+  acc->has_previous = 1;
+
+  /* the extrapolated iterate may leave the feasible set */
+  if(acc->accelerated && acc->projection)
+  {
+    acc->projection(acc->env, x, acc->work);
+    cblas_dcopy(n, acc->work, 1, x, 1);
+  }
+  cblas_dcopy(n, x, 1, acc->x, 1);
+}
+
+void fixed_point_acceleration_free(fixed_point_acceleration* acc)
+{
+  if(!acc)
+    return;
+  free(acc->x);
+  free(acc->g_previous);
+  free(acc->work);
+  free(acc->f_previous);
+  free(acc->dF);
+  free(acc->dG);
+  free(acc->H);
+  free(acc->gamma);
+  free(acc);
+}
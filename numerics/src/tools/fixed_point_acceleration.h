@@ -0,0 +1,127 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef FIXED_POINT_ACCELERATION_H
+#define FIXED_POINT_ACCELERATION_H
+
+/*!\file fixed_point_acceleration.h
+  \brief Acceleration of fixed point iterations x_{k+1} = G(x_k)
+
+  The solver computes G(x_k) and its merit value (usually the error
+  returned by the *_compute_error function of the problem), then calls
+  fixed_point_acceleration_apply() which replaces G(x_k) by the next
+  iterate x_{k+1}. If the merit value increases after an accelerated step,
+  this step is rejected: the iterations restart from the last accepted
+  G(x_{k-1}) with a plain fixed point step.
+*/
+
+#include "SiconosConfig.h" // for BUILD_AS_CPP // IWYU pragma: keep
+
+/** Allowed values for the acceleration strategy */
+enum SICONOS_FIXED_POINT_ACCELERATION_ENUM
+{
+  /** plain fixed point iterations */
+  SICONOS_FIXED_POINT_ACCELERATION_NONE = 0,
+  /** Anderson mixing (type II) with a limited memory */
+  SICONOS_FIXED_POINT_ACCELERATION_ANDERSON = 1,
+  /** Nesterov extrapolation */
+  SICONOS_FIXED_POINT_ACCELERATION_NESTEROV = 2,
+  /** over-relaxation with an adaptive omega */
+  SICONOS_FIXED_POINT_ACCELERATION_SOR = 3
+};
+
+/** projection of an accelerated iterate onto the feasible set
+    (same signature as VariationalInequality::ProjectionOnX)
+    \param env the data of the problem
+    \param x the iterate
+    \param px the projected iterate
+ */
+typedef void (*fixed_point_acceleration_projection_ptr)(void* env, double* x, double* px);
+
+/** \struct fixed_point_acceleration fixed_point_acceleration.h
+ * Data of the acceleration of fixed point iterations
+ */
+typedef struct
+{
+  int type; /**< acceleration strategy, see SICONOS_FIXED_POINT_ACCELERATION_ENUM */
+  int n; /**< size of the iterates */
+  int memory; /**< maximum number of differences stored (Anderson) */
+  int m; /**< number of differences currently stored (Anderson) */
+  int head; /**< position of the next difference in the ring buffers (Anderson) */
+  int has_previous; /**< 1 if g_previous (and f_previous) are set */
+  int accelerated; /**< 1 if the current iterate comes from an accelerated step */
+  double merit_previous; /**< merit value of the last accepted G(x) */
+  double t; /**< Nesterov parameter */
+  double omega; /**< current relaxation parameter (SOR) */
+  double omega_max; /**< maximum relaxation parameter (SOR) */
+  double* x; /**< current iterate x_k */
+  double* g_previous; /**< last accepted G(x) */
+  double* f_previous; /**< last accepted residual G(x) - x (Anderson) */
+  double* dF; /**< differences of residuals, memory x n (Anderson) */
+  double* dG; /**< differences of G(x), memory x n (Anderson) */
+  double* H; /**< normal matrix of the least-squares problem (Anderson) */
+  double* gamma; /**< mixing coefficients (Anderson) */
+  double* work; /**< work vector of size n */
+  fixed_point_acceleration_projection_ptr projection; /**< projection on the feasible set, may be NULL */
+  void* env; /**< first argument of the projection */
+  int restarts; /**< number of rejected accelerated steps */
+} fixed_point_acceleration;
+
+#if defined(__cplusplus) && !defined(BUILD_AS_CPP)
+extern "C"
+{
+#endif
+
+  /** Create the data of the acceleration of fixed point iterations
+      \param type the strategy, see SICONOS_FIXED_POINT_ACCELERATION_ENUM
+      \param n the size of the iterates
+      \param memory the number of differences used by Anderson mixing
+      (5 if <= 0)
+      \param omega_max the maximum relaxation parameter for SOR (1.9 if <= 1)
+      \param projection the projection on the feasible set (may be NULL)
+      \param env the first argument of projection
+      \return a pointer on the new data, NULL for SICONOS_FIXED_POINT_ACCELERATION_NONE
+  */
+  fixed_point_acceleration* fixed_point_acceleration_new(int type, int n, int memory,
+                                                         double omega_max,
+                                                         fixed_point_acceleration_projection_ptr projection,
+                                                         void* env);
+
+  /** Set the starting point of the iterations and reset the history
+      \param acc the acceleration data
+      \param x0 the starting point
+  */
+  void fixed_point_acceleration_initialize(fixed_point_acceleration* acc, const double* x0);
+
+  /** Compute the next iterate of the fixed point iterations
+      \param acc the acceleration data
+      \param x in: G(x_k), out: x_{k+1}
+      \param merit the merit value of G(x_k) (the error of the solver)
+  */
+  void fixed_point_acceleration_apply(fixed_point_acceleration* acc, double* x, double merit);
+
+  /** Free the data of the acceleration
+      \param acc the acceleration data (may be NULL)
+  */
+  void fixed_point_acceleration_free(fixed_point_acceleration* acc);
+
+#if defined(__cplusplus) && !defined(BUILD_AS_CPP)
+}
+#endif
+
+#endif
@@ -23,7 +23,9 @@
 #include <stdio.h>               // for printf
 #include <stdlib.h>              // for free, malloc, NULL, calloc
 #include <string.h>              // for memset
-#include "NumericsMatrix.h"      // for NumericsMatrix
+#include "CSparseMatrix_internal.h"  // for CSparseMatrix, CS_INT
+#include "NumericsMatrix.h"      // for NumericsMatrix, NM_csc, NM_LU_factorize
+#include "NumericsSparseMatrix.h"  // for NumericsSparseMatrix
 //#define DEBUG_STDOUT
 //#define DEBUG_MESSAGES
 #include "siconos_debug.h"               // for DEBUG_PRINT_MAT_STR, DEBUG_PRINT_VEC...
@@ -87,17 +89,16 @@ inline static void lumod_full_check(SN_lumod_dense_data* lumod_data)
 #endif
 }
 #endif
-/* Wrapper on dense matrix */
-SN_lumod_dense_data* SN_lumod_dense_allocate(unsigned n, unsigned maxmod)
+static SN_lumod_dense_data* lumod_allocate(unsigned n, unsigned maxmod, unsigned size_H)
 {
   SN_lumod_dense_data* lumod_data = (SN_lumod_dense_data*)malloc(sizeof(SN_lumod_dense_data));
   lumod_data->maxmod = maxmod;
   lumod_data->n = n;
   lumod_data->k = 0;
+  lumod_data->H = NULL;
 
   /* Perform only one big allocation
    * Formula: size = H + Uk + Yk + L_C + U_C + y + z + w*/
-  unsigned size_H = n*n;
   unsigned size_Uk = n*maxmod;
   unsigned size_Yk = n*maxmod;
   unsigned size_L_C = maxmod*maxmod;
@@ -111,9 +112,9 @@ SN_lumod_dense_data* SN_lumod_dense_allocate(unsigned n, unsigned maxmod)
 
   unsigned current_pointer = 0;
   /* H matrix */
-  lumod_data->LU_H = &data[current_pointer];
+  lumod_data->LU_H = size_H > 0 ? &data[current_pointer] : NULL;
   current_pointer += size_H;
-  lumod_data->ipiv_LU_H = (lapack_int*)malloc(n*sizeof(lapack_int));
+  lumod_data->ipiv_LU_H = size_H > 0 ? (lapack_int*)malloc(n*sizeof(lapack_int)) : NULL;
   lumod_data->factorized_basis = (unsigned*)malloc((4*n+2)*sizeof(unsigned));
   lumod_data->row_col_indx = (int*)malloc((2*n+1)*sizeof(int));
 
@@ -139,18 +140,42 @@ SN_lumod_dense_data* SN_lumod_dense_allocate(unsigned n, unsigned maxmod)
   return lumod_data;
 }
 
+/* Wrapper on dense matrix */
+SN_lumod_dense_data* SN_lumod_dense_allocate(unsigned n, unsigned maxmod)
+{
+  return lumod_allocate(n, maxmod, n*n);
+}
+
+/* H is kept in sparse format, only the BLU part is dense */
+SN_lumod_dense_data* SN_lumod_sparse_allocate(unsigned n, unsigned maxmod)
+{
+  return lumod_allocate(n, maxmod, 0);
+}
+
 void SM_lumod_dense_free(SN_lumod_dense_data* lumod_data)
 {
-  assert(lumod_data->LU_H);
-  free(lumod_data->LU_H);
-  assert(lumod_data->ipiv_LU_H);
-  free(lumod_data->ipiv_LU_H);
+  /* the big allocation starts with H when it is dense, with Uk otherwise */
+  if(lumod_data->LU_H)
+  {
+    free(lumod_data->LU_H);
+    assert(lumod_data->ipiv_LU_H);
+    free(lumod_data->ipiv_LU_H);
+  }
+  else
+  {
+    free(lumod_data->Uk);
+  }
+  if(lumod_data->H)
+  {
+    NM_free(lumod_data->H);
+  }
   assert(lumod_data->factorized_basis);
   free(lumod_data->factorized_basis);
   assert(lumod_data->row_col_indx);
   free(lumod_data->row_col_indx);
   /* Let's do things by the book */
   lumod_data->LU_H = NULL;
+  lumod_data->H = NULL;
   lumod_data->ipiv_LU_H = NULL;
   lumod_data->factorized_basis = NULL;
   lumod_data->row_col_indx = NULL;
@@ -179,8 +204,17 @@ int SN_lumod_dense_solve(SN_lumod_dense_data* restrict lumod_data, double* restr
 
   /*  Step 1. */
   DEBUG_PRINT_VEC_STR("col", x, n);
-  DGETRS(LA_NOTRANS, n, 1, lumod_data->LU_H, n, lumod_data->ipiv_LU_H, x, n, &infoLAPACK);
-  assert(infoLAPACK == 0  && "SN_lumod_solve :: info from DGETRS for solving H_0 X = b is not zero!\n");
+  if(lumod_data->LU_H)
+  {
+    DGETRS(LA_NOTRANS, n, 1, lumod_data->LU_H, n, lumod_data->ipiv_LU_H, x, n, &infoLAPACK);
+    assert(infoLAPACK == 0  && "SN_lumod_solve :: info from DGETRS for solving H_0 X = b is not zero!\n");
+  }
+  else
+  {
+    assert(lumod_data->H && "SN_lumod_solve :: H_0 has not been factorized!\n");
+    infoLAPACK = NM_LU_solve(lumod_data->H, x, 1);
+    assert(infoLAPACK == 0  && "SN_lumod_solve :: the sparse solve of H_0 X = b failed!\n");
+  }
   DEBUG_PRINT_VEC_STR("x1 sol to H x = col", x, n);
 
   /* Save H col_tilde = col for a possible BLU
@@ -237,19 +271,110 @@ exit_SN_lumod_dense_solve:
   return infoLAPACK;
 }
 
+static inline void lumod_reset_C(SN_lumod_dense_data* lumod_data)
+{
+  lumod_data->k = 0;
+  memset(lumod_data->Uk, 0, lumod_data->maxmod*lumod_data->n*sizeof(double));
+}
+
+/* Assemble the basis matrix directly in compressed columns and compute its
+ * sparse LU factors. The columns of M are taken from its csc storage. */
+static int lumod_factorize_sparse(SN_lumod_dense_data* restrict lumod_data, unsigned* restrict basis, NumericsMatrix* restrict M, double* covering_vector)
+{
+  unsigned n = lumod_data->n;
+  unsigned* factorized_basis = lumod_data->factorized_basis;
+  CSparseMatrix* Mcsc = NM_csc(M);
+  assert(Mcsc);
+  CS_INT* Mp = Mcsc->p;
+  CS_INT* Mi = Mcsc->i;
+  double* Mx = Mcsc->x;
+
+  /* Count the nonzeros of the basis matrix */
+  CS_INT nnz = 0;
+  for(unsigned i = 0; i < n; ++i)
+  {
+    unsigned var = basis[i] - BASIS_OFFSET;
+    if(var > n) nnz += Mp[var - n] - Mp[var - n - 1];
+    else if(var < n) ++nnz;
+    else for(unsigned j = 0; j < n; ++j) if(covering_vector[j] != 0.) ++nnz;
+  }
+
+  /* A fresh matrix is used: the previous factors are no longer valid */
+  if(lumod_data->H) NM_free(lumod_data->H);
+  NumericsMatrix* H = NM_create(NM_SPARSE, n, n);
+  lumod_data->H = H;
+  NM_csc_alloc(H, nnz);
+  CSparseMatrix* Hcsc = H->matrix2->csc;
+  CS_INT* Hp = Hcsc->p;
+  CS_INT* Hi = Hcsc->i;
+  double* Hx = Hcsc->x;
+
+  CS_INT pos = 0;
+  for(unsigned i = 0; i < n; ++i)
+  {
+    unsigned var = basis[i] - BASIS_OFFSET;
+    factorized_basis[var] = i + BASIS_OFFSET;
+    Hp[i] = pos;
+    if(var > n)  /* z var */
+    {
+      unsigned z_indx = var - n - 1;
+      for(CS_INT p = Mp[z_indx]; p < Mp[z_indx+1]; ++p)
+      {
+        Hi[pos] = Mi[p];
+        Hx[pos++] = Mx[p];
+      }
+    }
+    else if(var < n)
+    {
+      Hi[pos] = var;
+      Hx[pos++] = -1.;
+    }
+    else /* we have the auxiliary variable  */
+    {
+      for(unsigned j = 0; j < n; ++j)
+      {
+        if(covering_vector[j] != 0.)
+        {
+          Hi[pos] = j;
+          Hx[pos++] = covering_vector[j];
+        }
+      }
+    }
+  }
+  Hp[n] = pos;
+  assert(pos == nnz);
+
+  /* The rows of a column of M may not be sorted, CSparse does not care */
+  int info = NM_LU_factorize(H);
+  if(info)
+  {
+    printf("SN_lumod_factorize :: the sparse LU factorization of the basis failed, info = %d\n", info);
+  }
+  return info;
+}
+
 int SN_lumod_factorize(SN_lumod_dense_data* restrict lumod_data, unsigned* restrict basis, NumericsMatrix* restrict M, double* covering_vector)
 {
   /* Construct the basis matrix  */
   unsigned n = lumod_data->n;
   assert(n > 0);
+
   double* H = lumod_data->LU_H;
   unsigned* factorized_basis = lumod_data->factorized_basis;
-  double* Mlcp =  M->matrix0;
-  assert(Mlcp);
 
   /* Reset the factorized_basis */
   memset(factorized_basis, 0, (2*n+1)*sizeof(unsigned));
   memset(lumod_data->row_col_indx, 0, (2*n+1)*sizeof(int));
+
+  if(!H)
+  {
+    int info = lumod_factorize_sparse(lumod_data, basis, M, covering_vector);
+    if(info == 0) lumod_reset_C(lumod_data);
+    return info;
+  }
+
+  double* Mlcp =  M->matrix0;
+  assert(Mlcp);
   DEBUG_PRINT("Variables in factorized basis\n")
 
   for(unsigned i = 0, j = 0; i < n; ++i, j += n)
@@ -295,9 +420,7 @@ int SN_lumod_factorize(SN_lumod_dense_data* restrict lumod_data, unsigned* restr
     return infoDGETRF;
   }
 
-  /* Reset C */
-  lumod_data->k = 0;
-  memset(lumod_data->Uk, 0, lumod_data->maxmod*n*sizeof(double));
+  lumod_reset_C(lumod_data);
 
   return 0;
 }
@@ -34,7 +34,8 @@ typedef struct {
   unsigned n; /**< size of the matrix H*/
   unsigned maxmod; /**< maximum number of changes */
   unsigned k; /**< number of rows (or columns) of C */
-  double* LU_H; /**< LU factors of the initial matrix H */
+  double* LU_H; /**< LU factors of the initial matrix H (NULL if H is sparse) */
+  NumericsMatrix* H; /**< sparse initial matrix H and its LU factors (NULL if H is dense) */
   lapack_int* ipiv_LU_H; /**< pivot for the LU factorization of H*/
   unsigned* factorized_basis; /**< basis when H was factorized and storing for the info where the columns of the non basic variables are in U and when a basic variable exited */
   int* row_col_indx; /**< Store the information to which column or row the variable correspond */
@@ -62,6 +63,16 @@ static inline unsigned SN_lumod_find_arg_var(int* array, int p, unsigned n)
 }
 
 SN_lumod_dense_data* SN_lumod_dense_allocate(unsigned n, unsigned maxmod);
+
+/** Allocate the data for the BLU updates when the initial matrix H is
+ * assembled and factorized in sparse format (the LCP matrix must then be
+ * NM_SPARSE). Only the BLU part is stored densely, hence the memory is in
+ * O(n*maxmod) instead of O(n^2).
+ * \param n size of the matrix H
+ * \param maxmod maximum number of changes before a refactorization
+ * \return the data for the BLU updates
+ */
+SN_lumod_dense_data* SN_lumod_sparse_allocate(unsigned n, unsigned maxmod);
 void SM_lumod_dense_free(SN_lumod_dense_data* lumod_data);
 int SN_lumod_dense_solve(SN_lumod_dense_data* lumod_data, double* x, double* col_tilde);
 void SN_lumod_add_row_col(SN_lumod_dense_data* lumod_data, unsigned leaving_indx, double* col);
@@ -3399,6 +3399,56 @@ static int test_NM_Cholesky_solve_vs_posv_expert(void)
 
 
 
+/* refactorize a matrix with unchanged pattern: the symbolic analysis
+ * must be reused and the solution must follow the new values */
+static int test_NM_refactorize_same_pattern(int ldlt)
+{
+  printf("========= start Numerics tests for NumericsMatrix  (test_NM_refactorize_same_pattern, %s) ========= \n",
+         ldlt ? "LDLT" : "Cholesky");
+  int info = 0;
+  FILE* finput = fopen("./data/W_102x102.dat", "r");
+  NumericsMatrix *  W = NM_new_from_file(finput);
+  fclose(finput);
+  NM_csc(W);
+
+  int n = W->size0;
+  double * x = (double*)malloc(n* sizeof(double));
+  double * x2 = (double*)malloc(n* sizeof(double));
+  for(int j=0; j < n; j++)
+    x2[j] = x[j] = 1.0;
+
+  NM_preserve(W);
+  if (ldlt)
+    NM_LDLT_solve(W, x, 1);
+  else
+    NM_Cholesky_solve(W, x, 1);
+  CSparseMatrix_symbolic* sym = NM_internalData(W)->symbolic;
+  if (!sym) info = 1;
+
+  /* same pattern, new values */
+  NM_unpreserve(W);
+  NM_scal(2.0, W);
+  NM_preserve(W);
+  if (ldlt)
+    NM_LDLT_solve(W, x2, 1);
+  else
+    NM_Cholesky_solve(W, x2, 1);
+  if (NM_internalData(W)->symbolic != sym) info = 1;
+
+  for(int j=0; j < n; j++)
+    x2[j] = 2.0*x2[j]-x[j];
+  double diff = cblas_dnrm2(n,x2,1);
+  printf("diff = %e\n", diff);
+  if(!(fabs(diff) < sqrt(DBL_EPSILON)*cblas_dnrm2(n,x,1)))
+    info = 1;
+
+  free(x);
+  free(x2);
+  NM_free(W);
+  printf("========= end Numerics tests for NumericsMatrix  (test_NM_refactorize_same_pattern) ========= \n");
+  return info;
+}
+
 static int test_NM_LDLT_solve_unit(NumericsMatrix * M, double * b)
 {
   int n = M->size0;
@@ -4327,6 +4377,8 @@ int main(int argc, char *argv[])
   info += test_NM_Cholesky_solve();
   info += test_NM_Cholesky_solve_vs_posv_expert();
   info += test_NM_LDLT_solve();
+  info += test_NM_refactorize_same_pattern(0);
+  info += test_NM_refactorize_same_pattern(1);
 
 #ifdef WITH_MA57
   info += test_NM_LDLT_refine();
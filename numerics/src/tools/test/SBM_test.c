@@ -23,6 +23,7 @@
  */
 
 #include "SBM_test.h"
+#include <math.h>                        // for fabs
 #include <stdio.h>                       // for printf, fclose, fopen, FILE
 #include <stdlib.h>                      // for free, malloc, calloc
 #include "CSparseMatrix_internal.h"               // for CSparseMatrix_spfree_on_stack
@@ -1262,6 +1263,47 @@ int SBM_entry_all(void)
 
 }
 
+int SBM_row_prod_no_diag_3x3_float_all(void)
+{
+  printf("========= Starts SBM tests SBM_row_prod_no_diag_3x3_float ========= \n");
+  FILE *file = fopen("data/SBM1.dat", "r");
+  SparseBlockStructuredMatrix * M = SBM_new_from_file(file);
+  fclose(file);
+
+  unsigned int n = M->blocksize0[M->blocknumber0 - 1];
+  double * x = (double *)malloc(n * sizeof(double));
+  for(unsigned int i = 0; i < n; ++i)
+    x[i] = 1.0 + i;
+
+  float * blocks = SBM_new_float_blocks_3x3(M);
+
+  int info = 0;
+  for(unsigned int row = 0; row < M->blocknumber0; ++row)
+  {
+    double y[3] = {0., 0., 0.};
+    double yf[3] = {0., 0., 0.};
+    SBM_row_prod_no_diag_3x3(n, 3, row, M, x, y);
+    SBM_row_prod_no_diag_3x3_float(row, M, blocks, x, yf);
+    for(int i = 0; i < 3; ++i)
+    {
+      if(fabs(y[i] - yf[i]) > 1e-6 * (1.0 + fabs(y[i])))
+      {
+        printf("row %i, component %i : %e != %e\n", row, i, y[i], yf[i]);
+        info = 1;
+      }
+    }
+  }
+
+  free(blocks);
+  free(x);
+  SBM_clear(M);
+
+  if(info)
+    printf("========= Ends SBM tests SBM_row_prod_no_diag_3x3_float :  Unsuccessfull ========= \n");
+  else
+    printf("========= Ends SBM tests SBM_row_prod_no_diag_3x3_float :  successfull ========= \n");
+  return info;
+}
 
 int main()
 {
@@ -1286,5 +1328,7 @@ int main()
 
   info += SBM_extract_component_3x3_all();
 
+  info += SBM_row_prod_no_diag_3x3_float_all();
+
   return info;
 }
@@ -0,0 +1,126 @@
+/* Siconos is a program dedicated to modeling, simulation and control
+ * of non smooth dynamical systems.
+ *
+ * Copyright 2022 INRIA.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#include <math.h>                      // for sqrt
+#include <stdio.h>                     // for printf
+#include "fixed_point_acceleration.h"  // for fixed_point_acceleration_new
+
+#define N 50
+
+/* G(x) = A x + b with A diagonal, the spectral radius of A is 0.99 */
+static double A[N];
+static double b[N];
+
+static void fixed_point_map(const double* x, double* g, int projected)
+{
+  for(int i = 0; i < N; ++i)
+  {
+    g[i] = A[i] * x[i] + b[i];
+    if(projected && g[i] < 0.0) g[i] = 0.0;
+  }
+}
+
+static void projection_nonnegative(void* env, double* x, double* px)
+{
+  for(int i = 0; i < N; ++i)
+    px[i] = (x[i] > 0.0) ? x[i] : 0.0;
+}
+
+/* Solve x = G(x) with the given acceleration, return the number of
+ * iterations (itermax if the iterations fail) */
+static int fixed_point_solve(int type, int projected, double tolerance, int itermax)
+{
+  double x[N], g[N];
+  for(int i = 0; i < N; ++i) x[i] = 0.0;
+
+  fixed_point_acceleration* acc =
+    fixed_point_acceleration_new(type, N, 5, 1.9,
+                                 projected ? &projection_nonnegative : NULL, NULL);
+  if(acc)
+    fixed_point_acceleration_initialize(acc, x);
+
+  int iter = 0;
+  double error = 1.0;
+  while(iter < itermax)
+  {
+    ++iter;
+    fixed_point_map(x, g, projected);
+    error = 0.0;
+    for(int i = 0; i < N; ++i)
+    {
+      error += (g[i] - x[i]) * (g[i] - x[i]);
+      x[i] = g[i];
+    }
+    error = sqrt(error);
+    if(error < tolerance)
+      break;
+    if(acc)
+      fixed_point_acceleration_apply(acc, x, error);
+  }
+
+  /* check the solution */
+  fixed_point_map(x, g, projected);
+  double residual = 0.0;
+  for(int i = 0; i < N; ++i)
+    residual += (g[i] - x[i]) * (g[i] - x[i]);
+  residual = sqrt(residual);
+
+  printf("acceleration %i, projected %i: %i iterations, %i restarts, residual = %e\n",
+         type, projected, iter, acc ? acc->restarts : 0, residual);
+  fixed_point_acceleration_free(acc);
+
+  if(!(residual < tolerance))
+    return itermax;
+  return iter;
+}
+
+int main(void)
+{
+  int info = 0;
+  double tolerance = 1e-10;
+  int itermax = 100000;
+
+  for(int i = 0; i < N; ++i)
+    A[i] = 0.99 * (double) i / (double)(N - 1);
+
+  for(int projected = 0; projected < 2; ++projected)
+  {
+    for(int i = 0; i < N; ++i)
+      b[i] = (projected && i % 2) ? -1.0 : 1.0;
+
+    int iter_plain = fixed_point_solve(SICONOS_FIXED_POINT_ACCELERATION_NONE,
+                                       projected, tolerance, itermax);
+    if(iter_plain == itermax)
+      info = 1;
+
+    int types[3] = {SICONOS_FIXED_POINT_ACCELERATION_ANDERSON,
+                    SICONOS_FIXED_POINT_ACCELERATION_NESTEROV,
+                    SICONOS_FIXED_POINT_ACCELERATION_SOR
+                   };
+    for(int t = 0; t < 3; ++t)
+    {
+      int iter = fixed_point_solve(types[t], projected, tolerance, itermax);
+      if(!(iter < iter_plain))
+      {
+        printf("acceleration %i does not reduce the number of iterations\n", types[t]);
+        info = 1;
+      }
+    }
+  }
+  return info;
+}
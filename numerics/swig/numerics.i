@@ -112,6 +112,66 @@ static char* format_msg_concat(const char* msg1, const char* msg2)
 
 }
 
+#ifdef SWIGPYTHON
+// Drivers that never call python back run with the GIL released.
+// The GIL must be restored before raising, including after a longjmp
+// from numerics, hence the explicit save/restore around setjmp.
+%define SN_DRIVER_RELEASE_GIL(DRIVER)
+%exception DRIVER {
+  PyThreadState* sn_thread_state = PyEval_SaveThread();
+  switch (SN_SETJMP_EXTERNAL_START)
+  {
+  case SN_NO_ERROR:
+  {
+    $action
+    SN_SETJMP_EXTERNAL_STOP
+    PyEval_RestoreThread(sn_thread_state);
+    break;
+  }
+  case SN_MEMORY_ALLOC_ERROR:
+  {
+    PyEval_RestoreThread(sn_thread_state);
+    SWIG_exception(SWIG_MemoryError, format_exception_msg("Out of memory:"));
+    break;
+  }
+  case SN_UNSUPPORTED_LINALG_OP:
+  {
+    PyEval_RestoreThread(sn_thread_state);
+    SWIG_exception(SWIG_RuntimeError, format_exception_msg("Unsupported linear algebra operation:"));
+    break;
+  }
+  case SN_PROBLEM_NOT_PROCESSABLE:
+  {
+    PyEval_RestoreThread(sn_thread_state);
+    SWIG_exception(SWIG_RuntimeError, format_exception_msg("The given problem is not processable:"));
+    break;
+  }
+  default:
+  {
+    PyEval_RestoreThread(sn_thread_state);
+    SWIG_exception(SWIG_UnknownError, format_exception_msg("Unknown error! Hopefully more info follow:"));
+    break;
+  }
+  }
+}
+%enddef
+
+SN_DRIVER_RELEASE_GIL(linearComplementarity_driver)
+SN_DRIVER_RELEASE_GIL(mlcp_driver)
+SN_DRIVER_RELEASE_GIL(fc2d_driver)
+SN_DRIVER_RELEASE_GIL(fc3d_driver)
+SN_DRIVER_RELEASE_GIL(rolling_fc2d_driver)
+SN_DRIVER_RELEASE_GIL(rolling_fc3d_driver)
+SN_DRIVER_RELEASE_GIL(gfc2d_driver)
+SN_DRIVER_RELEASE_GIL(gfc3d_driver)
+SN_DRIVER_RELEASE_GIL(g_rolling_fc3d_driver)
+SN_DRIVER_RELEASE_GIL(avi_driver)
+SN_DRIVER_RELEASE_GIL(soclcp_driver)
+SN_DRIVER_RELEASE_GIL(relay_driver)
+SN_DRIVER_RELEASE_GIL(fc3d_LmgcDriver)
+SN_DRIVER_RELEASE_GIL(gfc3d_LmgcDriver)
+#endif /* SWIGPYTHON */
+
 // generated docstrings from doxygen xml output
 // %include numerics-docstrings.i
 
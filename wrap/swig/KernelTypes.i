@@ -597,6 +597,24 @@ struct IsDense : public Question<bool>
     return c_result;
   }
 
+  // Copy the values of v, built from the python array obj, back into obj.
+  // v is seen through a numpy view (no intermediate copy) so that numpy
+  // handles the strides, the memory order and the type of obj.
+  bool SiconosVector_argout(PyObject* obj, SP::SiconosVector v)
+  {
+    if (!v || !is_array(obj) || !PyArray_ISWRITEABLE((PyArrayObject*) obj))
+      return true;
+
+    npy_intp this_vector_dim[1];
+    this_vector_dim[0] = v->size();
+
+    PyObject* view;
+    PYARRAY_FROM_SHARED_SICONOS_DATA(NPY_DOUBLE, 1, this_vector_dim, v, view);
+    int res = PyArray_CopyInto((PyArrayObject*) obj, (PyArrayObject*) view);
+    Py_DECREF(view);
+    return res >= 0;
+  }
+
 }
 
 %fragment("BlockVector", "header", fragment="NumPy_Fragments")
@@ -869,6 +887,24 @@ struct IsDense : public Question<bool>
     }
     return true;
   }
+
+  // Copy the values of the dense matrix m, built from the python array
+  // obj, back into obj, see SiconosVector_argout.
+  bool SiconosMatrix_argout(PyObject* obj, SP::SiconosMatrix m)
+  {
+    if (!m || m->num() != 1 || !is_array(obj) || !PyArray_ISWRITEABLE((PyArrayObject*) obj))
+      return true;
+
+    npy_intp this_matrix_dim[2];
+    this_matrix_dim[0] = m->size(0);
+    this_matrix_dim[1] = m->size(1);
+
+    PyObject* view;
+    PYARRAY_FROM_SHARED_SICONOS_DATA(NPY_DOUBLE, 2, this_matrix_dim, m, view);
+    int res = PyArray_CopyInto((PyArrayObject*) obj, (PyArrayObject*) view);
+    Py_DECREF(view);
+    return res >= 0;
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -925,6 +961,19 @@ struct IsDense : public Question<bool>
     { Py_DECREF(array$argnum); }
 }
 
+// a numpy array given for a non-const reference is copied in a
+// temporary SiconosVector (DenseVect owns its std::vector<double>
+// storage and cannot borrow the numpy buffer). For the in-place
+// arguments listed with %apply (see SiconosAlgebra.i), the result is
+// copied back so that the updates made by the C++ side are seen from
+// python.
+%typemap(argout, fragment="SiconosVector") (SiconosVector & INPLACE)
+{
+  if (array$argnum && !keeper$argnum.empty()
+      && !SiconosVector_argout($input, keeper$argnum.back()))
+    SWIG_fail;
+}
+
 %typemap(freearg) (SiconosVector &)
 {
   if (is_new_object$argnum && array$argnum)
@@ -1136,6 +1185,15 @@ struct IsDense : public Question<bool>
     { Py_DECREF(array$argnum); }
 }
 
+// as for SiconosVector & INPLACE, a numpy array given for an in-place
+// argument is updated with the values of the temporary matrix
+%typemap(argout, fragment="SiconosMatrix") (TYPE& INPLACE)
+{
+  if (array$argnum && !keeper$argnum.empty()
+      && !SiconosMatrix_argout($input, keeper$argnum.back()))
+    SWIG_fail;
+}
+
 %typemap(freearg) (TYPE&)
 {
   if (is_new_object$argnum && array$argnum)
@@ -1334,6 +1392,7 @@ struct IsDense : public Question<bool>
 
 // Other vector types
 %template(UnsignedIntVector) std::vector<unsigned int>;
+%template(StringVector) std::vector<std::string>;
 
 //////////////////////////
 
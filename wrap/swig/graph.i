@@ -121,6 +121,37 @@ struct DynamicalSystemsGraph{};
   $result = py_tuple;
 }
 
+// any python sequence of dynamical systems
+%typemap(in) (const std::vector<SP::DynamicalSystem>&) (std::vector<SP::DynamicalSystem> temp)
+{
+  if (!PySequence_Check($input))
+  {
+    SWIG_exception_fail(SWIG_TypeError, "a sequence of DynamicalSystem is expected");
+  }
+  Py_ssize_t size = PySequence_Size($input);
+  temp.reserve(size);
+  for (Py_ssize_t i = 0; i < size; ++i)
+  {
+    PyObject* item = PySequence_GetItem($input, i);
+    void* argp = 0;
+    int newmem = 0;
+    int res = SWIG_ConvertPtrAndOwn(item, &argp, $descriptor(SP::DynamicalSystem *), 0, &newmem);
+    Py_DECREF(item);
+    if (!SWIG_IsOK(res))
+    {
+      SWIG_exception_fail(SWIG_ArgError(res), "a sequence of DynamicalSystem is expected");
+    }
+    temp.push_back(argp ? *%reinterpret_cast(argp, SP::DynamicalSystem *) : SP::DynamicalSystem());
+    if (newmem & SWIG_CAST_NEW_MEMORY) delete %reinterpret_cast(argp, SP::DynamicalSystem *);
+  }
+  $1 = &temp;
+}
+
+%typemap(typecheck, precedence=SWIG_TYPECHECK_POINTER) (const std::vector<SP::DynamicalSystem>&)
+{
+  $1 = PySequence_Check($input) ? 1 : 0;
+}
+
 %typemap(out) (std::vector<SP::Interaction>)
 {
   PyObject* py_tuple = PyTuple_New($1.size());
@@ -240,6 +240,11 @@ static int convert_darray(PyObject *input, double *ptr) {
                             double error,
                             void* extra_data)
   {
+    // the solver may run with the GIL released (see numerics.i):
+    // take it back before creating any python object.
+    PyGILState_STATE gstate;
+    gstate = PyGILState_Ensure();
+
     // A little bit of black magic
     PyObject* py_tuple;
     if (extra_data)
@@ -315,20 +320,17 @@ static int convert_darray(PyObject *input, double *ptr) {
       PyTuple_SetItem(py_args, 2, py_error);
       PyTuple_SetItem(py_args, 3, py_tuple);
 
-      PyGILState_STATE gstate;
-      gstate = PyGILState_Ensure();
-
       PyObject* py_out = PyObject_CallObject((PyObject*) env, py_args);
 
       Py_DECREF(py_args);
       Py_XDECREF(py_out);
-
-      PyGILState_Release(gstate);
     }
     else
     {
+      Py_DECREF(py_tuple);
       PyErr_SetString(PyExc_TypeError,"Expecting a callable callback");
     }
+    PyGILState_Release(gstate);
   };
 
 %}
@@ -63,6 +63,10 @@ SWIGEXPORT PyObject* SWIG_init(void);
 
 // mandatory !
 %rename (lambda_) lambda;
+
+// modules are built with -threads, but the GIL is kept during calls
+// unless explicitly released (nothreadallow set to 0) for a function.
+%nothreadallow;
 #endif /* SWIGPYTHON */
 
 #ifdef SWIGMATLAB